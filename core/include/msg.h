@@ -238,6 +238,49 @@ int msg_send(msg_t *m, kernel_pid_t target_pid);
  */
 int msg_try_send(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send multiple messages to a thread (non-blocking).
+ *
+ * Delivers the messages in @p m in order, the first one directly if the
+ * receiver is waiting, all others into its message queue. This happens in a
+ * single critical section and causes at most one context switch, so it is
+ * cheaper than calling @ref msg_try_send() @p numof times. The receiver can
+ * fetch the messages in one go with @ref msg_receive_batch().
+ *
+ * Delivery stops at the first message that does not fit into the message
+ * queue of the receiver. It is safe to call this function from interrupt
+ * context.
+ *
+ * @param[in] m             Array of @p numof messages, must not be NULL.
+ * @param[in] numof         Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  number of messages delivered (the first ones in @p m)
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned numof, kernel_pid_t target_pid);
+
+/**
+ * @brief Send a message to multiple threads (non-blocking).
+ *
+ * Like @ref msg_send_batch(), but delivers a copy of @p m to each of the
+ * threads in @p target_pids. All receivers are woken up in a single critical
+ * section and the sender is preempted at most once, after the message was
+ * delivered to all of them.
+ *
+ * It is safe to call this function from interrupt context.
+ *
+ * @param[in] m             Pointer to preallocated ``msg_t`` structure, must
+ *                          not be NULL.
+ * @param[in] target_pids   Array of @p numof PIDs of the target threads
+ * @param[in] numof         Number of entries in @p target_pids
+ *
+ * @return  number of threads the message was delivered to. Invalid PIDs and
+ *          receivers that are not waiting and have a full message queue are
+ *          skipped.
+ */
+int msg_send_multi(msg_t *m, const kernel_pid_t *target_pids, unsigned numof);
+
 /**
  * @brief Send a message to the current thread.
  * @details Will work only if the thread has a message queue.
@@ -315,6 +358,20 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages.
+ *
+ * Blocks until at least one message was received, then fetches up to
+ * @p numof messages that are already queued or waiting to be sent to the
+ * current thread in a single critical section.
+ *
+ * @param[out] m    Array of @p numof ``msg_t`` structures, must not be NULL.
+ * @param[in] numof Size of @p m, must not be 0.
+ *
+ * @return  number of messages received, at least 1.
+ */
+unsigned msg_receive_batch(msg_t *m, unsigned numof);
+
 /**
  * @brief Send a message, block until reply received.
  *
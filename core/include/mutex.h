@@ -71,6 +71,22 @@ typedef struct {
      */
     uint8_t owner_original_priority;
 #endif
+#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIO_QUEUE)
+    /**
+     * @brief   Bitmap of the priorities that have threads waiting for the
+     *          mutex
+     * @note    Only available if module core_mutex_prio_queue is used.
+     */
+    uint32_t waiters_bitcache;
+    /**
+     * @brief   Last waiting thread of each priority in @ref mutex_t::queue
+     * @note    Only available if module core_mutex_prio_queue is used.
+     *
+     * An entry is only valid if the bit for its priority is set in
+     * @ref mutex_t::waiters_bitcache.
+     */
+    list_node_t *waiters_tail[SCHED_PRIO_LEVELS];
+#endif
 } mutex_t;
 
 /**
@@ -141,6 +157,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIO_QUEUE
+    mutex->waiters_bitcache = 0;
+#endif
 }
 
 /**
@@ -168,6 +168,11 @@ struct _thread {
     char *sp;                       /**< thread's stack pointer         */
     thread_status_t status;         /**< thread's status                */
     uint8_t priority;               /**< thread's priority              */
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    uint8_t base_priority;          /**< thread's priority without the
+                                         priority it inherited from
+                                         threads waiting for its mutexes */
+#endif
 
     kernel_pid_t pid;               /**< thread's process id            */
 
@@ -183,18 +183,11 @@ int msg_send_to_self(msg_t *m)
     return res;
 }
 
-static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
+static int _msg_deliver(msg_t *m, thread_t *target)
 {
-    thread_t *target = thread_get(target_pid);
-
-    if (target == NULL) {
-        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
-        return -1;
-    }
-
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
-              PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
+              PRIkernel_pid ".\n", __func__, thread_getpid(), target->pid);
 
         /* copy msg to target */
         msg_t *target_message = (msg_t *)target->wait_data;
@@ -214,6 +207,18 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
     }
 }
 
+static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
+{
+    thread_t *target = thread_get(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        return -1;
+    }
+
+    return _msg_deliver(m, target);
+}
+
 int msg_send_int(msg_t *m, kernel_pid_t target_pid)
 {
     int res;
@@ -257,6 +262,64 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
     return count;
 }
 
+int msg_send_batch(msg_t *m, unsigned numof, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    int count = 0;
+
+    unsigned state = irq_disable();
+    thread_t *target = thread_get(target_pid);
+
+    if (target == NULL) {
+        DEBUG("msg_send_batch(): target thread %d does not exist\n",
+              target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    /* once the first message woke the receiver up, all others are queued */
+    while ((unsigned)count < numof) {
+        m[count].sender_pid = sender_pid;
+        if (_msg_deliver(&m[count], target) < 1) {
+            break;
+        }
+        count++;
+    }
+
+    irq_restore(state);
+
+    if (sched_context_switch_request && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return count;
+}
+
+int msg_send_multi(msg_t *m, const kernel_pid_t *target_pids, unsigned numof)
+{
+    const bool in_irq = irq_is_in();
+    int count = 0;
+
+    m->sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < numof; i++) {
+        if (_msg_send_oneway(m, target_pids[i]) > 0) {
+            ++count;
+        }
+    }
+
+    irq_restore(state);
+
+    if (sched_context_switch_request && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return count;
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(thread_getpid() != target_pid);
@@ -446,6 +509,71 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/* fetches up to numof messages without blocking, in one critical section */
+static unsigned _msg_receive_avail(msg_t *m, unsigned numof)
+{
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned count = 0;
+
+    while (count < numof) {
+        int queue_index = -1;
+
+        if (thread_has_msg_queue(me)) {
+            queue_index = cib_get(&(me->msg_queue));
+        }
+        if (queue_index >= 0) {
+            m[count++] = me->msg_array[queue_index];
+        }
+
+        /* blocked senders came in after the queue was full, so their
+         * messages go to the end of the queue, as in _msg_receive() */
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+        if (next == NULL) {
+            if (queue_index < 0) {
+                break;
+            }
+            continue;
+        }
+
+        thread_t *sender =
+            container_of((clist_node_t *)next, thread_t, rq_entry);
+        msg_t *dst = (queue_index >= 0)
+                   ? &me->msg_array[cib_put(&me->msg_queue)]
+                   : &m[count++];
+
+        *dst = *((msg_t *)sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            sender_prio = MIN(sender_prio, sender->priority);
+        }
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return count;
+}
+
+unsigned msg_receive_batch(msg_t *m, unsigned numof)
+{
+    assert(numof > 0);
+
+    unsigned count = _msg_receive_avail(m, numof);
+
+    if (count == 0) {
+        _msg_receive(m, 1);
+        count = 1;
+        if (numof > 1) {
+            count += _msg_receive_avail(&m[1], numof - 1);
+        }
+    }
+    return count;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -21,6 +21,7 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#include "bitarithm.h"
 #include "cpu.h"
 #include "mutex.h"
 #include "thread.h"
@@ -33,6 +34,165 @@
 
 #if MAXTHREADS > 1
 
+#if IS_USED(MODULE_CORE_MUTEX_PRIO_QUEUE)
+/* The waiters are kept in a single list sorted by priority, just as without
+ * this module. Additionally, the last waiter of each priority is remembered,
+ * together with a bitmap of the priorities that have waiters (just like the
+ * runqueue_bitcache of the scheduler). This allows finding the place to
+ * insert a new waiter without walking the list. */
+static void _queue_add(mutex_t *mutex, thread_t *thread)
+{
+    list_node_t *node = (list_node_t *)&thread->rq_entry;
+    unsigned prio = thread->priority;
+    /* waiters of equal or higher priority than the new one */
+    uint32_t before = mutex->waiters_bitcache & (UINT32_MAX >> (31 - prio));
+
+    if (before == 0) {
+        node->next = (mutex->queue.next == MUTEX_LOCKED) ? NULL
+                                                         : mutex->queue.next;
+        mutex->queue.next = node;
+    }
+    else {
+        list_node_t *prev = mutex->waiters_tail[bitarithm_msb(before)];
+
+        node->next = prev->next;
+        prev->next = node;
+    }
+    mutex->waiters_tail[prio] = node;
+    mutex->waiters_bitcache |= 1UL << prio;
+}
+
+static thread_t *_queue_pop(mutex_t *mutex)
+{
+    list_node_t *node = mutex->queue.next;
+    /* the head of the list belongs to the highest priority with waiters,
+     * regardless of priority changes while waiting */
+    unsigned prio = bitarithm_lsb(mutex->waiters_bitcache);
+
+    if (mutex->waiters_tail[prio] == node) {
+        mutex->waiters_bitcache &= ~(1UL << prio);
+    }
+    mutex->queue.next = (node->next) ? node->next : MUTEX_LOCKED;
+
+    return container_of((clist_node_t *)node, thread_t, rq_entry);
+}
+
+static bool _queue_remove(mutex_t *mutex, thread_t *thread)
+{
+    list_node_t *node = (list_node_t *)&thread->rq_entry;
+    list_node_t *prev = &mutex->queue;
+    uint32_t levels = mutex->waiters_bitcache;
+    bool first_of_level = true;
+
+    /* this is O(n), but only needed for mutex_cancel() */
+    for (list_node_t *n = mutex->queue.next; n != NULL; prev = n, n = n->next) {
+        unsigned prio = bitarithm_lsb(levels);
+
+        if (n == node) {
+            if (mutex->waiters_tail[prio] == node) {
+                if (first_of_level) {
+                    mutex->waiters_bitcache &= ~(1UL << prio);
+                }
+                else {
+                    mutex->waiters_tail[prio] = prev;
+                }
+            }
+            prev->next = node->next;
+            if (mutex->queue.next == NULL) {
+                mutex->queue.next = MUTEX_LOCKED;
+            }
+            return true;
+        }
+        first_of_level = (n == mutex->waiters_tail[prio]);
+        if (first_of_level) {
+            levels &= ~(1UL << prio);
+        }
+    }
+    return false;
+}
+#else
+static inline void _queue_add(mutex_t *mutex, thread_t *thread)
+{
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        mutex->queue.next = (list_node_t *)&thread->rq_entry;
+        mutex->queue.next->next = NULL;
+    }
+    else {
+        thread_add_to_list(&mutex->queue, thread);
+    }
+}
+
+static inline thread_t *_queue_pop(mutex_t *mutex)
+{
+    list_node_t *next = list_remove_head(&mutex->queue);
+
+    if (!mutex->queue.next) {
+        mutex->queue.next = MUTEX_LOCKED;
+    }
+    return container_of((clist_node_t *)next, thread_t, rq_entry);
+}
+
+static inline bool _queue_remove(mutex_t *mutex, thread_t *thread)
+{
+    if (!list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
+        return false;
+    }
+    if (mutex->queue.next == NULL) {
+        mutex->queue.next = MUTEX_LOCKED;
+    }
+    return true;
+}
+#endif
+
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/* Changes the priority of a thread for priority inheritance, without changing
+ * the priority it falls back to */
+static void _inherit_priority(thread_t *thread, uint8_t priority)
+{
+    uint8_t base_priority = thread->base_priority;
+
+    sched_change_priority(thread, priority);
+    thread->base_priority = base_priority;
+}
+#endif
+
+/**
+ * @brief   Hand a mutex over to the first waiter
+ * @pre     IRQs are disabled
+ *
+ * The previous owner falls back to its priority from before locking the mutex.
+ * The new owner inherits the priority of the remaining waiters, the first of
+ * them has the highest priority.
+ */
+static inline void _handover(mutex_t *mutex, thread_t *process)
+{
+    (void)mutex;
+    (void)process;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    thread_t *owner = thread_get(mutex->owner);
+    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
+        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
+              owner->pid, (unsigned)owner->priority,
+              (unsigned)mutex->owner_original_priority);
+        _inherit_priority(owner, mutex->owner_original_priority);
+    }
+#endif
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+    || IS_USED(MODULE_CORE_MUTEX_DEBUG)
+    mutex->owner = process->pid;
+#endif
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    mutex->owner_original_priority = process->base_priority;
+    if (mutex->queue.next != MUTEX_LOCKED) {
+        thread_t *waiter = container_of((clist_node_t *)mutex->queue.next,
+                                        thread_t, rq_entry);
+        if (waiter->priority < process->priority) {
+            _inherit_priority(process, waiter->priority);
+        }
+    }
+#endif
+}
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -65,13 +225,7 @@ void _block(mutex_t *mutex,
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
-    if (mutex->queue.next == MUTEX_LOCKED) {
-        mutex->queue.next = (list_node_t *)&me->rq_entry;
-        mutex->queue.next->next = NULL;
-    }
-    else {
-        thread_add_to_list(&mutex->queue, me);
-    }
+    _queue_add(mutex, me);
 
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
     thread_t *owner = thread_get(mutex->owner);
@@ -80,7 +234,7 @@ void _block(mutex_t *mutex,
               ": %u --> %u\n",
               thread_getpid(), mutex->owner,
               (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
+        _inherit_priority(owner, me->priority);
     }
 #endif
 
@@ -115,7 +269,7 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
         mutex->owner_calling_pc = pc;
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
+        mutex->owner_original_priority = me->base_priority;
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
@@ -164,7 +318,7 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
         mutex->owner_calling_pc = pc;
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
+        mutex->owner_original_priority = me->base_priority;
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
@@ -201,27 +355,12 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
-    list_node_t *next = list_remove_head(&mutex->queue);
-
-    thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
+    thread_t *process = _queue_pop(mutex);
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
     sched_set_status(process, STATUS_PENDING);
-
-    if (!mutex->queue.next) {
-        mutex->queue.next = MUTEX_LOCKED;
-    }
-
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid, (unsigned)owner->priority,
-              (unsigned)mutex->owner_original_priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
-#endif
+    _handover(mutex, process);
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = 0;
 #endif
@@ -241,15 +380,11 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             mutex->queue.next = NULL;
         }
         else {
-            list_node_t *next = list_remove_head(&mutex->queue);
-            thread_t *process = container_of((clist_node_t *)next, thread_t,
-                                             rq_entry);
+            thread_t *process = _queue_pop(mutex);
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
-            if (!mutex->queue.next) {
-                mutex->queue.next = MUTEX_LOCKED;
-            }
+            _handover(mutex, process);
         }
     }
 
@@ -278,11 +413,8 @@ void mutex_cancel(mutex_cancel_t *mc)
 
     if ((mutex->queue.next != MUTEX_LOCKED)
         && (mutex->queue.next != NULL)
-        && list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
+        && _queue_remove(mutex, thread)) {
         /* Thread was queued and removed from list, wake it up */
-        if (mutex->queue.next == NULL) {
-            mutex->queue.next = MUTEX_LOCKED;
-        }
         sched_set_status(thread, STATUS_PENDING);
         irq_restore(irq_state);
         sched_switch(thread->priority);
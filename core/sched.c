@@ -333,6 +333,9 @@ void sched_change_priority(thread_t *thread, uint8_t priority)
 {
     assert(thread && (priority < SCHED_PRIO_LEVELS));
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+#endif
     if (thread->priority == priority) {
         return;
     }
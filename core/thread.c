@@ -343,6 +343,9 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 #endif
 
     thread->priority = priority;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+#endif
     thread->status = STATUS_STOPPED;
 
     thread->rq_entry.next = NULL;
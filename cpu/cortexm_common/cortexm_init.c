@@ -15,13 +15,55 @@
  * @}
  */
 
+#include <assert.h>
+
 #include "cpu.h"
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+#include "schedstatistics.h"
+#include "vectors_cortexm.h"
+#endif
 
 /**
  * Interrupt vector base address, defined by the linker
  */
 extern const void *_isr_vectors;
 
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+/* initial stack pointer + system exceptions + device interrupts */
+#define RAM_VECTORS_NUMOF   (1 + CPU_NONISR_EXCEPTIONS + CPU_IRQ_NUMOF)
+
+static_assert(RAM_VECTORS_NUMOF <= 256,
+              "vector table too large for the alignment of _ram_vectors");
+
+/* VTOR requires the table to be aligned to its size rounded up to a power of
+ * two */
+static isr_t _ram_vectors[RAM_VECTORS_NUMOF] __attribute__((aligned(1024)));
+
+/* all device interrupts enter here to measure the original handler */
+static void _isr_account(void)
+{
+    unsigned ipsr = __get_IPSR();
+
+    schedstat_isr_enter();
+    ((const isr_t *)&_isr_vectors)[ipsr]();
+    schedstat_isr_exit(ipsr - 1 - CPU_NONISR_EXCEPTIONS);
+}
+
+/* route the device interrupts through _isr_account() */
+static void _init_ram_vectors(void)
+{
+    const isr_t *vectors = (const isr_t *)&_isr_vectors;
+
+    for (unsigned i = 0; i < RAM_VECTORS_NUMOF; i++) {
+        _ram_vectors[i] = (i > CPU_NONISR_EXCEPTIONS) ? _isr_account
+                                                      : vectors[i];
+    }
+    __DSB();
+    SCB->VTOR = (uint32_t)_ram_vectors;
+    __DSB();
+}
+#endif
+
 #if defined(CPU_CORTEXM_INIT_SUBFUNCTIONS)
 #define CORTEXM_STATIC_INLINE /*empty*/
 #else
@@ -30,6 +72,12 @@ extern const void *_isr_vectors;
 
 CORTEXM_STATIC_INLINE void cortexm_init_isr_priorities(void)
 {
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    /* done here rather than in cortexm_init(), so that CPUs calling the
+     * subfunctions directly get it as well */
+    _init_ram_vectors();
+#endif
+
 #if CPU_CORTEXM_PRIORITY_GROUPING != 0
     /* If defined, initialise priority subgrouping, see cpu_conf_common.h */
     NVIC_SetPriorityGrouping(CPU_CORTEXM_PRIORITY_GROUPING);
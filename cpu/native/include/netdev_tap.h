@@ -25,6 +25,7 @@ extern "C" {
 #include <stdbool.h>
 #include "net/netdev.h"
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 
 #include "net/if.h"
@@ -34,6 +35,24 @@ extern "C" {
  * @name Low-level ethernet driver for native tap interfaces
  * @{
  */
+/**
+ * @brief   Number of receive buffers a tap interface can lend with
+ *          `netdev_rx_lend`
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BUF_NUMOF
+#define CONFIG_NETDEV_TAP_RX_BUF_NUMOF  (2)
+#endif
+
+/**
+ * @brief   Receive buffer of a tap interface
+ */
+typedef struct {
+    netdev_rx_buf_t buf;                /**< lendable buffer descriptor */
+    volatile bool lent;                 /**< buffer is lent, released from
+                                             the thread consuming it */
+    uint8_t data[ETHERNET_FRAME_LEN];   /**< the received frame */
+} netdev_tap_rx_buf_t;
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +63,12 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+#if IS_USED(MODULE_NETDEV_RX_LEND) || defined(DOXYGEN)
+    /**
+     * @brief   Buffers to lend received frames in
+     */
+    netdev_tap_rx_buf_t rx_bufs[CONFIG_NETDEV_TAP_RX_BUF_NUMOF];
+#endif
 } netdev_tap_t;
 
 /**
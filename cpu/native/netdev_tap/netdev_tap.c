@@ -61,6 +61,9 @@
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+static int _recv_lend(netdev_t *netdev, netdev_rx_buf_t **buf, void *info);
+#endif
 
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
 {
@@ -178,6 +181,9 @@ static int _confirm_send(netdev_t *netdev, void *info)
 static const netdev_driver_t netdev_driver_tap = {
     .send = _send,
     .recv = _recv,
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+    .recv_lend = _recv_lend,
+#endif
     .init = _init,
     .isr = _isr,
     .get = _get,
@@ -294,6 +300,39 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     return -1;
 }
 
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+static void _rx_buf_release(netdev_rx_buf_t *buf)
+{
+    netdev_tap_rx_buf_t *rx_buf = container_of(buf, netdev_tap_rx_buf_t, buf);
+
+    DEBUG("netdev_tap: rx buffer %p returned\n", (void *)rx_buf);
+    rx_buf->lent = false;
+}
+
+static int _recv_lend(netdev_t *netdev, netdev_rx_buf_t **buf, void *info)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    for (unsigned i = 0; i < CONFIG_NETDEV_TAP_RX_BUF_NUMOF; i++) {
+        netdev_tap_rx_buf_t *rx_buf = &dev->rx_bufs[i];
+
+        if (rx_buf->lent) {
+            continue;
+        }
+        int nread = _recv(netdev, rx_buf->data, sizeof(rx_buf->data), info);
+        if (nread > 0) {
+            rx_buf->lent = true;
+            rx_buf->buf.data = rx_buf->data;
+            rx_buf->buf.release = _rx_buf_release;
+            *buf = &rx_buf->buf;
+        }
+        return nread;
+    }
+    DEBUG("netdev_tap: no rx buffer left to lend\n");
+    return -ENOBUFS;
+}
+#endif
+
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
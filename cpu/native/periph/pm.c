@@ -12,6 +12,7 @@
  */
 
 #include <err.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -35,7 +36,14 @@ unsigned _native_retval = EXIT_SUCCESS;
 static void _native_sleep(void)
 {
     _native_pending_syscalls_up(); /* no switching here */
-    real_pause();
+    if (_native_interrupts_enabled) {
+        real_pause();
+    }
+    else {
+        /* like WFI, wake up with interrupts disabled (as done by pm_layered),
+         * the interrupt stays pending until they are enabled again */
+        sigsuspend(&_native_sig_set);
+    }
     _native_pending_syscalls_down();
 
     if (_native_pending_signals > 0) {
@@ -187,6 +187,15 @@ mtd_dev_t * const mtd_dev_xfa[];
  */
 #define MTD_DRIVER_FLAG_CLEARING_OVERWRITE    (1 << 1)
 
+/**
+ * @brief   MTD driver can read while an erase is in progress
+ *
+ * If this is set, the driver may be called from one thread to read while
+ * another thread erases a different sector, e.g. because the device can
+ * suspend the erase operation. This is used by @ref drivers_mtd_async.
+ */
+#define MTD_DRIVER_FLAG_CONCURRENT_READ    (1 << 2)
+
 /**
  * @brief   MTD driver interface
  *
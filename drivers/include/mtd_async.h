@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD access
+ * @ingroup     drivers_mtd
+ * @brief       Queued, non-blocking access to MTD devices
+ *
+ * All functions of the @ref drivers_mtd API block the caller for the whole
+ * flash operation, which can take many milliseconds for erasing a sector of
+ * a SPI NOR flash. This module lets threads submit read, write and erase
+ * requests instead. The requests are executed by a worker thread and the
+ * submitter is notified by a callback on an @ref event_queue_t of its choice.
+ *
+ * Each device has a request queue that is processed in order, with these
+ * exceptions:
+ *
+ * - Consecutive reads of adjacent memory are merged into a single read of
+ *   the device. If the buffers of the requests are not adjacent as well,
+ *   reads are only merged up to @ref CONFIG_MTD_ASYNC_MERGE_SIZE bytes.
+ * - Reads may overtake a queued or running erase, as long as they do not
+ *   access memory that an earlier write or erase request modifies.
+ *   Without the `mtd_async_suspend` module, erases are executed sector by
+ *   sector and reads are served between the sectors.
+ *   With the `mtd_async_suspend` module, erases of devices with
+ *   @ref MTD_DRIVER_FLAG_CONCURRENT_READ are executed by a second thread, so
+ *   that reads don't have to wait for the erase of a sector to finish.
+ *
+ * ## Usage
+ *
+ * ```
+ * static mtd_async_dev_t dev;
+ * static mtd_async_req_t req;
+ *
+ * static void _read_done(mtd_async_req_t *req)
+ * {
+ *     printf("read: %d\n", req->res);
+ * }
+ *
+ * mtd_async_init(&dev, MTD_0);
+ * mtd_async_req_init(&req, EVENT_PRIO_MEDIUM, _read_done, NULL);
+ * mtd_async_read(&dev, &req, buf, 0, sizeof(buf));
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for asynchronous MTD access
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "mtd.h"
+#include "mutex.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_async_config     Asynchronous MTD compile configuration
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Maximum size of merged reads into non-adjacent buffers
+ *
+ * The worker thread needs a buffer of this size. Set to 0 to only merge
+ * reads into adjacent buffers.
+ */
+#ifndef CONFIG_MTD_ASYNC_MERGE_SIZE
+#define CONFIG_MTD_ASYNC_MERGE_SIZE     (256U)
+#endif
+
+/**
+ * @brief   Priority of the worker thread
+ *
+ * The thread executing erases with the `mtd_async_suspend` module runs at
+ * the next lower priority.
+ */
+#ifndef CONFIG_MTD_ASYNC_PRIO
+#define CONFIG_MTD_ASYNC_PRIO           (THREAD_PRIORITY_MAIN - 2)
+#endif
+/** @} */
+
+/**
+ * @brief   Stack size of the worker threads
+ */
+#ifndef MTD_ASYNC_STACKSIZE
+#define MTD_ASYNC_STACKSIZE             (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Request types
+ */
+typedef enum {
+    MTD_ASYNC_OP_READ,          /**< read, see @ref mtd_read */
+    MTD_ASYNC_OP_WRITE,         /**< write, see @ref mtd_write_page_raw */
+    MTD_ASYNC_OP_ERASE,         /**< erase, see @ref mtd_erase_sector */
+} mtd_async_op_t;
+
+/**
+ * @brief   Asynchronous MTD request
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
+/**
+ * @brief   Completion callback
+ *
+ * @param[in]   req     completed request, @ref mtd_async_req::res holds
+ *                      the result of the operation
+ */
+typedef void (*mtd_async_cb_t)(mtd_async_req_t *req);
+
+/**
+ * @brief   Asynchronous MTD request
+ */
+struct mtd_async_req {
+    event_t event;              /**< completion event */
+    mtd_async_req_t *next;      /**< next request in the device queue */
+    event_queue_t *evq;         /**< queue to run @ref cb on */
+    mtd_async_cb_t cb;          /**< completion callback */
+    void *arg;                  /**< user argument */
+    void *buf;                  /**< data buffer of reads and writes */
+    uint32_t addr;              /**< byte address, or first sector of erases */
+    uint32_t count;             /**< bytes, or number of sectors of erases */
+    uint32_t done;              /**< sectors erased so far */
+    int res;                    /**< result of the operation */
+    mtd_async_op_t op;          /**< type of the request */
+};
+
+/**
+ * @brief   Asynchronous MTD device
+ */
+typedef struct {
+    mtd_dev_t *mtd;             /**< MTD device */
+    mtd_async_req_t *queue;     /**< pending requests, oldest first */
+    mtd_async_req_t *erasing;   /**< erase executed by the erase thread */
+    event_t event;              /**< schedules the device on the worker */
+#if defined(MODULE_MTD_ASYNC_SUSPEND) || defined(DOXYGEN)
+    event_t erase_event;        /**< schedules @ref erasing on the erase thread */
+#endif
+    mutex_t lock;               /**< guards the queue */
+    uint32_t merged;            /**< reads merged into a preceding read */
+    bool interleaved;           /**< a read overtook the current erase */
+} mtd_async_dev_t;
+
+/**
+ * @brief   Initialize an asynchronous MTD device
+ *
+ * Starts the worker thread(s) on first use. @p mtd must already be
+ * initialized with @ref mtd_init.
+ *
+ * @param[out]  dev     device to initialize
+ * @param[in]   mtd     MTD device to access
+ */
+void mtd_async_init(mtd_async_dev_t *dev, mtd_dev_t *mtd);
+
+/**
+ * @brief   Prepare a request for submission
+ *
+ * A request can be submitted again once its callback was called.
+ *
+ * @param[out]  req     request to initialize
+ * @param[in]   evq     event queue to run @p cb on, or NULL to run @p cb
+ *                      directly on the worker thread, also for erases
+ *                      executed by the erase thread of `mtd_async_suspend`
+ * @param[in]   cb      completion callback
+ * @param[in]   arg     user argument, available as @ref mtd_async_req::arg
+ */
+static inline void mtd_async_req_init(mtd_async_req_t *req, event_queue_t *evq,
+                                      mtd_async_cb_t cb, void *arg)
+{
+    req->evq = evq;
+    req->cb = cb;
+    req->arg = arg;
+}
+
+/**
+ * @brief   Submit an asynchronous read
+ *
+ * @param[in]   dev     device to read from
+ * @param[in]   req     initialized request
+ * @param[out]  dest    buffer to fill, must stay valid until completion
+ * @param[in]   addr    start address
+ * @param[in]   count   number of bytes to read
+ *
+ * @retval 0 on success
+ * @retval -EOVERFLOW if @p addr or @p count are outside the device
+ */
+int mtd_async_read(mtd_async_dev_t *dev, mtd_async_req_t *req, void *dest,
+                   uint32_t addr, uint32_t count);
+
+/**
+ * @brief   Submit an asynchronous raw write
+ *
+ * Like @ref mtd_write_page_raw, no read-modify-write cycle is performed.
+ *
+ * @param[in]   dev     device to write to
+ * @param[in]   req     initialized request
+ * @param[in]   src     data to write, must stay valid until completion
+ * @param[in]   addr    start address
+ * @param[in]   count   number of bytes to write
+ *
+ * @retval 0 on success
+ * @retval -EOVERFLOW if @p addr or @p count are outside the device
+ */
+int mtd_async_write(mtd_async_dev_t *dev, mtd_async_req_t *req, const void *src,
+                    uint32_t addr, uint32_t count);
+
+/**
+ * @brief   Submit an asynchronous erase
+ *
+ * @param[in]   dev     device to erase
+ * @param[in]   req     initialized request
+ * @param[in]   sector  first sector to erase
+ * @param[in]   count   number of sectors to erase
+ *
+ * @retval 0 on success
+ * @retval -EOVERFLOW if @p sector or @p count are outside the device
+ */
+int mtd_async_erase_sector(mtd_async_dev_t *dev, mtd_async_req_t *req,
+                           uint32_t sector, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back sector cache
+ * @ingroup     drivers_mtd
+ * @brief       Stacking MTD driver that caches sectors of another MTD in RAM
+ *
+ * Without a cache, every unaligned @ref mtd_write_page on a device that needs
+ * erasing results in a full read-erase-write cycle of the affected sector.
+ * Sequential small writes (logs, file system metadata) therefore erase the
+ * same sector over and over again.
+ *
+ * This module presents a parent MTD device as a new MTD device that keeps up
+ * to @ref CONFIG_MTD_CACHE_SECTORS sectors in RAM. Writes are merged into the
+ * cached copy of a sector and only written back to the parent device (with a
+ * single erase) when
+ *
+ * - the sector is evicted to make room for another one (least recently used
+ *   first),
+ * - @ref mtd_cache_flush is called, or
+ * - the device is powered down with @ref mtd_power.
+ *
+ * Reads are served from the cache where possible.
+ *
+ * @warning Data written to the cache is lost on reset or power loss unless
+ *          it was flushed before. Call @ref mtd_cache_flush at points where
+ *          the data has to be persistent.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * A cache for an existing MTD device is defined like this:
+ *
+ * ```
+ * static mtd_cache_t cache = {
+ *     .mtd.driver = &mtd_cache_driver,
+ *     .parent = MTD_0,
+ * };
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry of the cache device is inherited from the parent in
+ * @ref mtd_init. The sector buffers are allocated from the heap on
+ * initialization unless @ref mtd_cache_t::buf already points to a buffer
+ * of @ref CONFIG_MTD_CACHE_SECTORS sectors.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD write-back sector cache
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_cache_config     MTD sector cache compile configuration
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Number of sectors kept in RAM by each cache
+ *
+ * Each cached sector requires a sector sized buffer of the parent device.
+ */
+#ifndef CONFIG_MTD_CACHE_SECTORS
+#define CONFIG_MTD_CACHE_SECTORS    (2U)
+#endif
+/** @} */
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< accesses served from a cached sector */
+    uint32_t misses;        /**< accesses that went to the parent device */
+    uint32_t erases;        /**< sectors erased on the parent device */
+    uint32_t erases_saved;  /**< erases avoided by coalescing writes */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   State of a single cached sector
+ */
+typedef struct {
+    uint32_t sector;        /**< sector number on the parent device */
+    uint32_t used;          /**< time of last access, for LRU eviction */
+    bool valid;             /**< buffer holds a copy of @ref sector */
+    bool dirty;             /**< buffer differs from the parent device */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD sector cache device
+ */
+typedef struct {
+    mtd_dev_t mtd;                                      /**< MTD context */
+    mtd_dev_t *parent;                                  /**< cached MTD device */
+    uint8_t *buf;                                       /**< sector buffers */
+    mtd_cache_line_t lines[CONFIG_MTD_CACHE_SECTORS];   /**< cached sectors */
+    mutex_t lock;                                       /**< guards the cache */
+    uint32_t clock;                                     /**< LRU access counter */
+    mtd_cache_stats_t stats;                            /**< cache statistics */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Write all dirty sectors back to the parent device
+ *
+ * The sectors stay cached for subsequent reads.
+ *
+ * @param[in]   cache   cache to flush
+ *
+ * @retval 0 on success
+ * @retval <0 error of the parent device
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+/**
+ * @brief   Get the statistics of a cache
+ *
+ * @param[in]   cache   cache to query
+ * @param[out]  stats   statistics of the cache
+ */
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
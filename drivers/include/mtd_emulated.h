@@ -82,6 +82,19 @@ extern "C" {
 
 #endif /* MODULE_VFS || DOXYGEN */
 
+/**
+ * @brief   Emulated access times
+ *
+ * With the `mtd_emulated_latency` module, each operation blocks the calling
+ * thread like a real flash device would. The default of 0 disables the
+ * emulation for an operation.
+ */
+typedef struct {
+    uint32_t read_us;   /**< time to read a page in microseconds */
+    uint32_t write_us;  /**< time to write a page in microseconds */
+    uint32_t erase_us;  /**< time to erase a sector in microseconds */
+} mtd_emulated_latency_t;
+
 /**
  * @brief   Device descriptor for a MTD device that is emulated in RAM
  */
@@ -90,6 +103,9 @@ typedef struct {
     size_t size;        /**< total size of the MTD device in bytes */
     uint8_t *memory;    /**< RAM that is used for the emulated MTD device */
     bool init_done;     /**< indicates whether initialization is already done */
+#if defined(MODULE_MTD_EMULATED_LATENCY) || defined(DOXYGEN)
+    mtd_emulated_latency_t latency; /**< emulated access times */
+#endif
 } mtd_emulated_t;
 
 /**
@@ -97,6 +97,14 @@
  * This receive sequence can of course be simplified by skipping steps 2 and 3
  * when using fixed sized pre-allocated buffers or similar means. *
  *
+ * With the pseudomodule `netdev_rx_lend`, drivers that receive into buffers
+ * of their own (e.g. DMA descriptors) may additionally implement
+ * @ref netdev_driver_t::recv_lend "recv_lend()". Instead of copying the frame,
+ * it lends the receive buffer to the caller as a @ref netdev_rx_buf_t. The
+ * caller hands the buffer back with netdev_rx_buf_release() once it is done
+ * with the frame, which may be from a different thread and long after the
+ * next frame was received.
+ *
  * @note    The @ref netdev_driver_t::send "send()" and
  *          @ref netdev_driver_t::recv "recv()" functions **must** never be
  *          called from interrupt context.
@@ -415,6 +423,36 @@ static inline void netdev_register(struct netdev *dev, netdev_type_t type, uint8
     }
 }
 
+/**
+ * @brief   Receive buffer lent to the upper layer
+ *
+ * @see     netdev_driver_t::recv_lend
+ */
+typedef struct netdev_rx_buf netdev_rx_buf_t;
+
+/**
+ * @brief   Receive buffer lent to the upper layer
+ */
+struct netdev_rx_buf {
+    void *data;                             /**< start of the received frame */
+    /**
+     * @brief   Hands the buffer back to the driver
+     *
+     * May be called from any thread, but not from interrupt context.
+     */
+    void (*release)(netdev_rx_buf_t *buf);
+};
+
+/**
+ * @brief   Hands a lent receive buffer back to its driver
+ *
+ * @param[in] buf   buffer obtained with netdev_driver_t::recv_lend
+ */
+static inline void netdev_rx_buf_release(netdev_rx_buf_t *buf)
+{
+    buf->release(buf);
+}
+
 /**
  * @brief Structure to hold driver interface -> function mapping
  *
@@ -528,6 +566,35 @@ typedef struct netdev_driver {
      */
     int (*recv)(netdev_t *dev, void *buf, size_t len, void *info);
 
+#if IS_USED(MODULE_NETDEV_RX_LEND) || defined(DOXYGEN)
+    /**
+     * @brief   Get a received frame without copying it
+     *
+     * @pre     `(dev != NULL) && (buf != NULL)`
+     *
+     * Optional, may be `NULL`. Supposed to be called instead of
+     * @ref netdev_driver_t::recv "recv()" from
+     * @ref netdev_t::event_callback "netdev->event_callback()".
+     *
+     * On success the received frame is at netdev_rx_buf_t::data of @p buf and
+     * the buffer belongs to the caller until it is handed back using
+     * netdev_rx_buf_release(). If the driver has no buffer left to lend, the
+     * frame is kept and can still be fetched using
+     * @ref netdev_driver_t::recv "recv()".
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[out]  buf     the lent buffer
+     * @param[out]  info    status information for the received frame, as for
+     *                      @ref netdev_driver_t::recv "recv()"
+     *
+     * @return  size of the received frame
+     * @retval  0           the frame was dropped, nothing was lent
+     * @retval  -ENOBUFS    no buffer left to lend, frame was not read
+     * @retval  <0          other error, nothing was lent
+     */
+    int (*recv_lend)(netdev_t *dev, netdev_rx_buf_t **buf, void *info);
+#endif
+
     /**
      * @brief   the driver's initialization function
      *
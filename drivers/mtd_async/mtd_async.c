@@ -0,0 +1,389 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD access
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "container.h"
+#include "event.h"
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static event_queue_t _evq;
+static char _stack[MTD_ASYNC_STACKSIZE];
+static mutex_t _init_lock = MUTEX_INIT;
+static bool _init_done;
+
+#if CONFIG_MTD_ASYNC_MERGE_SIZE
+/* only used by the worker thread */
+static uint8_t _merge_buf[CONFIG_MTD_ASYNC_MERGE_SIZE];
+#endif
+
+#if IS_USED(MODULE_MTD_ASYNC_SUSPEND)
+static event_queue_t _erase_evq;
+static char _erase_stack[MTD_ASYNC_STACKSIZE];
+#endif
+
+static uint64_t _sector_size(const mtd_dev_t *mtd)
+{
+    return (uint64_t)mtd->pages_per_sector * mtd->page_size;
+}
+
+/* Returns the byte range [start, end) touched by @p req */
+static void _range(const mtd_async_dev_t *dev, const mtd_async_req_t *req,
+                   uint64_t *start, uint64_t *end)
+{
+    if (req->op == MTD_ASYNC_OP_ERASE) {
+        *start = req->addr * _sector_size(dev->mtd);
+        *end = (req->addr + (uint64_t)req->count) * _sector_size(dev->mtd);
+    }
+    else {
+        *start = req->addr;
+        *end = req->addr + (uint64_t)req->count;
+    }
+}
+
+static bool _overlaps(const mtd_async_dev_t *dev, const mtd_async_req_t *a,
+                      const mtd_async_req_t *b)
+{
+    uint64_t a_start, a_end, b_start, b_end;
+
+    _range(dev, a, &a_start, &a_end);
+    _range(dev, b, &b_start, &b_end);
+    return (a_start < b_end) && (b_start < a_end);
+}
+
+/* A read must not overtake modifications of the memory it reads */
+static bool _read_blocked(const mtd_async_dev_t *dev, const mtd_async_req_t *read)
+{
+    if (dev->erasing && _overlaps(dev, dev->erasing, read)) {
+        return true;
+    }
+    for (const mtd_async_req_t *req = dev->queue; req != read; req = req->next) {
+        if ((req->op != MTD_ASYNC_OP_READ) && _overlaps(dev, req, read)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Returns the request to execute next, must be called with the lock held */
+static mtd_async_req_t *_next(mtd_async_dev_t *dev)
+{
+    mtd_async_req_t *head = dev->queue;
+
+    if (head == NULL) {
+        return NULL;
+    }
+    if (head->op == MTD_ASYNC_OP_READ) {
+        if (!_read_blocked(dev, head)) {
+            return head;
+        }
+    }
+    /* erase steps alternate with reads that overtake the erase */
+    else if ((dev->erasing == NULL) &&
+             ((head->op == MTD_ASYNC_OP_WRITE) || dev->interleaved)) {
+        return head;
+    }
+
+    /* the head has to wait, look for a read that may overtake it */
+    for (mtd_async_req_t *req = head->next; req; req = req->next) {
+        if ((req->op == MTD_ASYNC_OP_READ) && !_read_blocked(dev, req)) {
+            dev->interleaved = true;
+            return req;
+        }
+    }
+    return ((head->op != MTD_ASYNC_OP_READ) && (dev->erasing == NULL)) ? head : NULL;
+}
+
+/* Removes the consecutive requests @p first to @p last from the queue */
+static void _unlink(mtd_async_dev_t *dev, mtd_async_req_t *first, mtd_async_req_t *last)
+{
+    mtd_async_req_t **pos = &dev->queue;
+
+    while (*pos != first) {
+        pos = &(*pos)->next;
+    }
+    *pos = last->next;
+}
+
+static void _complete_handler(event_t *ev)
+{
+    mtd_async_req_t *req = container_of(ev, mtd_async_req_t, event);
+
+    req->cb(req);
+}
+
+static void _complete(mtd_async_req_t *req, int res)
+{
+    req->res = res;
+    if (req->evq) {
+        event_post(req->evq, &req->event);
+    }
+    else {
+        req->cb(req);
+    }
+}
+
+/* Completes the consecutive requests @p first to @p last */
+static void _complete_all(mtd_async_dev_t *dev, mtd_async_req_t *first,
+                          mtd_async_req_t *last, int res)
+{
+    mutex_lock(&dev->lock);
+    _unlink(dev, first, last);
+    mutex_unlock(&dev->lock);
+
+    for (mtd_async_req_t *req = first, *next; req; req = next) {
+        /* the callback may submit the request again */
+        next = (req == last) ? NULL : req->next;
+        _complete(req, res);
+    }
+}
+
+/* Executes @p req and all following reads it can be merged with,
+ * must be called with the lock held */
+static void _read(mtd_async_dev_t *dev, mtd_async_req_t *req)
+{
+    mtd_async_req_t *last = req;
+    uint32_t count = req->count;
+    bool direct = true;
+
+    for (mtd_async_req_t *next = req->next;
+         next && (next->op == MTD_ASYNC_OP_READ) && (next->addr == req->addr + count);
+         next = next->next) {
+        bool adjacent = direct && (next->buf == (uint8_t *)req->buf + count);
+
+        if (_read_blocked(dev, next) ||
+            (!adjacent && ((uint64_t)count + next->count > CONFIG_MTD_ASYNC_MERGE_SIZE))) {
+            break;
+        }
+        direct = adjacent;
+        count += next->count;
+        last = next;
+        dev->merged++;
+    }
+    mutex_unlock(&dev->lock);
+
+    int res;
+
+#if CONFIG_MTD_ASYNC_MERGE_SIZE
+    if (!direct) {
+        res = mtd_read(dev->mtd, _merge_buf, req->addr, count);
+        for (mtd_async_req_t *r = req; res == 0; r = r->next) {
+            memcpy(r->buf, &_merge_buf[r->addr - req->addr], r->count);
+            if (r == last) {
+                break;
+            }
+        }
+    }
+    else
+#endif
+    {
+        res = mtd_read(dev->mtd, req->buf, req->addr, count);
+    }
+
+    DEBUG("mtd_async: read %" PRIu32 " bytes at %" PRIu32 ": %d\n", count, req->addr, res);
+    _complete_all(dev, req, last, res);
+}
+
+/* Executes @p req, must be called with the lock held */
+static void _write(mtd_async_dev_t *dev, mtd_async_req_t *req)
+{
+    mutex_unlock(&dev->lock);
+
+    int res = mtd_write_page_raw(dev->mtd, req->buf, req->addr / dev->mtd->page_size,
+                                 req->addr % dev->mtd->page_size, req->count);
+
+    _complete_all(dev, req, req, res);
+}
+
+#if IS_USED(MODULE_MTD_ASYNC_SUSPEND)
+static void _erase_handler(event_t *ev)
+{
+    mtd_async_dev_t *dev = container_of(ev, mtd_async_dev_t, erase_event);
+    mtd_async_req_t *req = dev->erasing;
+
+    int res = mtd_erase_sector(dev->mtd, req->addr, req->count);
+
+    mutex_lock(&dev->lock);
+    dev->erasing = NULL;
+    mutex_unlock(&dev->lock);
+
+    /* callbacks without a queue run on the worker thread, not this one */
+    req->res = res;
+    event_post(req->evq ? req->evq : &_evq, &req->event);
+
+    /* requests may have waited for the erase */
+    event_post(&_evq, &dev->event);
+}
+#endif
+
+/* Executes @p req or a part of it, must be called with the lock held */
+static void _erase(mtd_async_dev_t *dev, mtd_async_req_t *req)
+{
+    dev->interleaved = false;
+#if IS_USED(MODULE_MTD_ASYNC_SUSPEND)
+    if (dev->mtd->driver->flags & MTD_DRIVER_FLAG_CONCURRENT_READ) {
+        /* the erase thread takes over, reads continue on this thread */
+        _unlink(dev, req, req);
+        dev->erasing = req;
+        mutex_unlock(&dev->lock);
+        event_post(&_erase_evq, &dev->erase_event);
+        return;
+    }
+#endif
+    mutex_unlock(&dev->lock);
+
+    int res = mtd_erase_sector(dev->mtd, req->addr + req->done, 1);
+
+    if ((res < 0) || (++req->done == req->count)) {
+        _complete_all(dev, req, req, res);
+    }
+}
+
+static void _service(event_t *ev)
+{
+    mtd_async_dev_t *dev = container_of(ev, mtd_async_dev_t, event);
+
+    mutex_lock(&dev->lock);
+    mtd_async_req_t *req = _next(dev);
+
+    if (req == NULL) {
+        /* done, or waiting for the erase thread */
+        mutex_unlock(&dev->lock);
+        return;
+    }
+
+    switch (req->op) {
+    case MTD_ASYNC_OP_READ:
+        _read(dev, req);
+        break;
+    case MTD_ASYNC_OP_WRITE:
+        _write(dev, req);
+        break;
+    case MTD_ASYNC_OP_ERASE:
+        _erase(dev, req);
+        break;
+    }
+
+    /* one request at a time, so that devices take turns */
+    event_post(&_evq, &dev->event);
+}
+
+static void *_worker(void *arg)
+{
+    event_queue_t *evq = arg;
+
+    event_queue_claim(evq);
+    event_loop(evq);
+    return NULL;
+}
+
+void mtd_async_init(mtd_async_dev_t *dev, mtd_dev_t *mtd)
+{
+    memset(dev, 0, sizeof(*dev));
+    dev->mtd = mtd;
+    dev->event.handler = _service;
+    mutex_init(&dev->lock);
+#if IS_USED(MODULE_MTD_ASYNC_SUSPEND)
+    dev->erase_event.handler = _erase_handler;
+#endif
+
+    mutex_lock(&_init_lock);
+    if (!_init_done) {
+        _init_done = true;
+        event_queue_init_detached(&_evq);
+        thread_create(_stack, sizeof(_stack), CONFIG_MTD_ASYNC_PRIO, 0,
+                      _worker, &_evq, "mtd_async");
+#if IS_USED(MODULE_MTD_ASYNC_SUSPEND)
+        event_queue_init_detached(&_erase_evq);
+        thread_create(_erase_stack, sizeof(_erase_stack), CONFIG_MTD_ASYNC_PRIO + 1, 0,
+                      _worker, &_erase_evq, "mtd_async_erase");
+#endif
+    }
+    mutex_unlock(&_init_lock);
+}
+
+static int _submit(mtd_async_dev_t *dev, mtd_async_req_t *req)
+{
+    assert(req->cb);
+
+    req->event.handler = _complete_handler;
+    req->next = NULL;
+    req->done = 0;
+
+    mutex_lock(&dev->lock);
+    mtd_async_req_t **pos = &dev->queue;
+    while (*pos) {
+        assert(*pos != req);
+        pos = &(*pos)->next;
+    }
+    *pos = req;
+    mutex_unlock(&dev->lock);
+
+    event_post(&_evq, &dev->event);
+    return 0;
+}
+
+static int _submit_io(mtd_async_dev_t *dev, mtd_async_req_t *req, mtd_async_op_t op,
+                      void *buf, uint32_t addr, uint32_t count)
+{
+    const mtd_dev_t *mtd = dev->mtd;
+
+    if ((uint64_t)addr + count > mtd->sector_count * _sector_size(mtd)) {
+        return -EOVERFLOW;
+    }
+
+    req->op = op;
+    req->buf = buf;
+    req->addr = addr;
+    req->count = count;
+    return _submit(dev, req);
+}
+
+int mtd_async_read(mtd_async_dev_t *dev, mtd_async_req_t *req, void *dest,
+                   uint32_t addr, uint32_t count)
+{
+    return _submit_io(dev, req, MTD_ASYNC_OP_READ, dest, addr, count);
+}
+
+int mtd_async_write(mtd_async_dev_t *dev, mtd_async_req_t *req, const void *src,
+                    uint32_t addr, uint32_t count)
+{
+    return _submit_io(dev, req, MTD_ASYNC_OP_WRITE, (void *)src, addr, count);
+}
+
+int mtd_async_erase_sector(mtd_async_dev_t *dev, mtd_async_req_t *req,
+                           uint32_t sector, uint32_t count)
+{
+    if ((count == 0) || ((uint64_t)sector + count > dev->mtd->sector_count)) {
+        return -EOVERFLOW;
+    }
+
+    req->op = MTD_ASYNC_OP_ERASE;
+    req->buf = NULL;
+    req->addr = sector;
+    req->count = count;
+    return _submit(dev, req);
+}
@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back sector cache for MTD devices
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "container.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint32_t _sector_size(const mtd_cache_t *cache)
+{
+    return cache->mtd.pages_per_sector * cache->mtd.page_size;
+}
+
+static uint8_t *_line_buf(const mtd_cache_t *cache, const mtd_cache_line_t *line)
+{
+    return cache->buf + (line - cache->lines) * _sector_size(cache);
+}
+
+static bool _parent_needs_erase(const mtd_cache_t *cache)
+{
+    return !(cache->parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE);
+}
+
+static mtd_cache_line_t *_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        if (cache->lines[i].valid && cache->lines[i].sector == sector) {
+            return &cache->lines[i];
+        }
+    }
+    return NULL;
+}
+
+static int _flush_line(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (!line->valid || !line->dirty) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back sector %" PRIu32 "\n", line->sector);
+
+    /* erases the sector first if the parent needs it */
+    int res = mtd_write_sector(cache->parent, _line_buf(cache, line), line->sector, 1);
+    if (res < 0) {
+        return res;
+    }
+    if (_parent_needs_erase(cache)) {
+        cache->stats.erases++;
+    }
+    line->dirty = false;
+    return 0;
+}
+
+/* Returns the line caching @p sector, evicting the least recently used one
+ * if it is not cached yet. The sector is only read from the parent device
+ * when @p load is set. */
+static int _get_line(mtd_cache_t *cache, uint32_t sector, bool load,
+                     mtd_cache_line_t **out)
+{
+    mtd_cache_line_t *line = _find(cache, sector);
+
+    if (line) {
+        cache->stats.hits++;
+        goto out;
+    }
+
+    /* prefer a free line, otherwise the least recently used one */
+    line = &cache->lines[0];
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines) && line->valid; i++) {
+        if (!cache->lines[i].valid || cache->lines[i].used < line->used) {
+            line = &cache->lines[i];
+        }
+    }
+
+    int res = _flush_line(cache, line);
+    if (res < 0) {
+        return res;
+    }
+
+    cache->stats.misses++;
+    line->valid = false;
+    if (load) {
+        res = mtd_read_page(cache->parent, _line_buf(cache, line),
+                            sector * cache->mtd.pages_per_sector, 0, _sector_size(cache));
+        if (res < 0) {
+            return res;
+        }
+    }
+    line->sector = sector;
+    line->valid = true;
+    line->dirty = false;
+
+out:
+    line->used = ++cache->clock;
+    *out = line;
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    assert(parent);
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties, sectors are always written back as a whole */
+    cache->mtd.sector_count = parent->sector_count;
+    cache->mtd.pages_per_sector = parent->pages_per_sector;
+    cache->mtd.page_size = parent->page_size;
+    cache->mtd.write_size = 1;
+
+    if (cache->buf == NULL) {
+        cache->buf = malloc(ARRAY_SIZE(cache->lines) * _sector_size(cache));
+        if (cache->buf == NULL) {
+            return -ENOMEM;
+        }
+    }
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    const uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size
+                                 + offset;
+    int res;
+
+    /* stay within one sector, mtd_read_page() calls again for the rest */
+    count = MIN(count, _sector_size(cache) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    mtd_cache_line_t *line = _find(cache, sector);
+    if (line) {
+        /* reads don't count as use, so streaming reads don't evict sectors
+         * that are written to */
+        memcpy(dest, _line_buf(cache, line) + sector_offset, count);
+        cache->stats.hits++;
+        res = 0;
+    }
+    else {
+        res = mtd_read_page(cache->parent, dest, page, offset, count);
+        cache->stats.misses++;
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    const uint32_t sector_offset = (page % mtd->pages_per_sector) * mtd->page_size
+                                 + offset;
+    mtd_cache_line_t *line;
+
+    count = MIN(count, _sector_size(cache) - sector_offset);
+
+    mutex_lock(&cache->lock);
+    /* no need to read the sector if it gets overwritten completely */
+    int res = _get_line(cache, sector, count != _sector_size(cache), &line);
+    if (res == 0) {
+        if (line->dirty && _parent_needs_erase(cache)) {
+            /* the pending write back covers this write as well */
+            cache->stats.erases_saved++;
+        }
+        memcpy(_line_buf(cache, line) + sector_offset, src, count);
+        line->dirty = true;
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    mutex_lock(&cache->lock);
+    /* pending writes to erased sectors never have to reach the parent */
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->valid && line->sector >= sector && line->sector - sector < count) {
+            if (line->dirty && _parent_needs_erase(cache)) {
+                cache->stats.erases_saved++;
+            }
+            line->valid = false;
+        }
+    }
+    int res = mtd_erase_sector(cache->parent, sector, count);
+    if (res == 0) {
+        cache->stats.erases += count;
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = mtd_cache_flush(cache);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return mtd_power(cache->parent, power);
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines) && res == 0; i++) {
+        res = _flush_line(cache, &cache->lines[i]);
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats)
+{
+    mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    mutex_unlock(&cache->lock);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    /* writes are merged into the cached sector, which is erased on write back */
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
@@ -7,9 +7,31 @@
 #include <string.h>
 
 #include "assert.h"
+#include "kernel_defines.h"
 #include "macros/utils.h"
 #include "mtd_emulated.h"
 
+#if IS_USED(MODULE_MTD_EMULATED_LATENCY)
+#include "ztimer.h"
+
+/* Blocks for @p us per page touched by an access of @p count bytes at @p addr */
+static void _page_delay(const mtd_emulated_t *mtd, uint32_t us, uint32_t addr, uint32_t count)
+{
+    const uint32_t page_size = mtd->base.page_size;
+
+    if (us && count) {
+        ztimer_sleep(ZTIMER_USEC, us * ((addr + count - 1) / page_size - addr / page_size + 1));
+    }
+}
+
+static void _sector_delay(const mtd_emulated_t *mtd, uint32_t num)
+{
+    if (mtd->latency.erase_us) {
+        ztimer_sleep(ZTIMER_USEC, mtd->latency.erase_us * num);
+    }
+}
+#endif
+
 static int _init(mtd_dev_t *dev)
 {
     mtd_emulated_t *mtd = (mtd_emulated_t *)dev;
@@ -41,6 +63,9 @@ static int _read(mtd_dev_t *dev, void *dest, uint32_t addr, uint32_t count)
         /* addr + count must not exceed the size of memory */
         return -EOVERFLOW;
     }
+#if IS_USED(MODULE_MTD_EMULATED_LATENCY)
+    _page_delay(mtd, mtd->latency.read_us, addr, count);
+#endif
     memcpy(dest, mtd->memory + addr, count);
 
     return 0;
@@ -81,6 +106,9 @@ static int _read_page(mtd_dev_t *dev, void *dest,
         /* page addr + offset + size must not exceed the size of memory */
         return -EOVERFLOW;
     }
+#if IS_USED(MODULE_MTD_EMULATED_LATENCY)
+    _page_delay(mtd, mtd->latency.read_us, page_addr + offset, size);
+#endif
     memcpy(dest, mtd->memory + page_addr + offset, size);
 
     return size;
@@ -126,6 +154,9 @@ int _write_page(mtd_dev_t *dev, const void *src,
         /* page addr + offset + size must not exceed the size of memory */
         return -EOVERFLOW;
     }
+#if IS_USED(MODULE_MTD_EMULATED_LATENCY)
+    _page_delay(mtd, mtd->latency.write_us, page_addr + offset, size);
+#endif
     memcpy(mtd->memory + page_addr + offset, src, size);
 
     return size;
@@ -160,6 +191,9 @@ static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t count)
         return -EOVERFLOW;
     }
 
+#if IS_USED(MODULE_MTD_EMULATED_LATENCY)
+    _sector_delay(mtd, count / (mtd->base.pages_per_sector * mtd->base.page_size));
+#endif
     memset(mtd->memory + addr, 0xff, count);
 
     return 0;
@@ -189,6 +223,9 @@ static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t num)
         return -EOVERFLOW;
     }
 
+#if IS_USED(MODULE_MTD_EMULATED_LATENCY)
+    _sector_delay(mtd, num);
+#endif
     memset(mtd->memory + (sector * (mtd->base.pages_per_sector * mtd->base.page_size)),
            0xff, num * (mtd->base.pages_per_sector * mtd->base.page_size));
 
@@ -210,4 +247,6 @@ const mtd_desc_t _mtd_emulated_driver = {
     .erase = _erase,
     .erase_sector = _erase_sector,
     .power = _power,
+    /* erasing and reading different sectors of the memory is thread safe */
+    .flags = MTD_DRIVER_FLAG_CONCURRENT_READ,
 };
@@ -126,6 +126,11 @@ PSEUDOMODULES += evtimer_mbox
 
 PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fdcan
+## @addtogroup net_fib_trie
+## @{
+## Enable the longest-prefix-match trie index for @ref net_fib tables
+PSEUDOMODULES += fib_trie
+## @}
 PSEUDOMODULES += fido2_tests
 PSEUDOMODULES += fmt_%
 PSEUDOMODULES += fortuna_reseed
@@ -134,6 +139,9 @@ PSEUDOMODULES += gcoap_forward_proxy
 PSEUDOMODULES += gcoap_forward_proxy_thread
 PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_dtls
+PSEUDOMODULES += gcoap_dispatch_trie
+PSEUDOMODULES += gcoap_memo_index
+PSEUDOMODULES += gcoap_obs_fanout
 ## @addtogroup net_gcoap_dns
 ## @{
 ## Enable @ref net_gcoap_dns
@@ -253,11 +261,14 @@ PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
 PSEUDOMODULES += gnrc_sixlowpan_frag_hint
+PSEUDOMODULES += gnrc_sixlowpan_frag_rb_bitmap
+PSEUDOMODULES += gnrc_sixlowpan_frag_rb_index
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_in
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_out
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_fqueue
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_stats
+PSEUDOMODULES += gnrc_sixlowpan_frag_vrb_fast
 ##
 ## @addtogroup net_gnrc_sixlowpan_frag_sfr_congure
 ## @{
@@ -292,11 +303,13 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_quic
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_sfr
 ## @}
 ## @}
+PSEUDOMODULES += gnrc_sixlowpan_iphc_flow_cache
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+PSEUDOMODULES += gnrc_tcp_recv_buf
 PSEUDOMODULES += gnrc_txtsnd
 
 PSEUDOMODULES += ieee802154_security
@@ -340,6 +353,21 @@ PSEUDOMODULES += mpu_stack_guard
 PSEUDOMODULES += mpu_noexec_ram
 ## @}
 
+## @defgroup pseudomodule_mtd_async_suspend mtd_async_suspend
+## @{
+## @brief Execute MTD erases on a separate thread
+##
+## Reads submitted to @ref drivers_mtd_async are served while an erase is in
+## progress on devices with @ref MTD_DRIVER_FLAG_CONCURRENT_READ.
+PSEUDOMODULES += mtd_async_suspend
+## @}
+
+## @defgroup pseudomodule_mtd_emulated_latency mtd_emulated_latency
+## @{
+## @brief Emulate flash access times with @ref drivers_mtd_emulated
+PSEUDOMODULES += mtd_emulated_latency
+## @}
+
 PSEUDOMODULES += mtd_write_page
 
 PSEUDOMODULES += nanocoap_%
@@ -356,6 +384,7 @@ PSEUDOMODULES += netdev_layer
 PSEUDOMODULES += netdev_legacy_api
 PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
+PSEUDOMODULES += netdev_rx_lend
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
 PSEUDOMODULES += netstats_neighbor_etx
@@ -396,6 +425,7 @@ PSEUDOMODULES += picolibc_stdout_buffered
 PSEUDOMODULES += pio_autostart_%
 
 PSEUDOMODULES += pktqueue
+PSEUDOMODULES += pm_layered_tickless
 
 ## @defgroup pseudomodule_pmp_noexec_ram pmp_noexec_ram
 ## @{
@@ -446,6 +476,7 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += schedstatistics_cycles
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -564,6 +595,7 @@ PSEUDOMODULES += sock_dtls_verify_public_key
 PSEUDOMODULES += sock_ip
 PSEUDOMODULES += sock_tcp
 PSEUDOMODULES += sock_udp
+PSEUDOMODULES += sock_udp_zero_copy
 PSEUDOMODULES += socket_zep_hello
 PSEUDOMODULES += soft_uart_modecfg
 PSEUDOMODULES += stdin
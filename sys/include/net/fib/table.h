@@ -20,10 +20,15 @@
 
 #include <stdint.h>
 
+#include "modules.h"
 #include "sched.h"
 #include "universal_address.h"
 #include "mutex.h"
 
+#if IS_USED(MODULE_FIB_TRIE)
+#include "net/fib/trie.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -132,6 +137,10 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if IS_USED(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** longest-prefix-match index for single hop tables, see @ref net_fib_trie */
+    fib_trie_t trie;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_fib_trie FIB longest-prefix-match trie
+ * @ingroup     net_fib
+ * @brief       Compressed binary trie (Patricia trie) index for FIB tables
+ *
+ * When the pseudomodule `fib_trie` is used and a node pool is attached to a
+ * single hop FIB table (see @ref fib_trie_t::nodes), all lookups are done by
+ * walking a path compressed binary trie over the destination prefixes instead
+ * of scanning all entries of the table. A lookup then costs O(prefix length)
+ * independent of the number of routes.
+ *
+ * The trie uses one node per table entry plus at most one branching node per
+ * entry, so the pool has to provide @ref FIB_TRIE_NODES_NUMOF nodes:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static fib_entry_t _entries[TABLE_SIZE];
+ * static fib_trie_node_t _nodes[FIB_TRIE_NODES_NUMOF(TABLE_SIZE)];
+ * static fib_table_t _table = { .data.entries = _entries,
+ *                               .table_type = FIB_TABLE_TYPE_SH,
+ *                               .size = TABLE_SIZE,
+ *                               .trie.nodes = _nodes };
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Tables without a node pool keep using the linear scan.
+ *
+ * With the trie, entry lifetimes are no longer checked on every lookup. A
+ * timer is armed for the earliest lifetime instead, and expired entries are
+ * swept on the next access to the table after it fired.
+ *
+ * @{
+ *
+ * @file
+ * @brief       FIB longest-prefix-match trie definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "universal_address.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Marker for "no node"
+ */
+#define FIB_TRIE_NIL                (UINT16_MAX)
+
+/**
+ * @brief   Number of trie nodes needed for a FIB table of @p size entries
+ */
+#define FIB_TRIE_NODES_NUMOF(size)  (2 * (size))
+
+/**
+ * @brief   A node of the FIB trie
+ *
+ * Nodes with an index below the table size belong to the table entry with the
+ * same index, the remaining nodes are used for branching.
+ */
+typedef struct {
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE];    /**< address of the entry */
+    uint16_t parent;                        /**< parent node */
+    uint16_t child[2];                      /**< children, by next key bit */
+    /**
+     * @brief   next entry node with the same prefix, or next free branching
+     *          node
+     */
+    uint16_t next;
+    uint8_t size;                           /**< address size in bytes */
+    uint8_t len;                            /**< prefix length in bits */
+    bool in_tree;                           /**< node is linked into the trie */
+} fib_trie_node_t;
+
+/**
+ * @brief   Trie index of a FIB table
+ */
+typedef struct {
+    /**
+     * @brief   Node pool of @ref FIB_TRIE_NODES_NUMOF entries, or NULL to use
+     *          the linear scan for this table
+     */
+    fib_trie_node_t *nodes;
+    uint16_t size;                  /**< number of entry nodes */
+    uint16_t root;                  /**< root node of the trie */
+    uint16_t free;                  /**< first unused branching node */
+    volatile bool sweep_pending;    /**< lifetime sweep is due */
+    uint64_t next_expiry;           /**< time the sweep timer is armed for */
+    xtimer_t sweep_timer;           /**< timer for the lifetime sweep */
+} fib_trie_t;
+
+/**
+ * @brief   Resets the trie to an empty state
+ *
+ * @param[in,out] trie      the trie, fib_trie_t::nodes must be set
+ * @param[in] size          number of entries of the FIB table
+ */
+void fib_trie_init(fib_trie_t *trie, size_t size);
+
+/**
+ * @brief   Links the node of an entry into the trie
+ *
+ * @pre @p idx is not linked into the trie
+ *
+ * @param[in,out] trie      the trie
+ * @param[in] idx           index of the FIB entry
+ * @param[in] addr          destination address of the entry
+ * @param[in] addr_size     size of @p addr in bytes
+ * @param[in] prefix_len    number of significant bits of @p addr
+ */
+void fib_trie_insert(fib_trie_t *trie, unsigned idx, const uint8_t *addr,
+                     size_t addr_size, unsigned prefix_len);
+
+/**
+ * @brief   Unlinks the node of an entry from the trie
+ *
+ * @pre @p idx was linked into the trie using fib_trie_insert()
+ *
+ * @param[in,out] trie      the trie
+ * @param[in] idx           index of the FIB entry
+ */
+void fib_trie_remove(fib_trie_t *trie, unsigned idx);
+
+/**
+ * @brief   Looks up the entry for a destination
+ *
+ * An entry with an address equal to @p dst is preferred, otherwise the entry
+ * with the longest matching prefix is returned.
+ *
+ * @param[in] trie          the trie
+ * @param[in] dst           the destination address
+ * @param[in] dst_size      size of @p dst in bytes
+ * @param[out] idx          index of the found FIB entry
+ *
+ * @return  1 if an entry with address @p dst was found
+ * @return  0 if a matching prefix was found
+ * @return  -EHOSTUNREACH if no entry matches @p dst
+ */
+int fib_trie_find(const fib_trie_t *trie, const uint8_t *dst, size_t dst_size,
+                  unsigned *idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -61,6 +61,20 @@
  * lists all of the registered paths. See the _Resource list creation_ section
  * below for more.
  *
+ * By default, a request is dispatched by assembling its Uri-Path into a string
+ * and comparing it with the path of every resource of every listener. With the
+ * module `gcoap_dispatch_trie`, gcoap_register_listener() builds an index of
+ * the resource paths of a listener that uses the default request matcher: a
+ * trie with a node per path segment, which also knows the methods of the
+ * resources at a node. A request is then matched by walking its Uri-Path
+ * options through the trie, which does not depend on the number of resources.
+ * The index is built from static pools of
+ * @ref CONFIG_GCOAP_DISPATCH_TRIE_NODES nodes and
+ * @ref CONFIG_GCOAP_DISPATCH_TRIE_ENTRIES resources shared by all listeners.
+ * If they are exhausted, the listener falls back to string comparison.
+ * The index is built once, so the resources of a listener must not change
+ * after it has been registered.
+ *
  * ### Creating a response ###
  *
  * An application resource includes a callback function, a coap_handler_t. After
@@ -157,7 +171,8 @@
  * A CoAP client may register for Observe notifications for any resource that
  * an application has registered with gcoap. An application does not need to
  * take any action to support Observe client registration. However, gcoap
- * limits registration for a given resource to a _single_ observer.
+ * limits registration for a given resource to a _single_ observer, unless the
+ * module `gcoap_obs_fanout` is used (see "Notifying many observers" below).
  *
  * It is [suggested](https://tools.ietf.org/html/rfc7641#section-6) that a
  * server adds the 'obs' attribute to resources that are useful for observation
@@ -193,6 +208,22 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * ### Notifying many observers ###
+ *
+ * With the module `gcoap_obs_fanout`, any number of clients may observe a
+ * resource, up to @ref CONFIG_GCOAP_OBS_REGISTRATIONS_MAX registrations in
+ * total. Create the notification as above, then call gcoap_obs_send_all()
+ * instead of gcoap_obs_send(). It sends the notification to each observer
+ * with the observer's token and a new message ID.
+ *
+ * Some notifications to each observer are confirmable, see
+ * @ref CONFIG_GCOAP_OBS_CON_INTERVAL. They are retransmitted like confirmable
+ * requests, and take a slot of @ref CONFIG_GCOAP_REQ_WAITING_MAX and of
+ * @ref CONFIG_GCOAP_RESEND_BUFS_MAX until they are acknowledged. If an observer
+ * does not acknowledge one after all retransmissions, it is assumed to be gone
+ * and its registration is removed, so notifications don't keep flowing to an
+ * unreachable client (RFC 7641, sec. 4.5).
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -368,6 +399,18 @@
  * times out. We track the response with an entry in the
  * `_coap_state.open_reqs` array.
  *
+ * By default, the entry for a response is found by comparing the token or
+ * message ID and the remote endpoint with every open request, and the
+ * endpoint of an Observe client by comparing it with every known observer.
+ * With the module `gcoap_memo_index`, the open requests are additionally
+ * kept in hash tables by token and by message ID, and their remote endpoints
+ * in a table of unique endpoints, so only the requests in one bucket are
+ * compared, and endpoints are compared by their index in that table. Observers
+ * and the local endpoints notifications are sent from are hashed as well. This
+ * makes matching a response independent of the number of open requests, for
+ * when @ref CONFIG_GCOAP_REQ_WAITING_MAX is large, e.g. for a proxy. See
+ * @ref CONFIG_GCOAP_MEMO_INDEX_BUCKETS.
+ *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
  *
@@ -553,7 +596,8 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of Observe clients
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
+ * @note As documented in this file, the implementation is limited to one observer per resource,
+ *       unless module `gcoap_obs_fanout` is used.
  *       Therefore, every stored observer is associated with a different resource.
  *       If you have only one observable resource, you could set this value to 1.
  */
@@ -565,7 +609,8 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of local notifying endpoint addresses
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
+ * @note As documented in this file, the implementation is limited to one observer per resource,
+ *       unless module `gcoap_obs_fanout` is used.
  *       Therefore, every stored local endpoint alias is associated with an observation context
  *       of a different resource.
  *       If you have only one observable resource, you could set this value to 1.
@@ -578,7 +623,8 @@ extern "C" {
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of registrations for Observable resources
  *
- * @note As documented in this file, the implementation is limited to one observer per resource.
+ * @note As documented in this file, the implementation is limited to one observer per resource,
+ *       unless module `gcoap_obs_fanout` is used.
  *       Therefore, every stored observation context is associated with a different resource.
  *       If you have only one observable resource, you could set this value to 1.
  */
@@ -586,6 +632,21 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of notifications to an observer per confirmable one
+ *
+ * Every notification sent with gcoap_obs_send_all() counts. A notification
+ * that is due to be confirmable is sent non-confirmable instead while the
+ * previous confirmable one is still retransmitted, or if no slot is available
+ * to retransmit it; the next notification is then tried again. Set to 0 to
+ * send only non-confirmable notifications. Only used with module
+ * `gcoap_obs_fanout`.
+ */
+#ifndef CONFIG_GCOAP_OBS_CON_INTERVAL
+#define CONFIG_GCOAP_OBS_CON_INTERVAL   (16U)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -676,6 +737,48 @@ extern "C" {
 #define CONFIG_GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of nodes of the resource dispatch trie
+ *
+ * Each listener uses one node, plus one per distinct path segment prefix of
+ * its resources (e.g. `/a/b` and `/a/c` use three nodes: `a`, `a/b`, `a/c`).
+ * Only used with module `gcoap_dispatch_trie`.
+ *
+ * The default fits e.g. 80 resources `/dev0/res0` to `/dev7/res9` in one
+ * listener, which use 89 nodes. As a rule of thumb, use the number of
+ * registered listeners plus the total number of path segments of all their
+ * resources, which is an upper bound. A listener that does not fit is matched
+ * by string comparison, i.e. without any speed-up, and a warning is logged.
+ */
+#ifndef CONFIG_GCOAP_DISPATCH_TRIE_NODES
+#define CONFIG_GCOAP_DISPATCH_TRIE_NODES    (96U)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of resources in the resource dispatch trie
+ *
+ * Each resource of all registered listeners uses one entry, so this has to be
+ * at least the number of resources of the application. Only used with module
+ * `gcoap_dispatch_trie`.
+ */
+#ifndef CONFIG_GCOAP_DISPATCH_TRIE_ENTRIES
+#define CONFIG_GCOAP_DISPATCH_TRIE_ENTRIES  (96U)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of buckets of the hash tables of open requests and endpoints
+ *
+ * Must be a power of two. A value close to @ref CONFIG_GCOAP_REQ_WAITING_MAX
+ * keeps about one request per bucket. Only used with module
+ * `gcoap_memo_index`.
+ */
+#ifndef CONFIG_GCOAP_MEMO_INDEX_BUCKETS
+#define CONFIG_GCOAP_MEMO_INDEX_BUCKETS     (16U)
+#endif
+
 /**
  * @name Bitwise positional flags for encoding resource links
  * @anchor COAP_LINK_FLAG_
@@ -801,6 +904,15 @@ struct gcoap_listener {
      * @ref resources_len fields to fit their needs.
      */
     gcoap_request_matcher_t request_matcher;
+#if IS_USED(MODULE_GCOAP_DISPATCH_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   Root of the resource dispatch trie, 0 if there is none
+     *
+     * @note    Set by gcoap_register_listener(), only available with module
+     *          `gcoap_dispatch_trie`
+     */
+    uint16_t dispatch_root;
+#endif
 };
 
 /**
@@ -866,6 +978,14 @@ typedef struct {
     uint16_t last_msgid;                /**< Message ID of last notification */
     unsigned token_len;                 /**< Actual length of token attribute */
     gcoap_socket_t socket;              /**< Transport type to observer */
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT) || DOXYGEN
+    uint16_t con_msgid;                 /**< Message ID of last confirmable
+                                             notification */
+    uint8_t notify_count;               /**< Notifications since the last
+                                             confirmable one */
+    bool con_pending;                   /**< Last confirmable notification is
+                                             retransmitted until acknowledged */
+#endif
 } gcoap_observe_memo_t;
 
 /**
@@ -1096,6 +1216,26 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource);
 
+/**
+ * @brief   Sends a buffer containing a CoAP Observe notification to all
+ *          observers registered for a resource
+ *
+ * The buffer must have been initialized with gcoap_obs_init(). Its options
+ * and payload are sent to every observer, each with its own token and a new
+ * message ID. See @ref CONFIG_GCOAP_OBS_CON_INTERVAL for when a notification
+ * is confirmable.
+ *
+ * @note    Only available with module `gcoap_obs_fanout`
+ *
+ * @param[in] buf       Buffer containing the PDU
+ * @param[in] len       Length of the buffer
+ * @param[in] resource  Resource to send
+ *
+ * @return  number of observers the notification was sent to
+ */
+size_t gcoap_obs_send_all(const uint8_t *buf, size_t len,
+                          const coap_resource_t *resource);
+
 /**
  * @brief   Forgets (invalidates) an existing observe request.
  *
@@ -301,6 +301,21 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_NUMOF                 (4)
 #endif
 
+/**
+ * @brief   Index the NIB entries by IPv6 and link-layer address
+ *
+ * Without the index, looking up a neighbor by its IPv6 address (e.g. for every
+ * unicast packet sent and every neighbor solicitation or advertisement
+ * received) or by its link-layer address scans all
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF entries. With the index, the entries are
+ * also kept in two open addressing hash tables in static memory, costing
+ * 4 to 8 bytes of RAM per entry. This pays off for routers with many
+ * neighbors, e.g. a 6LR with many registered hosts.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_INDEX
+#  define CONFIG_GNRC_IPV6_NIB_NC_INDEX              CONFIG_GNRC_IPV6_NIB_6LR
+#endif
+
 /**
  * @brief Per-neighbor packet queue capacity
  *
@@ -323,6 +338,25 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Index the off-link entries for longest prefix match lookups
+ *
+ * Without the index, every next hop resolution for an off-link destination
+ * and every insertion scans all @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
+ * off-link entries. With the index, the entries are kept in a hash table by
+ * prefix and lookups only probe the prefix lengths currently in use, longest
+ * first. This costs a few bytes of RAM per off-link entry and pays off for
+ * large tables, e.g. on a 6LBR serving a large mesh.
+ *
+ * @note    With the index, the off-link entry with the longest prefix
+ *          matching a destination is chosen. Without it, prefixes that only
+ *          differ in zero bits of the destination are considered equally
+ *          long.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_INDEX
+#  define CONFIG_GNRC_IPV6_NIB_OFFL_INDEX            CONFIG_GNRC_IPV6_NIB_6LBR
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
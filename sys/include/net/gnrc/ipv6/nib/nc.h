@@ -315,6 +315,25 @@ bool gnrc_ipv6_nib_nc_del_l2(unsigned iface, const uint8_t *l2addr, size_t l2add
  */
 void gnrc_ipv6_nib_nc_mark_reachable(const ipv6_addr_t *ipv6);
 
+/**
+ * @brief   Gets a neighbor cache entry by link-layer address
+ *
+ * @pre `(l2addr != NULL) && (nce != NULL)`
+ *
+ * @param[in] iface         The interface to the neighbor. 0 for any
+ *                          interface.
+ * @param[in] l2addr        The neighbor's link-layer address.
+ * @param[in] l2addr_len    Length of @p l2addr.
+ * @param[out] nce          The neighbor cache entry with @p l2addr as
+ *                          link-layer address.
+ *
+ * @retval  True if a neighbor with @p l2addr was found.
+ * @retval  False otherwise.
+ */
+ACCESS(read_only, 2, 3)
+bool gnrc_ipv6_nib_nc_get_by_l2addr(unsigned iface, const uint8_t *l2addr,
+                                    size_t l2addr_len, gnrc_ipv6_nib_nc_t *nce);
+
 /**
  * @brief   Iterates over all neighbor cache entries in the NIB
  *
@@ -21,6 +21,11 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "modules.h"
+#include "net/gnrc/netif/conf.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/ipv6/addr.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -46,6 +51,29 @@ extern "C" {
 #define GNRC_NETIF_6LO_LOCAL_FLAGS_SFR  (0x01)
 /** @} */
 
+/**
+ * @brief   Entry of the IPHC flow cache of an interface
+ *
+ * Memoizes the address dependent part of the IPHC header for a flow, i.e. the
+ * second IPHC dispatch byte, the context identifier extension, and the inline
+ * source and destination address fields.
+ *
+ * @note    Only used with module `gnrc_sixlowpan_iphc_flow_cache`.
+ */
+typedef struct {
+    ipv6_addr_t src;                        /**< source address of the flow */
+    ipv6_addr_t dst;                        /**< destination address of the flow */
+    uint8_t l2_dst[GNRC_NETIF_L2ADDR_MAXLEN];   /**< link-layer destination */
+    uint8_t l2_dst_len;                     /**< length of gnrc_netif_6lo_iphc_flow_t::l2_dst */
+    uint8_t nh;                             /**< next header of the flow */
+    uint8_t iphc2;                          /**< second IPHC dispatch byte */
+    uint8_t cid;                            /**< context identifier extension */
+    unsigned gen;                           /**< generation the entry is valid for */
+    bool used;                              /**< entry is in use */
+    uint8_t addr_inline_len;                /**< length of gnrc_netif_6lo_iphc_flow_t::addr_inline */
+    uint8_t addr_inline[2 * sizeof(ipv6_addr_t)];   /**< inline address fields */
+} gnrc_netif_6lo_iphc_flow_t;
+
 /**
  * @brief   6Lo component of @ref gnrc_netif_t
  */
@@ -66,6 +94,29 @@ typedef struct {
      *          net_gnrc_netif_6lo_local_flags)
      */
     uint8_t local_flags;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry of gnrc_netif_6lo_t::iphc_flows to replace
+     *
+     * @note    Only available with module `gnrc_sixlowpan_iphc_flow_cache`.
+     */
+    uint8_t iphc_flow_next;
+    /**
+     * @brief   Generation of the interface's link-layer address
+     *
+     * Incremented when the link-layer address of the interface changes to
+     * invalidate gnrc_netif_6lo_t::iphc_flows.
+     *
+     * @note    Only available with module `gnrc_sixlowpan_iphc_flow_cache`.
+     */
+    unsigned iphc_flow_gen;
+    /**
+     * @brief   IPHC flow cache
+     *
+     * @note    Only available with module `gnrc_sixlowpan_iphc_flow_cache`.
+     */
+    gnrc_netif_6lo_iphc_flow_t iphc_flows[CONFIG_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE_SIZE];
+#endif
 } gnrc_netif_6lo_t;
 
 #ifdef __cplusplus
@@ -72,6 +72,26 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC netreg compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of buckets of the registry's hash table
+ *
+ * Entries are distributed over the buckets by their type and
+ * @ref gnrc_netreg_entry_t::demux_ctx, so a lookup only searches the entries
+ * of one bucket. Must be a power of two and at least @ref GNRC_NETTYPE_NUMOF,
+ * which guarantees that entries with the same demux context but a different
+ * type never share a bucket. Increase it when many entries of the same type
+ * are registered, e.g. many UDP socks.
+ */
+#ifndef CONFIG_GNRC_NETREG_BUCKETS
+#define CONFIG_GNRC_NETREG_BUCKETS  (16U)
+#endif
+/** @} */
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -343,6 +363,8 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
  *
  * @warning Call gnrc_netreg_unregister() *before* you leave the context you
  *          allocated @p entry in. Otherwise it might get overwritten.
+ * @warning gnrc_netreg_entry_t::demux_ctx of @p entry must not be changed
+ *          while it is registered.
  *
  * @pre The calling thread must provide a [message queue](@ref msg_init_queue)
  *      when using @ref GNRC_NETREG_TYPE_DEFAULT for gnrc_netreg_entry_t::type
@@ -22,18 +22,29 @@
  *
  * # Backends
  *
- * There are two backends available: `gnrc_pktbuf_static` and
- * `gnrc_pktbuf_malloc`. The former is the default and most suitable for
- * embedded devices, as it works with a static pool of memory. The latter is
- * mostly useful when debugging allocations with tools like Valgrind on the
- * `native` board, as it builds upon standard `malloc()`, `realloc()`, and
- * `free()` that those tools can hook into.
+ * There are three backends available: `gnrc_pktbuf_static`,
+ * `gnrc_pktbuf_sizeclass` and `gnrc_pktbuf_malloc`. The first is the default
+ * and most suitable for embedded devices, as it works with a static pool of
+ * memory. The last is mostly useful when debugging allocations with tools like
+ * Valgrind on the `native` board, as it builds upon standard `malloc()`,
+ * `realloc()`, and `free()` that those tools can hook into.
+ *
+ * `gnrc_pktbuf_sizeclass` also works with static memory, but splits it into
+ * pools of fixed size blocks for the common allocation sizes: packet snip
+ * descriptors, headers (e.g. netif and IPv6 headers), link layer frames (e.g.
+ * 6LoWPAN) and full MTU sized payloads. Allocation and release are O(1) and
+ * do not fragment the pools, at the cost of the memory lost to rounding up
+ * to the block size. An allocation that does not fit into its class takes a
+ * block of the next bigger class. The number of blocks of each class is
+ * configured with the `CONFIG_GNRC_PKTBUF_SIZECLASS_*` macros, so
+ * @ref CONFIG_GNRC_PKTBUF_SIZE does not apply to this backend.
  *
  * Since `gnrc_pktbuf_static` is the default, no action is required to use it:
  * Any code using `gnrc_pktbuf` will automatically pull that in as a dependency.
  *
- * To use `gnrc_pktbuf_malloc`, it needs to be selected e.g. by adding
- * `USEMODULE += gnrc_pktbuf_malloc` to the application's `Makefile`.
+ * To use `gnrc_pktbuf_malloc` or `gnrc_pktbuf_sizeclass`, it needs to be
+ * selected e.g. by adding `USEMODULE += gnrc_pktbuf_malloc` to the
+ * application's `Makefile`.
  *
  * @warning     The `gnrc_pktbuf_malloc` backend has slightly different
  *              semantics with address sanitation for @ref gnrc_pktbuf_realloc_data
@@ -55,6 +66,7 @@
 #include <string.h>
 
 #include "compiler_hints.h"
+#include "modules.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/neterr.h"
 #include "net/gnrc/nettype.h"
@@ -81,8 +93,80 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptor blocks of `gnrc_pktbuf_sizeclass`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF     (48)
+#endif
+
+/**
+ * @brief   Size of the header blocks of `gnrc_pktbuf_sizeclass`
+ *
+ * @details Needs to fit a netif header with two long link layer addresses and
+ *          an IPv6 header. Must be a multiple of 8.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE       (48)
+#endif
+
+/**
+ * @brief   Number of header blocks of `gnrc_pktbuf_sizeclass`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF      (32)
+#endif
+
+/**
+ * @brief   Size of the frame blocks of `gnrc_pktbuf_sizeclass`
+ *
+ * @details Needs to fit an IEEE 802.15.4 frame. Must be a multiple of 8.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE     (128)
+#endif
+
+/**
+ * @brief   Number of frame blocks of `gnrc_pktbuf_sizeclass`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_NUMOF
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_NUMOF    (8)
+#endif
+
+/**
+ * @brief   Size of the MTU blocks of `gnrc_pktbuf_sizeclass`
+ *
+ * @details This is the largest possible allocation with this backend. The
+ *          default fits the IPv6 minimum MTU, increase it to the link MTU for
+ *          e.g. Ethernet. Must be a multiple of 8.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE       (1280)
+#endif
+
+/**
+ * @brief   Number of MTU blocks of `gnrc_pktbuf_sizeclass`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_NUMOF
+#define CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_NUMOF      (2)
+#endif
 /** @} */
 
+/**
+ * @brief   Maximum number of buffers that can be lent to the packet buffer at
+ *          the same time
+ *
+ * @see     gnrc_pktbuf_add_lent()
+ */
+#ifndef CONFIG_GNRC_PKTBUF_LENT_NUMOF
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+#define CONFIG_GNRC_PKTBUF_LENT_NUMOF   (4)
+#else
+#define CONFIG_GNRC_PKTBUF_LENT_NUMOF   (0)
+#endif
+#endif
+
 /**
  * @brief   Enable use-after-free/out of bounds write detection in gnrc_pktbuf
  */
@@ -129,6 +213,38 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Adds a new gnrc_pktsnip_t with data that stays outside of the packet
+ *          buffer
+ *
+ * This allows e.g. network device drivers to hand out their receive buffer
+ * without copying it into the packet buffer. The data is split in place by
+ * gnrc_pktbuf_mark() and only copied into the packet buffer if it needs to
+ * grow (see gnrc_pktbuf_realloc_data()) or is written while shared (see
+ * gnrc_pktbuf_start_write()). Once no snip uses the data anymore, @p release
+ * is called with @p arg.
+ *
+ * @note    @p release is called with the packet buffer locked, so it must not
+ *          call any gnrc_pktbuf function.
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] data      The lent data. Must not be NULL.
+ * @param[in] size      Length of @p data. Must not be 0.
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ * @param[in] release   Called when @p data is not used by the packet buffer
+ *                      anymore.
+ * @param[in] arg       Argument for @p release.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer or already
+ *          @ref CONFIG_GNRC_PKTBUF_LENT_NUMOF buffers are lent to it. In that
+ *          case @p release is not called.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_lent(gnrc_pktsnip_t *next, void *data, size_t size,
+                                     gnrc_nettype_t type,
+                                     void (*release)(void *arg), void *arg);
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -156,7 +272,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
  * @param[in] type  The type of the new packet snip.
  *
  * @note    It's not guaranteed that `result->data` points to the same address
- *          as the original `pkt->data`.
+ *          as the original `pkt->data`. It does, and no data is copied, for
+ *          data added with gnrc_pktbuf_add_lent() and with the
+ *          `gnrc_pktbuf_sizeclass` backend.
  *
  * @return  The new packet snip in @p pkt on success.
  * @return  NULL, if pkt == NULL or size == 0 or size > pkt->size or pkt->data == NULL.
@@ -327,7 +445,11 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_sizeclass` the usage, high-water mark and bytes lost
+ *          to rounding of each size class are printed instead, together with
+ *          the number of allocations that had to fall back to a bigger class
+ *          or failed.
  */
 void gnrc_pktbuf_stats(void);
 #endif
@@ -125,6 +125,20 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of hash buckets of the reassembly buffer index
+ *
+ * @note    Only applicable with module `gnrc_sixlowpan_frag_rb_index`
+ *
+ * Must be a power of two. Entries are found by their source and destination
+ * address and tag in the bucket for these values, so a value close to @ref
+ * CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE keeps the lookup of a fragment's entry
+ * independent of the size of the reassembly buffer.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS                (8U)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -143,6 +157,19 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_ND_AR_LTIME          (15U)
 #endif
 
+/**
+ * @brief   Number of flows in the IPHC flow cache of an interface
+ *
+ * @note    Only applicable with module `gnrc_sixlowpan_iphc_flow_cache`
+ *
+ * The address dependent part of the IPHC header of the last flows sent over
+ * an interface is memoized, so it does not need to be derived from the
+ * compression contexts and the interface's link-layer address again.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE_SIZE  (4U)
+#endif
+
 /**
  * @brief   Size of the virtual reassembly buffer
  *
@@ -25,6 +25,7 @@
 #include <stdalign.h>
 
 #include "architecture.h"
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -41,6 +42,17 @@ extern "C" {
  */
 #define GNRC_SIXLOWPAN_FRAG_RB_GC_MSG       (0x0226)
 
+/**
+ * @brief   Number of 8-octet units tracked in the bitmaps of a reassembly
+ *          buffer entry
+ *
+ * Datagrams up to the IPv6 minimum MTU are tracked in the bitmaps, larger ones
+ * with fragment intervals.
+ *
+ * @note    Only used with module `gnrc_sixlowpan_frag_rb_bitmap`
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS (1280U / 8U)
+
 /**
  * @brief   Fragment intervals to identify limits of fragments and duplicates.
  *
@@ -113,6 +125,26 @@ typedef struct {
     int8_t offset_diff;                         /**< offset change due to
                                                  *   recompression */
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) || defined(DOXYGEN)
+    /**
+     * @brief   Bitmap of the received 8-octet units of the datagram
+     *
+     * Used instead of gnrc_sixlowpan_frag_rb_base_t::ints for
+     * [RFC 4944](https://tools.ietf.org/html/rfc4944) fragments of datagrams
+     * up to @ref GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS units.
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_bitmap`
+     *          compiled in.
+     */
+    BITFIELD(units, GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS);
+    /**
+     * @brief   Bitmap of the 8-octet units a received fragment starts at
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rb_bitmap`
+     *          compiled in.
+     */
+    BITFIELD(starts, GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS);
+#endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP) */
 } gnrc_sixlowpan_frag_rb_t;
 
 /**
@@ -237,8 +269,32 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void);
  */
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry);
 
+/**
+ * @brief   Marks a fragment as received in a base entry
+ *
+ * Checks the fragment against the fragment intervals of @p entry, adds it
+ * to them and increments gnrc_sixlowpan_frag_rb_base_t::current_size by
+ * @p frag_size.
+ *
+ * @param[in,out] entry     A base entry, e.g. of a VRB entry.
+ * @param[in] offset        Offset of the fragment in the datagram.
+ * @param[in] frag_size     Size of the fragment's payload.
+ *
+ * @return  0, if the fragment was added.
+ * @return  -EEXIST, if the fragment was already received.
+ * @return  -EINVAL, if the fragment overlaps partially with a received one.
+ * @return  -ENOMEM, if there is no fragment interval left.
+ */
+int gnrc_sixlowpan_frag_rb_base_add_frag(gnrc_sixlowpan_frag_rb_base_t *entry,
+                                         size_t offset, size_t frag_size);
+
 /**
  * @brief   Garbage collect reassembly buffer.
+ *
+ * Without module `gnrc_sixlowpan_frag_rb_index`, this is also called for every
+ * added fragment. With it, only the timer that sends
+ * @ref GNRC_SIXLOWPAN_FRAG_RB_GC_MSG triggers it, and it re-arms that timer
+ * for the next entry to time out.
  */
 void gnrc_sixlowpan_frag_rb_gc(void);
 
@@ -171,6 +171,47 @@ static inline bool gnrc_sixlowpan_frag_vrb_entry_empty(gnrc_sixlowpan_frag_vrb_t
     return (vrb->super.src_len == 0);
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST) || defined(DOXYGEN)
+/**
+ * @brief   Locks the VRB against the fast path
+ *
+ * The 6LoWPAN thread holds this lock while it handles a message, so the
+ * network interfaces only use the VRB in
+ * @ref gnrc_sixlowpan_frag_vrb_fast_forward() while it is idle.
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_vrb_fast`.
+ */
+void gnrc_sixlowpan_frag_vrb_lock(void);
+
+/**
+ * @brief   Unlocks the VRB for the fast path
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_vrb_fast`.
+ */
+void gnrc_sixlowpan_frag_vrb_unlock(void);
+
+/**
+ * @brief   Forwards a received subsequent fragment of a datagram with a VRB
+ *          entry directly from the receiving network interface
+ *
+ * The tag of the fragment header and the link-layer header are rewritten in
+ * place, and the packet is handed to gnrc_sixlowpan_frag_vrb_t::out_netif,
+ * without passing through the 6LoWPAN thread. All other packets are left to
+ * the 6LoWPAN thread.
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_vrb_fast`.
+ *
+ * @param[in] pkt   A packet as received by a network interface, i.e. with the
+ *                  network interface header as its second snip.
+ *
+ * @return  true, if @p pkt was forwarded or dropped as a duplicate or
+ *          overlapping fragment.
+ * @return  false, if @p pkt was not touched and needs to be passed on to the
+ *          6LoWPAN thread.
+ */
+bool gnrc_sixlowpan_frag_vrb_fast_forward(gnrc_pktsnip_t *pkt);
+#endif
+
 #if defined(TEST_SUITES) || defined(DOXYGEN)
 /**
  * @brief   Resets the VRB to a clean state
@@ -216,6 +216,11 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Transmitted bytes may still be unacknowledged on return if
+ *       @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE is greater than 1.
+ * @note Data that was queued for transmission is sent right away, the function only
+ *       waits for the peer if the send window or the retransmit queue is full. Use
+ *       gnrc_tcp_try_send() to not wait at all.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -237,6 +242,31 @@ ACCESS(read_only, 2, 3)
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Transmit data to connected peer without waiting for it.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ *
+ * @note Queues as much of @p data for transmission as the send window and
+ *       @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE allow. If an event callback was
+ *       set via @ref sock_tcp_set_cb, @ref SOCK_ASYNC_MSG_SENT is reported once the
+ *       peer acknowledged data or re-opened its send window, i.e. when it is worth
+ *       trying again. Unlike gnrc_tcp_send(), the function sends no window probes.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     data   Pointer to the data that should be transmitted.
+ * @param[in]     len    Number of bytes that should be transmitted.
+ *
+ * @return   The number of bytes queued for transmission.
+ * @return   0, if @p len was 0.
+ * @return   -ENOTCONN if connection is not established.
+ * @return   -EAGAIN if no data could be queued, or if another thread is using @p tcb.
+ */
+ACCESS(read_only, 2, 3)
+ssize_t gnrc_tcp_try_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len);
+
 /**
  * @brief Receive Data from the peer.
  *
@@ -272,12 +302,67 @@ ACCESS(write_only, 2, 3)
 ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, size_t max_len,
                       uint32_t user_timeout_duration_ms);
 
+#if defined(MODULE_GNRC_TCP_RECV_BUF) || defined(DOXYGEN)
+/**
+ * @brief Receive Data from the peer without copying it.
+ *
+ * Lends received segment payload out of the packet buffer, one segment at a time.
+ * Call the function again with the returned @p buf_ctx to hand the data back and to
+ * get the next segment that is already available. Once 0 is returned, @p buf_ctx
+ * was released and the next call with `*buf_ctx == NULL` waits for new data:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * void *data, *ctx = NULL;
+ * ssize_t res;
+ *
+ * while ((res = gnrc_tcp_recv_buf(tcb, &data, &ctx, timeout)) > 0) {
+ *     consume(data, res);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ * @pre @p buf_ctx must not be NULL.
+ *
+ * @note Only available with module `gnrc_tcp_recv_buf`. The module stores received
+ *       payload in the packet buffer instead of a copy in a receive buffer, so
+ *       @ref CONFIG_GNRC_TCP_RCV_BUFFERS does not apply and gnrc_tcp_recv() reads
+ *       from the same data.
+ * @note Function blocks if @p user_timeout_duration_ms is not zero and
+ *       `*buf_ctx == NULL`.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[out]    data                       Pointer to the received data.
+ * @param[in,out] buf_ctx                    Context of the lent data. Must be NULL on
+ *                                           the first call.
+ * @param[in]     user_timeout_duration_ms   Timeout for receive in milliseconds, same
+ *                                           semantics as for gnrc_tcp_recv().
+ *
+ * @return   The number of bytes at @p data.
+ * @return   0, if @p buf_ctx was released and no further data is available yet, or if
+ *           the connection is closing and no further data can be read.
+ * @return   -ENOTCONN if connection is not established.
+ * @return   -EAGAIN if user_timeout_duration_ms is zero and no data is available.
+ * @return   -ECONNRESET if connection was reset by the peer.
+ * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ */
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, void **buf_ctx,
+                          uint32_t user_timeout_duration_ms);
+#endif
+
 /**
  * @brief Close a TCP connection.
  *
  * @pre gnrc_tcp_tcb_init() must have been successfully called.
  * @pre @p tcb must not be NULL.
  *
+ * @note Blocks until the connection teardown is complete. For connections accepted from
+ *       a queue with an event callback set via @ref sock_tcp_queue_set_cb, the function
+ *       returns immediately instead. The TCB is re-opened for its queue once the
+ *       teardown is complete.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  */
 void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb);
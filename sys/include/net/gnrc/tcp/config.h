@@ -94,7 +94,8 @@ extern "C" {
  * @brief Number of preallocated receive buffers.
  *
  * This value determines how many parallel TCP connections can be active at the
- * same time.
+ * same time. Unused with module `gnrc_tcp_recv_buf`, which keeps received
+ * payload in the packet buffer.
  */
 #ifndef CONFIG_GNRC_TCP_RCV_BUFFERS
 #define CONFIG_GNRC_TCP_RCV_BUFFERS (1U)
@@ -102,11 +103,33 @@ extern "C" {
 
 /**
  * @brief Default receive buffer size
+ *
+ * With module `gnrc_tcp_recv_buf` this is the number of unread payload bytes
+ * a connection may hold in the packet buffer.
  */
 #ifndef GNRC_TCP_RCV_BUF_SIZE
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of unacknowledged segments a connection may have in flight
+ *
+ * Every unacknowledged segment stays in the packet buffer until the peer
+ * acknowledges it, so the packet buffer must be able to hold this many
+ * segments of up to @ref CONFIG_GNRC_TCP_MSS bytes per connection. The number
+ * of bytes in flight is additionally bounded by the peers receive window and
+ * the congestion window. A value of 1 results in stop-and-wait behavior,
+ * which limits the throughput to one segment per round-trip time.
+ * The queue has an additional slot reserved for the FIN of a connection.
+ *
+ * If the packet buffer can't hold another segment, sending waits until the
+ * peer acknowledged in-flight data, so a small packet buffer reduces the
+ * number of segments in flight instead of failing.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (4U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
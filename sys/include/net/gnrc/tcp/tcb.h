@@ -33,10 +33,45 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+/* net/sock/async/types.h includes the GNRC sock types, which include this header
+ * again: typedef the TCB types up front to prevent cyclic includes */
+#if defined (__clang__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wtypedef-redefinition"
+#endif
+
+#ifdef SOCK_HAS_ASYNC
+typedef struct sock_tcp gnrc_tcp_tcb_t;
+typedef struct sock_tcp_queue gnrc_tcp_tcb_queue_t;
+#include "net/sock/async/types.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if defined(SOCK_HAS_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief Event callback of a TCB, same signature as @ref sock_tcp_cb_t.
+ *
+ * @warning Events caused by the peer are reported from the TCP eventloop
+ *          thread. The callback must not block, e.g. by calling
+ *          gnrc_tcp_send() instead of gnrc_tcp_try_send(), but should only
+ *          post an event to the thread serving the connection, as done by
+ *          @ref net_sock_async_event.
+ */
+typedef void (*gnrc_tcp_tcb_cb_t)(struct sock_tcp *tcb, sock_async_flags_t flags, void *arg);
+
+/**
+ * @brief Event callback of a TCB queue, same signature as @ref sock_tcp_queue_cb_t.
+ *
+ * @warning Called from the TCP eventloop thread, the same restrictions as for
+ *          @ref gnrc_tcp_tcb_cb_t apply.
+ */
+typedef void (*gnrc_tcp_tcb_queue_cb_t)(struct sock_tcp_queue *queue, sock_async_flags_t flags,
+                                        void *arg);
+#endif
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -62,19 +97,40 @@ typedef struct sock_tcp {
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< AckNo. that completes the running rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Retransmit queue, the last slot is reserved for a FIN
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE + 1];
+    uint8_t pkt_retransmit_len;           /**< Number of packets in the retransmit queue */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
+#ifdef MODULE_GNRC_TCP_RECV_BUF
+    gnrc_pktsnip_t *rcv_pkt; /**< Received in-order payload, not read yet */
+    uint16_t rcv_pkt_offset; /**< Bytes of the first snip in rcv_pkt already read */
+#else
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
+#if defined(SOCK_HAS_ASYNC) || defined(DOXYGEN)
+    gnrc_tcp_tcb_cb_t async_cb;   /**< Event callback of the connection */
+    void *async_cb_arg;           /**< Event callback argument */
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_async_ctx_t async_ctx;   /**< Asynchronous event context */
+#endif
+    struct sock_tcp_queue *queue; /**< Listening queue the TCB belongs to */
+#endif
     struct sock_tcp *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
@@ -85,12 +141,23 @@ typedef struct sock_tcp_queue {
     mutex_t lock;         /**< Mutex for access synchronization */
     gnrc_tcp_tcb_t *tcbs; /**< Pointer to TCB sequence */
     size_t tcbs_len;      /**< Number of TCBs behind member tcbs */
+#if defined(SOCK_HAS_ASYNC) || defined(DOXYGEN)
+    gnrc_tcp_tcb_queue_cb_t async_cb; /**< Event callback for new connections */
+    void *async_cb_arg;               /**< Event callback argument */
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_async_ctx_t async_ctx;       /**< Asynchronous event context */
+#endif
+#endif
 } gnrc_tcp_tcb_queue_t;
 
+#if defined (__clang__)
+# pragma clang diagnostic pop
+#endif
+
 /**
  * @brief Static initializer for type gnrc_tcp_tcb_queue_t
  */
-#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0 }
+#define GNRC_TCP_TCB_QUEUE_INIT   { .lock = MUTEX_INIT, .tcbs = NULL, .tcbs_len = 0 }
 
 #ifdef __cplusplus
 }
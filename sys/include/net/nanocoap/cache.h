@@ -13,6 +13,32 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Cache entries are found by their cache key through a hash table of
+ * @ref CONFIG_NANOCOAP_CACHE_BUCKETS buckets. As the cache key is a SHA-256
+ * digest, its first bytes are used as hash, so a lookup only compares the
+ * keys of the entries in one bucket.
+ *
+ * When the cache is full, the entry to replace is chosen by one of the
+ * following strategies:
+ *
+ * - least recently used (LRU), the default
+ * - least frequently used (LFU), with module `nanocoap_cache_lfu`. Entries
+ *   accessed equally often are replaced in LRU order.
+ * - Greedy-Dual-Size-Frequency (GDSF), with module `nanocoap_cache_gdsf`.
+ *   The priority of an entry is its number of accesses divided by the size
+ *   of its response, plus an inflation value that is raised to the priority
+ *   of each replaced entry, so entries that were popular long ago age out.
+ *   This keeps many small, popular responses at the expense of large ones.
+ *
+ * Entries are kept after their Max-Age passed, e.g. to revalidate them with
+ * their ETag, until they are replaced. With module `nanocoap_cache_expire`,
+ * entries are removed as soon as they become stale instead, after
+ * @ref nanocoap_cache_expire_init() was called with the event queue of the
+ * thread using the cache.
+ *
+ * The number of cache hits, misses, replaced and expired entries can be read
+ * with @ref nanocoap_cache_get_stats().
+ *
  * @{
  *
  * @file
@@ -25,6 +51,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "clist.h"
+#include "kernel_defines.h"
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE) || defined(DOXYGEN)
+#include "event.h"
+#endif
 #include "net/nanocoap.h"
 #include "hashes/sha256.h"
 #include "ztimer.h"
@@ -54,15 +84,29 @@ extern "C" {
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief The number of buckets of the hash table of cache keys.
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_BUCKETS
+#define CONFIG_NANOCOAP_CACHE_BUCKETS          (8)
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
-typedef struct {
+typedef struct nanocoap_cache_entry {
     /**
      * @brief needed for clist_t, must be the first struct member!
      */
     clist_node_t node;
 
+    /**
+     * @brief next entry in the same bucket of the hash table
+     */
+    struct nanocoap_cache_entry *bucket_next;
+
     /**
      * @brief the calculated cache key, see nanocoap_cache_key_generate().
      */
@@ -90,8 +134,26 @@ typedef struct {
      * is considered valid.
      */
     uint32_t max_age;
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_LFU) || IS_USED(MODULE_NANOCOAP_CACHE_GDSF) || \
+    defined(DOXYGEN)
+    uint16_t hits;          /**< number of accesses, saturating */
+#endif
+#if IS_USED(MODULE_NANOCOAP_CACHE_GDSF) || defined(DOXYGEN)
+    uint32_t priority;      /**< GDSF priority, lowest is replaced first */
+#endif
 } nanocoap_cache_entry_t;
 
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t evictions;     /**< entries replaced to make room */
+    uint32_t expirations;   /**< stale entries removed by `nanocoap_cache_expire` */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache replacement strategy on full cache list.
  *
@@ -122,6 +184,28 @@ static inline void nanocoap_cache_init(void)
 }
 #endif
 
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE) || defined(DOXYGEN)
+/**
+ * @brief   Starts removing stale entries when their Max-Age passed
+ *
+ * Only available with module `nanocoap_cache_expire`. Stale entries are
+ * removed by an event posted to @p queue, which must be handled by the thread
+ * using the cache. Call after @ref nanocoap_cache_init().
+ *
+ * @param[in] queue     event queue of the thread using the cache
+ */
+void nanocoap_cache_expire_init(event_queue_t *queue);
+#endif
+
+/**
+ * @brief   Gets the statistics of the cache
+ *
+ * The statistics are reset by @ref nanocoap_cache_init().
+ *
+ * @param[out] stats    the statistics
+ */
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Returns the number of cached entries.
  *
@@ -194,6 +278,9 @@ nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req);
 /**
  * @brief   Performs a cache lookup based on the cache key of a request.
  *
+ * Counts as access of the entry for the replacement strategy and in the
+ * statistics.
+ *
  * @param[in] cache_key       The cache key of a request
  *
  * @return  An existing cache entry on cache hit
@@ -531,9 +531,14 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
  * @param[in] data  Pointer to the data to be written to the stream.
  * @param[in] len   Maximum space available at @p data.
  *
- * @note    Function may block.
+ * @note    Function may block. With GNRC and @ref net_sock_async_event, it
+ *          does not block when called from the thread serving the events of
+ *          @p sock. @ref SOCK_ASYNC_MSG_SENT then signals that it is worth
+ *          trying again after it returned -EAGAIN.
  *
  * @return  The number of bytes written on success.
+ * @return  -EAGAIN, if @p sock does not block and no data could be written
+ *          without waiting for the remote end point.
  * @return  -ECONNABORTED, if the connection is aborted while waiting for the
  *          next data.
  * @return  -ECONNRESET, if the connection was forcibly closed by remote end
@@ -634,6 +634,99 @@ static inline ssize_t sock_udp_recv_buf(sock_udp_t *sock,
     return sock_udp_recv_buf_aux(sock, data, buf_ctx, timeout, remote, NULL);
 }
 
+#if defined(MODULE_SOCK_UDP_ZERO_COPY) && !defined(MODULE_GNRC_SOCK_UDP)
+#error "sock_udp_zero_copy is only implemented by gnrc_sock_udp"
+#endif
+
+#if defined(MODULE_SOCK_UDP_ZERO_COPY) || defined(DOXYGEN)
+/**
+ * @name    Zero-copy send buffers
+ *
+ * With the module `sock_udp_zero_copy`, a datagram can be written directly
+ * into stack-internal buffer space and handed to the stack without copying
+ * it. The buffer is either allocated with @ref sock_udp_buf_alloc() or taken
+ * over from a datagram received with @ref sock_udp_recv_buf_aux() with
+ * @ref sock_udp_buf_claim(), so a reply can be built in place of the request.
+ *
+ * @note    Select module `sock_udp_zero_copy` and a compatible network stack
+ *          (currently only @ref net_gnrc_sock) to use this
+ *
+ * @experimental    These functions are quite new, not implemented for all
+ *                  stacks yet, and may be subject to sudden API changes.
+ * @{
+ */
+
+/**
+ * @brief   Allocates stack-internal buffer space for a UDP message
+ *
+ * @pre `buf_ctx != NULL`
+ *
+ * @param[in] len       Size of the buffer.
+ * @param[out] buf_ctx  Stack-internal buffer context, to be passed to
+ *                      @ref sock_udp_send_buf_aux() or
+ *                      @ref sock_udp_buf_free().
+ *
+ * @return  Pointer to @p len bytes of writable buffer space.
+ * @return  NULL, if no memory was available.
+ */
+void *sock_udp_buf_alloc(size_t len, void **buf_ctx);
+
+/**
+ * @brief   Takes over the buffer of a received UDP message for sending
+ *
+ * The received data is kept at the start of the returned buffer, the buffer
+ * is resized to @p len bytes.
+ *
+ * @pre `(buf_ctx != NULL) && (*buf_ctx != NULL)`
+ *
+ * @param[in,out] buf_ctx   Buffer context as returned by
+ *                          @ref sock_udp_recv_buf_aux() for the first segment
+ *                          of a datagram. Is turned into a context for
+ *                          @ref sock_udp_send_buf_aux() on success, stays
+ *                          unchanged otherwise.
+ * @param[in] len           Size of the buffer.
+ *
+ * @return  Pointer to @p len bytes of writable buffer space.
+ * @return  NULL, if no memory was available. The received datagram can still
+ *          be used and has to be released as before.
+ */
+void *sock_udp_buf_claim(void **buf_ctx, size_t len);
+
+/**
+ * @brief   Sends a UDP message from stack-internal buffer space
+ *
+ * @pre `((sock != NULL || remote != NULL)) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] buf_ctx   Buffer context as returned by @ref sock_udp_buf_alloc()
+ *                      or @ref sock_udp_buf_claim(). The buffer is consumed,
+ *                      also if sending fails.
+ * @param[in] len       Number of bytes of the buffer to send, must not exceed
+ *                      the size of the buffer.
+ * @param[in] remote    Remote end point for the sent data.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ * @param[out] aux      Auxiliary data about the transmission.
+ *                      May be `NULL`, if it is not required by the application.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  The same errors as @ref sock_udp_sendv_aux() otherwise.
+ */
+ssize_t sock_udp_send_buf_aux(sock_udp_t *sock, void *buf_ctx, size_t len,
+                              const sock_udp_ep_t *remote,
+                              sock_udp_aux_tx_t *aux);
+
+/**
+ * @brief   Releases stack-internal buffer space that was not sent
+ *
+ * @param[in] buf_ctx   Buffer context as returned by @ref sock_udp_buf_alloc()
+ *                      or @ref sock_udp_buf_claim().
+ */
+void sock_udp_buf_free(void *buf_ctx);
+/** @} */
+#endif
+
 /**
  * @brief   Sends a UDP message to remote end point with non-continuous payload
  *
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_pm_layered_tickless Tickless idle
+ * @ingroup     sys_pm_layered
+ * @brief       Chooses the power mode of the idle thread by the next timer
+ *
+ * Without this module, @ref pm_set_lowest() enters the deepest power mode that
+ * is not blocked. Waking up from a deep power mode takes time, so a timer
+ * expiring soon after the CPU went to sleep is served late.
+ *
+ * With the pseudomodule `pm_layered_tickless`, @ref pm_set_lowest() looks up
+ * the earliest timer pending on any of `ZTIMER_USEC`, `ZTIMER_MSEC` and
+ * `ZTIMER_SEC` (and on any clock added with
+ * @ref pm_layered_tickless_add_clock()). It then enters the deepest unblocked
+ * mode whose exit latency (see @ref PM_EXIT_LATENCY_US) is not longer than the
+ * time until that timer expires. If no mode is fast enough, the CPU is kept
+ * spinning.
+ *
+ * The number of times each mode was entered and the time spent in it are
+ * recorded and can be read with @ref pm_layered_tickless_get_stats(), or with
+ * the `pm stats` shell command. The time is measured with `ZTIMER_USEC`, or
+ * with `ZTIMER_MSEC` if `ZTIMER_USEC` is not used. With `ztimer_ondemand`,
+ * only the time during which that clock was running anyway is accounted for.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Tickless idle definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pm_layered.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Exit latency of each power mode in microseconds
+ *
+ * Array initializer with @ref PM_NUM_MODES elements, to be defined in the
+ * `periph_cpu.h` of the CPU (like @ref PM_NUM_MODES). Mode 0 is the deepest
+ * mode. Modes without a given latency can be entered regardless of the next
+ * timer.
+ *
+ * No CPU defines the latencies yet, they have to be measured on the hardware.
+ * Building `pm_layered_tickless` fails if they are not defined, as the module
+ * would then always choose the deepest unblocked mode. An application may
+ * define them with `CFLAGS`, e.g.
+ * `CFLAGS += '-DPM_EXIT_LATENCY_US={ 2000, 200, 0 }'`.
+ */
+#if defined(DOXYGEN)
+#  define PM_EXIT_LATENCY_US
+#endif
+
+/**
+ * @brief   Additional clock to take into account for the next timer
+ */
+typedef struct pm_layered_tickless_clock {
+    struct pm_layered_tickless_clock *next; /**< next clock in list */
+    ztimer_clock_t *clock;                  /**< the clock */
+    uint32_t us_per_tick;                   /**< length of a tick of @p clock */
+} pm_layered_tickless_clock_t;
+
+/**
+ * @brief   Tickless idle statistics
+ */
+typedef struct {
+    uint32_t entries[PM_NUM_MODES];     /**< times each mode was entered */
+    uint64_t residency_us[PM_NUM_MODES];    /**< time spent in each mode */
+    /**
+     * @brief   times a shallower mode than allowed by the blockers was chosen
+     *          because of the next timer
+     */
+    uint32_t demotions;
+} pm_layered_tickless_stats_t;
+
+/**
+ * @brief   Adds a clock to take into account for the next timer
+ *
+ * `ZTIMER_USEC`, `ZTIMER_MSEC` and `ZTIMER_SEC` are always taken into account
+ * and must not be added.
+ *
+ * @param[in] entry     the clock to add, fields but
+ *                      pm_layered_tickless_clock_t::next must be set. Must
+ *                      stay valid.
+ */
+void pm_layered_tickless_add_clock(pm_layered_tickless_clock_t *entry);
+
+/**
+ * @brief   Gets the time until the earliest timer of all clocks expires
+ *
+ * @param[out] us       time until the earliest timer expires, saturated at
+ *                      `UINT32_MAX`
+ *
+ * @retval  true    A timer is set, @p us was written
+ * @retval  false   No timer is set on any clock
+ */
+bool pm_layered_tickless_next(uint32_t *us);
+
+/**
+ * @brief   Chooses the power mode for the time until the next timer
+ *
+ * This is called by @ref pm_set_lowest() with interrupts disabled.
+ *
+ * @param[in] mode      deepest mode that is not blocked
+ *
+ * @return  the deepest mode not deeper than @p mode whose exit latency fits
+ *          before the next timer
+ * @return  @ref PM_NUM_MODES if no mode fits
+ */
+unsigned pm_layered_tickless_mode(unsigned mode);
+
+/**
+ * @brief   Enters a power mode and records the time spent in it
+ *
+ * This is called by @ref pm_set_lowest() with interrupts disabled.
+ *
+ * @param[in] mode      mode to enter, less than @ref PM_NUM_MODES
+ */
+void pm_layered_tickless_set(unsigned mode);
+
+/**
+ * @brief   Gets the tickless idle statistics
+ *
+ * @param[out] stats    the statistics
+ */
+void pm_layered_tickless_get_stats(pm_layered_tickless_stats_t *stats);
+
+/**
+ * @brief   Resets the tickless idle statistics
+ */
+void pm_layered_tickless_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
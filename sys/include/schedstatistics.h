@@ -18,6 +18,21 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * With `schedstatistics_cycles`, the DWT cycle counter (Cortex-M3 and up) or
+ * `CLOCK_MONOTONIC` (native) is used instead of `ZTIMER_USEC`, and the time
+ * spent in ISRs is accounted per interrupt (@ref schedstat_isr_t) instead of
+ * to the interrupted thread.
+ *
+ * @warning The DWT cycle counter only counts while the core is clocked. The
+ *          time the CPU spends sleeping in `WFI`, i.e. most of the time of the
+ *          idle thread, is therefore missing from the statistics, and the
+ *          percentages shown by `ps` are relative to the time the CPU was
+ *          awake. Use the default backend to measure how long the CPU idles.
+ *
+ * The 32 bit DWT cycle counter is extended to 64 bit. As it has no overflow
+ * interrupt, a `ZTIMER_MSEC` timer reads it twice per wrap period, which
+ * wakes up the CPU e.g. every 34 s at 64 MHz.
  * @{
  *
  * @file
@@ -30,18 +45,63 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+#if defined(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+/**
+ * @brief   Number of histogram buckets of the run lengths
+ *
+ * Bucket 0 counts runs shorter than 1 µs, bucket `i` counts runs of
+ * [4^(i - 1), 4^i) µs, the last bucket counts all longer runs.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_HIST_NUMOF
+#define CONFIG_SCHEDSTATISTICS_HIST_NUMOF   (8U)
+#endif
+
+/**
+ * @brief   Number of interrupts for which statistics are kept
+ *
+ * The slots are assigned to the interrupts in the order they happen first.
+ * Interrupts not getting a slot are still not accounted to the threads.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_ISR_NUMOF
+#define CONFIG_SCHEDSTATISTICS_ISR_NUMOF    (8U)
+#endif
+
+/**
+ * @brief   Marks an unused @ref schedstat_isr_t
+ */
+#define SCHEDSTAT_IRQ_NONE                  (-1)
+#endif
+
 /**
  *  Scheduler statistics
  */
 typedef struct {
+#if defined(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+    uint64_t laststart;      /**< Time stamp of the last time this thread was
+                                  scheduled to run */
+#else
     uint32_t laststart;      /**< Time stamp of the last time this thread was
                                   scheduled to run */
+#endif
     unsigned int schedules;  /**< How often the thread was scheduled to run */
+#if !defined(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#endif
+#if defined(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+    uint64_t runtime_cycles; /**< The total runtime of this thread in cycles */
+    uint32_t max_cycles;     /**< Longest run of this thread in cycles */
+    /**
+     * @brief   Histogram of the run lengths, see
+     *          @ref CONFIG_SCHEDSTATISTICS_HIST_NUMOF
+     */
+    uint32_t hist[CONFIG_SCHEDSTATISTICS_HIST_NUMOF];
+#endif
 } schedstat_t;
 
 /**
@@ -49,6 +109,72 @@ typedef struct {
  */
 extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#if defined(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+/**
+ * @brief   Interrupt statistics
+ */
+typedef struct {
+    int irq;                 /**< interrupt number, @ref SCHEDSTAT_IRQ_NONE
+                                  if unused */
+    unsigned int count;      /**< How often the interrupt was served */
+    uint64_t runtime_cycles; /**< Time spent in the ISR in cycles, without
+                                  nested ISRs */
+    uint32_t max_cycles;     /**< Longest run of the ISR in cycles */
+    /**
+     * @brief   Histogram of the run lengths, see
+     *          @ref CONFIG_SCHEDSTATISTICS_HIST_NUMOF
+     */
+    uint32_t hist[CONFIG_SCHEDSTATISTICS_HIST_NUMOF];
+} schedstat_isr_t;
+
+/**
+ *  Interrupt statistics table
+ */
+extern schedstat_isr_t sched_isrlist[CONFIG_SCHEDSTATISTICS_ISR_NUMOF];
+
+/**
+ * @brief   Marks the start of an ISR
+ *
+ * To be called by the CPU's interrupt entry code.
+ */
+void schedstat_isr_enter(void);
+
+/**
+ * @brief   Marks the end of an ISR
+ *
+ * To be called by the CPU's interrupt entry code.
+ *
+ * @param[in] irq   number of the interrupt that was served
+ */
+void schedstat_isr_exit(int irq);
+
+/**
+ * @brief   Converts cycles of the counter used for the statistics to
+ *          microseconds
+ *
+ * @param[in] cycles    cycles to convert
+ *
+ * @return  @p cycles in microseconds
+ */
+uint64_t schedstat_cycles_to_us(uint64_t cycles);
+#endif
+
+/**
+ * @brief   Gets the total runtime of a thread in microseconds
+ *
+ * @param[in] stat      statistics of the thread
+ *
+ * @return  runtime in microseconds
+ */
+static inline uint64_t schedstat_runtime_us(const schedstat_t *stat)
+{
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    return schedstat_cycles_to_us(stat->runtime_cycles);
+#else
+    return stat->runtime_us;
+#endif
+}
+
 /**
  *  @brief  Registers the sched statistics callback and sets laststart for
  *          caller thread
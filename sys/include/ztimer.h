@@ -160,6 +160,11 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * For applications with many active timers, the module `ztimer_wheel` stores
+ * the timers of a clock in a hierarchical timer wheel instead, providing
+ * constant time insertion and removal at the price of an additional pointer
+ * per timer and some memory per clock. See @ref sys_ztimer_wheel.
+ *
  *
  * ## Clock extension
  *
@@ -300,6 +305,12 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t **pprev;      /**< pointer to the pointer to this timer,
+                                     only used with @ref sys_ztimer_wheel */
+    uintptr_t check;            /**< pprev XOR the address of the timer, to
+                                     tell set from uninitialized timers */
+#endif
 };
 
 /**
@@ -386,6 +397,10 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    struct ztimer_wheel *wheel;     /**< timer wheel storing the timers
+                                         instead of @ref list, if not NULL  */
+#endif
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
@@ -490,6 +505,21 @@ unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer);
  */
 bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer);
 
+/**
+ * @brief   Get the time until the next timer of a clock expires
+ *
+ * This can be used to find out how long the CPU may sleep, e.g. by the idle
+ * thread.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[out]  ticks       ticks of @p clock until the next timer expires,
+ *                          0 if it is overdue
+ *
+ * @retval  true    A timer is set on @p clock, @p ticks was written
+ * @retval  false   No timer is set on @p clock
+ */
+bool ztimer_next_timeout(ztimer_clock_t *clock, uint32_t *ticks);
+
 /**
  * @brief   Post a message after a delay
  *
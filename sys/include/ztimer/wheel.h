@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_ztimer_wheel ztimer timer wheel
+ * @ingroup     sys_ztimer
+ * @brief       Hierarchical timer wheel storing the timers of a clock
+ *
+ * By default, the timers of a clock are kept in a sorted list, making
+ * ztimer_set() and ztimer_remove() O(n) in the number of active timers. With
+ * the module `ztimer_wheel`, a clock can instead store its timers in a
+ * hierarchical timer wheel, which sets and removes timers in constant time.
+ *
+ * The wheel has @ref CONFIG_ZTIMER_WHEEL_LEVELS levels of
+ * 2^@ref CONFIG_ZTIMER_WHEEL_BITS slots each. A slot of level `n` covers
+ * 2^(n * @ref CONFIG_ZTIMER_WHEEL_BITS) ticks. A timer is put into the slot of
+ * the lowest level that reaches its target time. When the time of a slot of a
+ * level above 0 has come, its timers are moved down to the lower levels
+ * ("cascading"), until they are in level 0, where each slot is a single tick.
+ * A bitmap of the used slots per level allows to find the next slot to
+ * process without scanning the levels. Timers further away than the wheel
+ * covers stay in the highest level and are cascaded once per revolution.
+ *
+ * The underlying timer is programmed to the time of the next slot to
+ * process, so every timer causes up to one interrupt per level it is moved
+ * through, in addition to the one when it triggers.
+ * ztimer_next_timeout() returns the time of that interrupt. Timers that
+ * trigger at the same tick are triggered in the order they were set, as long
+ * as they were set at the same level.
+ *
+ * The wheel costs two additional words per timer and
+ * 2^@ref CONFIG_ZTIMER_WHEEL_BITS * @ref CONFIG_ZTIMER_WHEEL_LEVELS pointers
+ * per clock. With the module, `ZTIMER_USEC`, `ZTIMER_MSEC` and `ZTIMER_SEC`
+ * automatically use a wheel. Other clocks can use one by calling
+ * @ref ztimer_wheel_init().
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer timer wheel API
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of bits of the target time handled by each level
+ *
+ * Each level has 2^CONFIG_ZTIMER_WHEEL_BITS slots, which must not be more than
+ * the bits of an `unsigned int`.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_BITS
+#define CONFIG_ZTIMER_WHEEL_BITS        (4U)
+#endif
+
+/**
+ * @brief   Number of levels of the wheel
+ *
+ * The wheel covers 2^(@ref CONFIG_ZTIMER_WHEEL_BITS * CONFIG_ZTIMER_WHEEL_LEVELS)
+ * ticks, which must not be more than 2^32.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_LEVELS
+#define CONFIG_ZTIMER_WHEEL_LEVELS      (6U)
+#endif
+
+/**
+ * @brief   Number of slots per level
+ */
+#define ZTIMER_WHEEL_SLOTS              (1U << CONFIG_ZTIMER_WHEEL_BITS)
+
+/**
+ * @brief   Timer wheel of a clock
+ */
+typedef struct ztimer_wheel {
+    /**
+     * @brief   Timers by level and slot
+     */
+    ztimer_base_t *slots[CONFIG_ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+    unsigned used[CONFIG_ZTIMER_WHEEL_LEVELS];  /**< used slots per level   */
+    ztimer_base_t *due;         /**< expired timers, in order of expiry     */
+    ztimer_base_t **due_tail;   /**< next pointer of the last expired timer */
+} ztimer_wheel_t;
+
+/**
+ * @brief   Makes a clock store its timers in a wheel
+ *
+ * @pre     No timer is set on @p clock.
+ *
+ * @param[in] clock     clock to use the wheel for
+ * @param[out] wheel    the wheel, must stay valid as long as @p clock is used
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel);
+
+/**
+ * @name    Internal functions used by the ztimer core
+ *
+ * All of these must be called with interrupts disabled. The wheel is based on
+ * the time of the last update of the clock, ztimer_clock_t::list.offset.
+ *
+ * @internal
+ * @{
+ */
+
+/**
+ * @brief   Adds a timer
+ *
+ * @param[in] clock     clock using a wheel
+ * @param[in] entry     timer to add, its offset is relative to the time of
+ *                      the last update
+ */
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Removes a set timer
+ *
+ * @param[in] clock     clock using a wheel
+ * @param[in] entry     timer to remove
+ */
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Updates the wheel to a new time
+ *
+ * Timers expired up to @p now are moved to the list of expired timers, the
+ * time of the last update is set to @p now.
+ *
+ * @param[in] clock     clock using a wheel
+ * @param[in] now       the new time
+ */
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now);
+
+/**
+ * @brief   Removes the first expired timer
+ *
+ * @param[in] clock     clock using a wheel
+ *
+ * @return  the first expired timer
+ * @return  NULL if no timer has expired
+ */
+ztimer_base_t *ztimer_wheel_pop(ztimer_clock_t *clock);
+
+/**
+ * @brief   Gets the time the wheel has to be updated next
+ *
+ * @param[in] clock     clock using a wheel
+ * @param[out] offset   time relative to the last update
+ *
+ * @retval  true    a timer is set, @p offset was written
+ * @retval  false   no timer is set
+ */
+bool ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *offset);
+
+/**
+ * @brief   Checks if a timer is set
+ *
+ * Works on uninitialized timers as well. Takes time linear in the number of
+ * timers set before @p entry in the same slot.
+ *
+ * @param[in] clock     clock using a wheel
+ * @param[in] entry     timer to check
+ *
+ * @retval  true    @p entry is set on @p clock
+ * @retval  false   @p entry is not set, or set on another clock
+ */
+bool ztimer_wheel_is_set(const ztimer_clock_t *clock, const ztimer_base_t *entry);
+
+/**
+ * @brief   Checks if any timer is set
+ *
+ * @param[in] wheel     wheel to check
+ *
+ * @retval  true    no timer is set
+ * @retval  false   at least one timer is set
+ */
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
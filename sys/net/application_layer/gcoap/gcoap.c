@@ -35,6 +35,8 @@
 #include "net/sock/async/event.h"
 #include "net/sock/udp.h"
 #include "net/sock/util.h"
+#include "irq.h"
+#include "log.h"
 #include "mutex.h"
 #include "random.h"
 #include "thread.h"
@@ -59,10 +61,16 @@
 static void *_event_loop(void *arg);
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg);
 static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
-                              uint8_t *buf, size_t len, bool truncated);
+                              uint8_t *buf, size_t buf_size, size_t len, bool truncated,
+                              void **buf_ctx);
 static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type);
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
+static ssize_t _tl_send_pdu(gcoap_socket_t *sock, void **buf_ctx, const void *data,
+                            size_t len, const sock_udp_ep_t *remote,
+                            sock_udp_aux_tx_t *aux);
 static ssize_t _tl_authenticate(gcoap_socket_t *sock, const sock_udp_ep_t *remote,
                                 uint32_t timeout);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len,
@@ -71,6 +79,7 @@ static void _cease_retransmission(gcoap_request_memo_t *memo);
 static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
                           size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 static void _expire_request(gcoap_request_memo_t *memo);
+static void _memo_free(gcoap_request_memo_t *memo);
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote,
                                                    const coap_pkt_t *pkt);
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
@@ -83,6 +92,10 @@ static int _find_resource(gcoap_socket_type_t tl_type,
                           gcoap_listener_t **listener_ptr);
 static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote);
 static int _find_notifier(sock_udp_ep_t **notifier, sock_udp_ep_t *local);
+static void _set_observer(sock_udp_ep_t *observer, const sock_udp_ep_t *remote,
+                          sock_udp_ep_t *notifier, const sock_udp_ep_t *local);
+static void _free_observer(sock_udp_ep_t *observer);
+static void _free_notifier(sock_udp_ep_t *notifier);
 static int _find_obs_memo(gcoap_observe_memo_t **memo,
                           sock_udp_ep_t *remote, sock_udp_ep_t *local,
                           coap_pkt_t *pdu);
@@ -91,6 +104,22 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
 
 static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
                                                 uint16_t last_notify_mid);
+static void _free_obs_memo(gcoap_observe_memo_t *memo);
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+static void _find_obs_memo_resource_remote(gcoap_observe_memo_t **memo,
+                                           const coap_resource_t *resource,
+                                           const sock_udp_ep_t *remote);
+static bool _obs_con_memo_add(gcoap_observe_memo_t *obs_memo, const iolist_t *snips);
+static gcoap_observe_memo_t *_obs_con_memo_pending(const gcoap_request_memo_t *memo);
+static void _obs_con_memos_expire(const gcoap_observe_memo_t *obs_memo);
+static void _on_obs_con_timeout(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                                const sock_udp_ep_t *remote);
+#else
+static inline void _obs_con_memos_expire(const gcoap_observe_memo_t *obs_memo)
+{
+    (void)obs_memo;
+}
+#endif
 
 static nanocoap_cache_entry_t *_cache_lookup_memo(gcoap_request_memo_t *cache_key);
 static void _cache_process(gcoap_request_memo_t *memo,
@@ -108,7 +137,10 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
 static void _dtls_free_up_session(void *arg);
 #endif
 
+#if !IS_USED(MODULE_GCOAP_MEMO_INDEX)
+/* Only used by the linear search for an open request by token */
 static char _ipv6_addr_str[IPV6_ADDR_MAX_STR_LEN];
+#endif
 
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
@@ -116,12 +148,12 @@ const coap_resource_t _default_resources[] = {
 };
 
 static gcoap_listener_t _default_listener = {
-    &_default_resources[0],
-    ARRAY_SIZE(_default_resources),
-    GCOAP_SOCKET_TYPE_UNDEF,
-    NULL,
-    NULL,
-    _request_matcher_default
+    .resources = &_default_resources[0],
+    .resources_len = ARRAY_SIZE(_default_resources),
+    .tl_type = GCOAP_SOCKET_TYPE_UNDEF,
+    .link_encoder = NULL,
+    .next = NULL,
+    .request_matcher = _request_matcher_default,
 };
 
 /* Container for the state of gcoap itself */
@@ -159,6 +191,93 @@ static uint8_t _listen_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
 static sock_udp_t _sock_udp;
 static event_callback_t _receive_from_cache;
 
+#if IS_USED(MODULE_GCOAP_DISPATCH_TRIE)
+/* Node of the resource dispatch trie, nodes and entries are referenced by
+ * their index + 1, so 0 is none */
+typedef struct {
+    const char *seg;                /* path segment, points into a resource path */
+    uint16_t child;                 /* first child */
+    uint16_t sibling;               /* next child of the parent */
+    uint16_t exact;                 /* first resource with this path */
+    uint16_t subtree;               /* first subtree resource whose path
+                                     * continues with a segment prefix */
+    coap_method_flags_t methods;    /* methods of the exact resources */
+    uint8_t seg_len;                /* length of seg */
+} _trie_node_t;
+
+/* Resource in the list of a trie node, in the order of the listener */
+typedef struct {
+    const coap_resource_t *resource;
+    const char *prefix;             /* subtree: prefix of the next segment */
+    uint16_t next;                  /* next resource of the node */
+    uint8_t prefix_len;             /* length of prefix */
+} _trie_entry_t;
+
+static _trie_node_t _trie_nodes[CONFIG_GCOAP_DISPATCH_TRIE_NODES];
+static _trie_entry_t _trie_entries[CONFIG_GCOAP_DISPATCH_TRIE_ENTRIES];
+static uint16_t _trie_nodes_used;
+static uint16_t _trie_entries_used;
+
+static_assert(CONFIG_GCOAP_DISPATCH_TRIE_NODES < UINT16_MAX,
+              "CONFIG_GCOAP_DISPATCH_TRIE_NODES too large");
+static_assert(CONFIG_GCOAP_DISPATCH_TRIE_ENTRIES < UINT16_MAX,
+              "CONFIG_GCOAP_DISPATCH_TRIE_ENTRIES too large");
+#endif
+
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+#define MEMO_INDEX_MASK     (CONFIG_GCOAP_MEMO_INDEX_BUCKETS - 1)
+
+/* Hash table of endpoints, entries are referenced by their index + 1, so 0
+ * is none. The endpoints are stored by the user of the table, unused ones
+ * must not be in the table. */
+typedef struct {
+    sock_udp_ep_t *eps;                 /* endpoints */
+    uint16_t *next;                     /* next endpoint in the same bucket */
+    uint16_t buckets[CONFIG_GCOAP_MEMO_INDEX_BUCKETS];
+} _ep_table_t;
+
+/* Index of an open request, requests are referenced like endpoints */
+typedef struct {
+    uint16_t token_next;                /* next request in the token bucket */
+    uint16_t mid_next;                  /* next request in the MID bucket */
+    uint16_t ep;                        /* interned remote endpoint */
+} _memo_index_t;
+
+static _memo_index_t _memo_index[CONFIG_GCOAP_REQ_WAITING_MAX];
+static uint16_t _memo_token_buckets[CONFIG_GCOAP_MEMO_INDEX_BUCKETS];
+static uint16_t _memo_mid_buckets[CONFIG_GCOAP_MEMO_INDEX_BUCKETS];
+/* number of open requests to a multicast address, which match responses from
+ * any endpoint */
+static uint16_t _memo_multicast;
+
+/* remote endpoints of the open requests, each distinct one stored once */
+static sock_udp_ep_t _memo_eps[CONFIG_GCOAP_REQ_WAITING_MAX];
+static uint16_t _memo_ep_next[CONFIG_GCOAP_REQ_WAITING_MAX];
+static uint16_t _memo_ep_refs[CONFIG_GCOAP_REQ_WAITING_MAX];
+static _ep_table_t _memo_ep_table = { .eps = _memo_eps, .next = _memo_ep_next };
+
+static uint16_t _observer_next[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+static _ep_table_t _observer_table = {
+    .eps = _coap_state.observers,
+    .next = _observer_next,
+};
+static uint16_t _notifier_next[CONFIG_GCOAP_OBS_NOTIFIERS_MAX];
+static _ep_table_t _notifier_table = {
+    .eps = _coap_state.notifiers,
+    .next = _notifier_next,
+};
+
+static_assert((CONFIG_GCOAP_MEMO_INDEX_BUCKETS & MEMO_INDEX_MASK) == 0,
+              "CONFIG_GCOAP_MEMO_INDEX_BUCKETS must be a power of two");
+static_assert(CONFIG_GCOAP_REQ_WAITING_MAX < UINT16_MAX,
+              "CONFIG_GCOAP_REQ_WAITING_MAX too large for gcoap_memo_index");
+#endif
+
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+static_assert(CONFIG_GCOAP_OBS_CON_INTERVAL <= UINT8_MAX,
+              "CONFIG_GCOAP_OBS_CON_INTERVAL too large");
+#endif
+
 #if IS_USED(MODULE_GCOAP_DTLS)
 /* DTLS variables and definitions */
 #define SOCK_DTLS_CLIENT_TAG (2)
@@ -302,7 +421,8 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
         sock_udp_ep_t ep;
         sock_dtls_session_get_udp_ep(&socket.ctx_dtls_session, &ep);
         /* Truncated DTLS messages would already have gotten lost at verification */
-        _process_coap_pdu(&socket, &ep, NULL, _listen_buf, res, false);
+        _process_coap_pdu(&socket, &ep, NULL, _listen_buf, sizeof(_listen_buf),
+                          res, false, NULL);
     }
 }
 
@@ -331,6 +451,7 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
     if (type & SOCK_ASYNC_MSG_RECV) {
         void *stackbuf;
         void *buf_ctx = NULL;
+        uint8_t *buf = _listen_buf;
         bool truncated = false;
         size_t cursor = 0;
         sock_udp_aux_rx_t aux_in = {
@@ -346,6 +467,10 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
          * handler. Also, given that neither nanocoap nor the handler expects
          * to gather scattered data, it'd need to rely on the data coming in a
          * single slice (but that may be a realistic assumption).
+         *
+         * With sock_udp_zero_copy, this is done: the stack provides a datagram
+         * in a single slice, which is claimed as buffer for the request and
+         * the response built in its place, and then sent without copying.
          */
         while (true) {
             ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
@@ -356,6 +481,18 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             if (res == 0) {
                 break;
             }
+#if IS_USED(MODULE_SOCK_UDP_ZERO_COPY)
+            if (cursor == 0) {
+                uint8_t *claimed = sock_udp_buf_claim(&buf_ctx, sizeof(_listen_buf));
+                if (claimed != NULL) {
+                    buf = claimed;
+                    truncated = ((size_t)res > sizeof(_listen_buf));
+                    cursor = truncated ? sizeof(_listen_buf) : (size_t)res;
+                    break;
+                }
+                DEBUG("gcoap: claiming buffer failed, copying\n");
+            }
+#endif
             if (cursor + res > sizeof(_listen_buf)) {
                 res = sizeof(_listen_buf) - cursor;
                 truncated = true;
@@ -384,7 +521,14 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             .socket.udp = sock,
          };
 
-        _process_coap_pdu(&socket, &remote, aux_out_ptr, _listen_buf, cursor, truncated);
+        _process_coap_pdu(&socket, &remote, aux_out_ptr, buf, sizeof(_listen_buf),
+                          cursor, truncated, &buf_ctx);
+#if IS_USED(MODULE_SOCK_UDP_ZERO_COPY)
+        if (buf_ctx != NULL) {
+            /* claimed buffer was not used for a response */
+            sock_udp_buf_free(buf_ctx);
+        }
+#endif
     }
 }
 
@@ -406,7 +550,8 @@ static void _memo_clear_resend_buffer(gcoap_request_memo_t *memo)
 
 /* Processes and evaluates the coap pdu */
 static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
-                              uint8_t *buf, size_t len, bool truncated)
+                              uint8_t *buf, size_t buf_size, size_t len, bool truncated,
+                              void **buf_ctx)
 {
     coap_pkt_t pdu;
     gcoap_request_memo_t *memo = NULL;
@@ -476,15 +621,14 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 
             if (truncated) {
                 /* TBD: Set a Size1 */
-                pdu_len = gcoap_response(&pdu, _listen_buf, sizeof(_listen_buf),
+                pdu_len = gcoap_response(&pdu, buf, buf_size,
                                          COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
             } else {
-                pdu_len = _handle_req(sock, &pdu, _listen_buf,
-                                      sizeof(_listen_buf), remote, aux);
+                pdu_len = _handle_req(sock, &pdu, buf, buf_size, remote, aux);
             }
 
             if (pdu_len > 0) {
-                ssize_t bytes = _tl_send(sock, _listen_buf, pdu_len, remote, aux);
+                ssize_t bytes = _tl_send_pdu(sock, buf_ctx, buf, pdu_len, remote, aux);
                 if (bytes <= 0) {
                     DEBUG("gcoap: send response failed: %" PRIdSIZE "\n", bytes);
                 }
@@ -524,9 +668,8 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                         ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
                         /* copy all options and possible payload from the cached response
                          * to the new response */
-                        assert((uint8_t *)pdu.buf == &_listen_buf[0]);
-                        if (_cache_build_response(ce, &pdu, _listen_buf,
-                                                  sizeof(_listen_buf)) < 0) {
+                        assert((uint8_t *)pdu.buf == buf);
+                        if (_cache_build_response(ce, &pdu, buf, buf_size) < 0) {
                             memo->state = GCOAP_MEMO_ERR;
                         }
                         if (ce->truncated) {
@@ -552,7 +695,7 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                  * was removed on the server side. Then also free the memo here. */
                 if (!observe_notification || (code_class != COAP_CLASS_SUCCESS)) {
                     /* setting the state to unused frees (drops) the memo entry */
-                    memo->state = GCOAP_MEMO_UNUSED;
+                    _memo_free(memo);
                 }
 
                 break;
@@ -588,7 +731,8 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
         coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
         coap_pkt_set_tkl(&pdu, 0);
 
-        ssize_t bytes = _tl_send(sock, buf, sizeof(coap_udp_hdr_t), remote, aux);
+        ssize_t bytes = _tl_send_pdu(sock, buf_ctx, buf, sizeof(coap_udp_hdr_t),
+                                     remote, aux);
         if (bytes <= 0) {
             DEBUG("gcoap: empty response failed: %" PRIdSIZE "\n", bytes);
         }
@@ -657,6 +801,17 @@ static void _on_resp_timeout(void *arg) {
  */
 static void _cease_retransmission(gcoap_request_memo_t *memo) {
     memo->state = GCOAP_MEMO_WAIT;
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+    /* an Observe notification has no response to wait for */
+    if (memo->resp_handler == _on_obs_con_timeout) {
+        gcoap_observe_memo_t *obs_memo = _obs_con_memo_pending(memo);
+
+        if (obs_memo != NULL) {
+            obs_memo->con_pending = false;
+        }
+        memo->resp_handler = NULL;
+    }
+#endif
     /* there is also no response handler to wait for => expire memo */
     if (memo->resp_handler == NULL) {
         event_timeout_clear(&memo->resp_evt_tmout);
@@ -688,7 +843,12 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
             /* find observe registration for resource */
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+            /* a resource may have many observers, only look at the remote's */
+            _find_obs_memo_resource_remote(&resource_memo, resource, remote);
+#else
             _find_obs_memo_resource(&resource_memo, resource);
+#endif
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -738,8 +898,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
                     }
                 }
                 if (observer && notifier) {
-                    memcpy(observer, remote, sizeof(*remote));
-                    memcpy(notifier, &aux->local, sizeof(aux->local));
+                    _set_observer(observer, remote, notifier, &aux->local);
                     memo = &_coap_state.observe_memos[empty_slot];
                     memo->notifier = notifier;
                     memo->observer = observer;
@@ -759,6 +918,11 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
             if (memo->token_len) {
                 memcpy(&memo->token[0], coap_get_token(pdu), memo->token_len);
             }
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+            /* the registration shows that the observer is alive */
+            memo->notify_count = 0;
+            memo->con_pending = false;
+#endif
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -767,19 +931,20 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
+            _obs_con_memos_expire(memo);
             memo->observer = NULL;
             gcoap_observe_memo_t *other_memo = NULL;
             _find_obs_memo(&other_memo, remote, NULL, NULL);
             if (other_memo == NULL) {
                 _find_observer(&observer, remote);
                 if (observer != NULL) {
-                    observer->family = AF_UNSPEC;
+                    _free_observer(observer);
                 }
             }
             other_memo = NULL;
             _find_obs_memo(&other_memo, NULL, memo->notifier, NULL);
             if (!other_memo) {
-                memo->notifier->family = AF_UNSPEC;
+                _free_notifier(memo->notifier);
             }
             memo->notifier = NULL;
         }
@@ -830,6 +995,223 @@ static const coap_resource_t *_match_resource_path_iterator(const gcoap_listener
     return NULL;
 }
 
+#if IS_USED(MODULE_GCOAP_DISPATCH_TRIE)
+static _trie_node_t *_trie_node(uint16_t node)
+{
+    return &_trie_nodes[node - 1];
+}
+
+static uint16_t _trie_node_add(const char *seg, size_t seg_len)
+{
+    if ((_trie_nodes_used == ARRAY_SIZE(_trie_nodes)) || (seg_len > UINT8_MAX)) {
+        return 0;
+    }
+    _trie_nodes[_trie_nodes_used] = (_trie_node_t){
+        .seg = seg,
+        .seg_len = seg_len,
+    };
+    return ++_trie_nodes_used;
+}
+
+/* Finds the child of node for a segment, adds it if add is set */
+static uint16_t _trie_child(uint16_t node, const void *seg, size_t seg_len, bool add)
+{
+    uint16_t *pos = &_trie_node(node)->child;
+
+    while (*pos) {
+        _trie_node_t *child = _trie_node(*pos);
+
+        if ((child->seg_len == seg_len) && !memcmp(child->seg, seg, seg_len)) {
+            return *pos;
+        }
+        pos = &child->sibling;
+    }
+    if (add) {
+        *pos = _trie_node_add(seg, seg_len);
+        return *pos;
+    }
+    return 0;
+}
+
+/* Appends a resource to a list of a node */
+static bool _trie_entry_add(uint16_t *list, const coap_resource_t *resource,
+                            const char *prefix, size_t prefix_len)
+{
+    if ((_trie_entries_used == ARRAY_SIZE(_trie_entries)) ||
+        (prefix_len > UINT8_MAX)) {
+        return false;
+    }
+    while (*list) {
+        list = &_trie_entries[*list - 1].next;
+    }
+    _trie_entries[_trie_entries_used] = (_trie_entry_t){
+        .resource = resource,
+        .prefix = prefix,
+        .prefix_len = prefix_len,
+    };
+    *list = ++_trie_entries_used;
+    return true;
+}
+
+/*
+ * Builds the dispatch trie for the resources of a listener.
+ *
+ * An exact resource is added to the node of its path. A subtree resource
+ * matches all paths that start with its path, which may end within a segment.
+ * It is added to the node of its path without the last segment, with the last
+ * segment as prefix the next segment of a request has to start with. The
+ * resources keep their order, so the first matching resource of the listener
+ * can be found.
+ *
+ * return root node, 0 if the pools are exhausted
+ */
+static uint16_t _trie_build(const gcoap_listener_t *listener)
+{
+    uint16_t nodes_used = _trie_nodes_used;
+    uint16_t entries_used = _trie_entries_used;
+    uint16_t root = _trie_node_add("", 0);
+
+    if (!root) {
+        return 0;
+    }
+    for (size_t i = 0; i < listener->resources_len; i++) {
+        const coap_resource_t *resource = &listener->resources[i];
+        bool subtree = resource->methods & COAP_MATCH_SUBTREE;
+        const char *path = resource->path;
+        const char *end;
+        uint16_t node = root;
+
+        if (path[0] != '/') {
+            /* request paths start with '/', so only an empty subtree matches */
+            if (!subtree || path[0]) {
+                continue;
+            }
+            path = "/";
+        }
+        path++;
+        while ((end = strchr(path, '/'))) {
+            if (!(node = _trie_child(node, path, end - path, true))) {
+                goto fail;
+            }
+            path = end + 1;
+        }
+        if (subtree) {
+            if (!_trie_entry_add(&_trie_node(node)->subtree, resource,
+                                 path, strlen(path))) {
+                goto fail;
+            }
+        }
+        else {
+            if (!(node = _trie_child(node, path, strlen(path), true)) ||
+                !_trie_entry_add(&_trie_node(node)->exact, resource, NULL, 0)) {
+                goto fail;
+            }
+            _trie_node(node)->methods |= resource->methods;
+        }
+    }
+    return root;
+
+fail:
+    LOG_WARNING("gcoap: dispatch trie exhausted, matching paths as strings, "
+                "increase CONFIG_GCOAP_DISPATCH_TRIE_NODES/_ENTRIES\n");
+    _trie_nodes_used = nodes_used;
+    _trie_entries_used = entries_used;
+    return 0;
+}
+
+/* Keeps the first resource of the listener with a matching method */
+static void _trie_match_entry(const _trie_entry_t *entry,
+                              coap_method_flags_t method_flag,
+                              const coap_resource_t **resource,
+                              bool *wrong_method)
+{
+    if (!(entry->resource->methods & method_flag)) {
+        *wrong_method = true;
+    }
+    else if (!*resource || (entry->resource < *resource)) {
+        *resource = entry->resource;
+    }
+}
+
+/*
+ * Matches the Uri-Path options of a request against the dispatch trie, the
+ * same way as the path string is matched by _request_matcher_default().
+ *
+ * return false if the path can only be matched as string
+ */
+static bool _trie_match(const gcoap_listener_t *listener,
+                        const coap_resource_t **resource, coap_pkt_t *pdu,
+                        int *ret)
+{
+    coap_method_flags_t method_flag = coap_method2flag(coap_get_code_detail(pdu));
+    uint16_t node = listener->dispatch_root;
+    uint8_t *opt_pos = NULL;
+    size_t uri_len = 1;
+    bool wrong_method = false;
+
+    *resource = NULL;
+    do {
+        int seg_len;
+        const uint8_t *seg = coap_iterate_option(pdu, COAP_OPT_URI_PATH,
+                                                 &opt_pos, &seg_len);
+
+        if (!seg) {
+            if (opt_pos) {
+                break;
+            }
+            /* no Uri-Path is the path "/", a single empty segment */
+            seg = (const uint8_t *)"";
+            seg_len = 0;
+        }
+        /* the path string can't tell such segments from multiple ones */
+        if (memchr(seg, '/', seg_len)) {
+            return false;
+        }
+        uri_len += seg_len + 1;
+        if (!node) {
+            /* continue to get the length of the path */
+            continue;
+        }
+        for (uint16_t e = _trie_node(node)->subtree; e; e = _trie_entries[e - 1].next) {
+            const _trie_entry_t *entry = &_trie_entries[e - 1];
+
+            if ((entry->prefix_len <= seg_len) &&
+                !memcmp(seg, entry->prefix, entry->prefix_len)) {
+                _trie_match_entry(entry, method_flag, resource, &wrong_method);
+            }
+        }
+        node = _trie_child(node, seg, seg_len, false);
+    } while (opt_pos);
+
+    if (uri_len > CONFIG_NANOCOAP_URI_MAX) {
+        /* does not match anything, like with the path string */
+        *resource = NULL;
+        *ret = GCOAP_RESOURCE_NO_PATH;
+        return true;
+    }
+    if (node && _trie_node(node)->exact) {
+        if (!(_trie_node(node)->methods & method_flag)) {
+            wrong_method = true;
+        }
+        else {
+            for (uint16_t e = _trie_node(node)->exact; e; e = _trie_entries[e - 1].next) {
+                const _trie_entry_t *entry = &_trie_entries[e - 1];
+
+                _trie_match_entry(entry, method_flag, resource, &wrong_method);
+            }
+        }
+    }
+
+    if (*resource) {
+        *ret = GCOAP_RESOURCE_FOUND;
+    }
+    else {
+        *ret = wrong_method ? GCOAP_RESOURCE_WRONG_METHOD : GCOAP_RESOURCE_NO_PATH;
+    }
+    return true;
+}
+#endif
+
 static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
                                     coap_pkt_t *pdu)
@@ -837,6 +1219,12 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     char uri[CONFIG_NANOCOAP_URI_MAX];
     int ret = GCOAP_RESOURCE_NO_PATH;
 
+#if IS_USED(MODULE_GCOAP_DISPATCH_TRIE)
+    if (listener->dispatch_root && _trie_match(listener, resource, pdu, &ret)) {
+        return ret;
+    }
+#endif
+
     if (coap_get_uri_path(pdu, uri) <= 0) {
         /* The Uri-Path options are longer than
          * CONFIG_NANOCOAP_URI_MAX, and thus do not match anything
@@ -927,6 +1315,247 @@ static int _find_resource(gcoap_socket_type_t tl_type,
     return ret;
 }
 
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+static unsigned _ep_hash(const sock_udp_ep_t *ep)
+{
+    const uint8_t *addr = (const uint8_t *)&ep->addr;
+    unsigned len = (ep->family == AF_INET6) ? 16 : 4;
+    uint32_t hash = ep->port;
+
+    for (unsigned i = 0; i < MIN(len, sizeof(ep->addr)); i++) {
+        hash = hash * 31 + addr[i];
+    }
+    return (hash ^ (hash >> 16)) & MEMO_INDEX_MASK;
+}
+
+static uint16_t _ep_table_find(const _ep_table_t *table, const sock_udp_ep_t *ep)
+{
+    for (uint16_t i = table->buckets[_ep_hash(ep)]; i; i = table->next[i - 1]) {
+        if (sock_udp_ep_equal(&table->eps[i - 1], ep)) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+/* adds an endpoint stored in the table, if it is not in the table yet */
+static void _ep_table_add(_ep_table_t *table, const sock_udp_ep_t *ep)
+{
+    uint16_t i = ep - table->eps + 1;
+
+    if (_ep_table_find(table, ep) != i) {
+        uint16_t *bucket = &table->buckets[_ep_hash(ep)];
+
+        table->next[i - 1] = *bucket;
+        *bucket = i;
+    }
+}
+
+static void _ep_table_del(_ep_table_t *table, const sock_udp_ep_t *ep)
+{
+    uint16_t i = ep - table->eps + 1;
+    uint16_t *prev = &table->buckets[_ep_hash(ep)];
+
+    while (*prev && (*prev != i)) {
+        prev = &table->next[*prev - 1];
+    }
+    if (*prev) {
+        *prev = table->next[i - 1];
+    }
+}
+
+/* like _find_endpoint(), using the hash table of the endpoints */
+static int _ep_table_find_slot(const _ep_table_t *table, sock_udp_ep_t **out,
+                               const sock_udp_ep_t *in, unsigned max)
+{
+    uint16_t i = _ep_table_find(table, in);
+
+    if (i) {
+        *out = &table->eps[i - 1];
+        return -1;
+    }
+    *out = NULL;
+    for (unsigned slot = max; slot-- > 0;) {
+        if (table->eps[slot].family == AF_UNSPEC) {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+static unsigned _token_hash(const uint8_t *token, size_t tkl)
+{
+    uint32_t hash = tkl;
+
+    for (unsigned i = 0; i < tkl; i++) {
+        hash = hash * 31 + token[i];
+    }
+    return (hash ^ (hash >> 16)) & MEMO_INDEX_MASK;
+}
+
+static unsigned _mid_hash(uint16_t mid)
+{
+    return (mid ^ (mid >> 8)) & MEMO_INDEX_MASK;
+}
+
+/* returns the index + 1 of the stored endpoint equal to ep, stores it if
+ * needed */
+static uint16_t _memo_ep_intern(const sock_udp_ep_t *ep)
+{
+    uint16_t i = _ep_table_find(&_memo_ep_table, ep);
+
+    if (!i) {
+        /* there are as many endpoints as requests, so one is always free */
+        while (_memo_ep_refs[i]) {
+            i++;
+        }
+        assert(i < CONFIG_GCOAP_REQ_WAITING_MAX);
+        memcpy(&_memo_eps[i], ep, sizeof(*ep));
+        _ep_table_add(&_memo_ep_table, &_memo_eps[i]);
+        i++;
+    }
+    _memo_ep_refs[i - 1]++;
+    return i;
+}
+
+/* Adds an open request to the index, the header and the remote endpoint must
+ * not change until it is removed. */
+static void _memo_index_add(gcoap_request_memo_t *memo)
+{
+    uint16_t i = memo - _coap_state.open_reqs;
+    _memo_index_t *index = &_memo_index[i];
+    coap_udp_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+    uint16_t *bucket;
+
+    /* the index is changed from the gcoap thread and by gcoap_req_send() */
+    unsigned state = irq_disable();
+
+    assert(!index->ep);
+    index->ep = _memo_ep_intern(&memo->remote_ep);
+    if (sock_udp_ep_is_multicast(&memo->remote_ep)) {
+        _memo_multicast++;
+    }
+    bucket = &_memo_token_buckets[_token_hash(coap_hdr_get_token(hdr),
+                                              coap_hdr_get_token_len(hdr))];
+    index->token_next = *bucket;
+    *bucket = i + 1;
+    bucket = &_memo_mid_buckets[_mid_hash(hdr->id)];
+    index->mid_next = *bucket;
+    *bucket = i + 1;
+
+    irq_restore(state);
+}
+
+static void _memo_index_del(gcoap_request_memo_t *memo)
+{
+    uint16_t i = memo - _coap_state.open_reqs;
+    _memo_index_t *index = &_memo_index[i];
+    coap_udp_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+    uint16_t *prev;
+
+    unsigned state = irq_disable();
+
+    if (!index->ep) {
+        /* not added yet */
+        irq_restore(state);
+        return;
+    }
+    prev = &_memo_token_buckets[_token_hash(coap_hdr_get_token(hdr),
+                                            coap_hdr_get_token_len(hdr))];
+    while (*prev != i + 1) {
+        prev = &_memo_index[*prev - 1].token_next;
+    }
+    *prev = index->token_next;
+    prev = &_memo_mid_buckets[_mid_hash(hdr->id)];
+    while (*prev != i + 1) {
+        prev = &_memo_index[*prev - 1].mid_next;
+    }
+    *prev = index->mid_next;
+
+    if (sock_udp_ep_is_multicast(&memo->remote_ep)) {
+        _memo_multicast--;
+    }
+    if (--_memo_ep_refs[index->ep - 1] == 0) {
+        _ep_table_del(&_memo_ep_table, &_memo_eps[index->ep - 1]);
+    }
+    index->ep = 0;
+
+    irq_restore(state);
+}
+
+/* Lookups don't disable IRQs: every update of the index is atomic, and an
+ * endpoint may be re-interned while a lookup runs, so a match is confirmed by
+ * comparing the full endpoint once. */
+static gcoap_request_memo_t *_memo_index_find_token(const sock_udp_ep_t *remote,
+                                                    const uint8_t *token, size_t tkl)
+{
+    uint16_t ep = _ep_table_find(&_memo_ep_table, remote);
+
+    if (!ep && !_memo_multicast) {
+        return NULL;
+    }
+    for (uint16_t i = _memo_token_buckets[_token_hash(token, tkl)]; i;
+         i = _memo_index[i - 1].token_next) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i - 1];
+        coap_udp_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+
+        if ((coap_hdr_get_token_len(hdr) != tkl) ||
+            memcmp(coap_hdr_get_token(hdr), token, tkl)) {
+            continue;
+        }
+        if (_memo_multicast && sock_udp_ep_is_multicast(&memo->remote_ep)) {
+            return memo;
+        }
+        if ((_memo_index[i - 1].ep == ep) &&
+            sock_udp_ep_equal(&memo->remote_ep, remote)) {
+            return memo;
+        }
+    }
+    return NULL;
+}
+
+static gcoap_request_memo_t *_memo_index_find_mid(const sock_udp_ep_t *remote,
+                                                  uint16_t mid)
+{
+    uint16_t ep = _ep_table_find(&_memo_ep_table, remote);
+
+    for (uint16_t i = ep ? _memo_mid_buckets[_mid_hash(mid)] : 0; i;
+         i = _memo_index[i - 1].mid_next) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i - 1];
+
+        if ((_memo_index[i - 1].ep == ep) &&
+            (gcoap_request_memo_get_hdr(memo)->id == mid) &&
+            sock_udp_ep_equal(&memo->remote_ep, remote)) {
+            return memo;
+        }
+    }
+    return NULL;
+}
+
+static void _memo_index_init(void)
+{
+    memset(_memo_index, 0, sizeof(_memo_index));
+    memset(_memo_token_buckets, 0, sizeof(_memo_token_buckets));
+    memset(_memo_mid_buckets, 0, sizeof(_memo_mid_buckets));
+    memset(_memo_ep_refs, 0, sizeof(_memo_ep_refs));
+    memset(_memo_ep_table.buckets, 0, sizeof(_memo_ep_table.buckets));
+    memset(_observer_table.buckets, 0, sizeof(_observer_table.buckets));
+    memset(_notifier_table.buckets, 0, sizeof(_notifier_table.buckets));
+    _memo_multicast = 0;
+}
+#else
+static inline void _memo_index_add(gcoap_request_memo_t *memo) { (void)memo; }
+static inline void _memo_index_del(gcoap_request_memo_t *memo) { (void)memo; }
+static inline void _memo_index_init(void) { }
+#endif
+
+/* Drops an open request, the state of an unused memo must only be set here */
+static void _memo_free(gcoap_request_memo_t *memo)
+{
+    _memo_index_del(memo);
+    memo->state = GCOAP_MEMO_UNUSED;
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -940,6 +1569,10 @@ static int _find_resource(gcoap_socket_type_t tl_type,
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
                                                      const uint8_t *token, size_t tkl)
 {
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    return _memo_index_find_token(remote, token, tkl);
+#else
+
     for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
         if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
             continue;
@@ -995,6 +1628,7 @@ static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote
         return memo;
     }
     return NULL;
+#endif
 }
 
 /*
@@ -1029,6 +1663,10 @@ static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote,
 {
     /* mid is in network byte order */
     uint16_t mid = coap_get_udp_hdr_const(pkt)->id;
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    return _memo_index_find_mid(remote, mid);
+#else
+
     for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
         if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
             continue;
@@ -1042,6 +1680,7 @@ static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote,
         }
     }
     return NULL;
+#endif
 }
 
 /* Calls handler callback on receipt of a timeout message. */
@@ -1060,7 +1699,7 @@ static void _expire_request(gcoap_request_memo_t *memo)
             memo->resp_handler(memo, &req, NULL);
         }
         _memo_clear_resend_buffer(memo);
-        memo->state = GCOAP_MEMO_UNUSED;
+        _memo_free(memo);
     }
     else {
         /* Response already handled; timeout must have fired while response */
@@ -1087,6 +1726,7 @@ static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t le
     return plen;
 }
 
+#if !IS_USED(MODULE_GCOAP_MEMO_INDEX)
 /*
  * Find registered observer or notification endpoint for a remote or local address and port.
  *
@@ -1113,17 +1753,56 @@ static int _find_endpoint(sock_udp_ep_t **out, sock_udp_ep_t *in, unsigned max)
     }
     return empty_slot;
 }
+#endif
 
 static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
 {
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    return _ep_table_find_slot(&_observer_table, observer, remote,
+                               CONFIG_GCOAP_OBS_CLIENTS_MAX);
+#else
     *observer = _coap_state.observers;
     return _find_endpoint(observer, remote, CONFIG_GCOAP_OBS_CLIENTS_MAX);
+#endif
 }
 
 static int _find_notifier(sock_udp_ep_t **notifier, sock_udp_ep_t *local)
 {
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    return _ep_table_find_slot(&_notifier_table, notifier, local,
+                               CONFIG_GCOAP_OBS_NOTIFIERS_MAX);
+#else
     *notifier = _coap_state.notifiers;
     return _find_endpoint(notifier, local, CONFIG_GCOAP_OBS_NOTIFIERS_MAX);
+#endif
+}
+
+/* Stores an observer and the notifier for it, they may be in use already */
+static void _set_observer(sock_udp_ep_t *observer, const sock_udp_ep_t *remote,
+                          sock_udp_ep_t *notifier, const sock_udp_ep_t *local)
+{
+    memcpy(observer, remote, sizeof(*remote));
+    memcpy(notifier, local, sizeof(*local));
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    _ep_table_add(&_observer_table, observer);
+    _ep_table_add(&_notifier_table, notifier);
+#endif
+}
+
+static void _free_observer(sock_udp_ep_t *observer)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    _ep_table_del(&_observer_table, observer);
+#endif
+    observer->family = AF_UNSPEC;
+}
+
+static void _free_notifier(sock_udp_ep_t *notifier)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_INDEX)
+    _ep_table_del(&_notifier_table, notifier);
+#endif
+    notifier->family = AF_UNSPEC;
 }
 
 /*
@@ -1210,28 +1889,157 @@ static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
         }
 
         if (stale_obs_memo) {
-            stale_obs_memo->observer = NULL; /* clear memo */
-             /* check if no other memo is referencing the same local endpoint ...  */
-            gcoap_observe_memo_t *other_memo = NULL;
-            _find_obs_memo(&other_memo, NULL, stale_obs_memo->notifier, NULL);
-            if (!other_memo) {
-                /* ... if not -> also free the notifier entry */
-                stale_obs_memo->notifier->family = AF_UNSPEC;
-            }
-            /* then unreference notifier */
-            stale_obs_memo->notifier = NULL;
-
-            /* check if the observer has more observe memos registered... */
-            stale_obs_memo = NULL;
-            _find_obs_memo(&stale_obs_memo, observer, NULL, NULL);
-            if (stale_obs_memo == NULL) {
-                /* ... if not -> also free the observer entry */
-                observer->family = AF_UNSPEC;
-            }
+            _free_obs_memo(stale_obs_memo);
         }
     }
 }
 
+/* Removes an observe registration, and its observer and notifier if no other
+ * registration references them */
+static void _free_obs_memo(gcoap_observe_memo_t *memo)
+{
+    sock_udp_ep_t *observer = memo->observer;
+
+    _obs_con_memos_expire(memo);
+    memo->observer = NULL; /* clear memo */
+     /* check if no other memo is referencing the same local endpoint ...  */
+    gcoap_observe_memo_t *other_memo = NULL;
+    _find_obs_memo(&other_memo, NULL, memo->notifier, NULL);
+    if (!other_memo) {
+        /* ... if not -> also free the notifier entry */
+        _free_notifier(memo->notifier);
+    }
+    /* then unreference notifier */
+    memo->notifier = NULL;
+
+    /* check if the observer has more observe memos registered... */
+    other_memo = NULL;
+    _find_obs_memo(&other_memo, observer, NULL, NULL);
+    if (other_memo == NULL) {
+        /* ... if not -> also free the observer entry */
+        _free_observer(observer);
+    }
+}
+
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+/*
+ * Tracks a confirmable notification in a request memo, so it is retransmitted
+ * like a confirmable request until it is acknowledged.
+ *
+ * obs_memo[in]   Registration the notification is sent for
+ * snips[in]      Notification PDU
+ *
+ * return         true if the notification is tracked, false if no memo or
+ *                resend buffer is available
+ */
+static bool _obs_con_memo_add(gcoap_observe_memo_t *obs_memo, const iolist_t *snips)
+{
+    gcoap_request_memo_t *memo = NULL;
+    uint8_t *pdu_buf = NULL;
+    size_t len = iolist_size(snips);
+
+    if (len > CONFIG_GCOAP_PDU_BUF_SIZE) {
+        return false;
+    }
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
+            memo = &_coap_state.open_reqs[i];
+            break;
+        }
+    }
+    for (int i = 0; i < CONFIG_GCOAP_RESEND_BUFS_MAX; i++) {
+        if (!_coap_state.resend_bufs[i][0]) {
+            pdu_buf = &_coap_state.resend_bufs[i][0];
+            break;
+        }
+    }
+    if (!memo || !pdu_buf) {
+        DEBUG("gcoap: no space to track confirmable notification\n");
+        return false;
+    }
+
+    iolist_to_buffer(snips, pdu_buf, len);
+    memo->msg.data.pdu_buf = pdu_buf;
+    memo->msg.data.pdu_len = len;
+    memo->send_limit = CONFIG_COAP_MAX_RETRANSMIT;
+    memo->state = GCOAP_MEMO_RETRANSMIT;
+    memo->resp_handler = _on_obs_con_timeout;
+    memo->context = obs_memo;
+    memcpy(&memo->remote_ep, obs_memo->observer, sizeof(sock_udp_ep_t));
+    memo->socket = obs_memo->socket;
+    _memo_index_add(memo);
+
+    uint32_t timeout = (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS;
+#if CONFIG_COAP_RANDOM_FACTOR_1000 > 1000
+    timeout = random_uint32_range(timeout, TIMEOUT_RANGE_END);
+#endif
+    event_callback_init(&memo->resp_tmout_cb, _on_resp_timeout, memo);
+    event_timeout_ztimer_init(&memo->resp_evt_tmout, ZTIMER_MSEC, &_queue,
+                              &memo->resp_tmout_cb.super);
+    event_timeout_set(&memo->resp_evt_tmout, timeout);
+    return true;
+}
+
+/*
+ * Finds the registration a confirmable notification was sent for.
+ *
+ * memo[in]       Memo tracking the notification
+ *
+ * return         Registration, or NULL if it was removed or is waiting for
+ *                the acknowledgment of another notification
+ */
+static gcoap_observe_memo_t *_obs_con_memo_pending(const gcoap_request_memo_t *memo)
+{
+    gcoap_observe_memo_t *obs_memo = memo->context;
+    uint16_t msgid = ntohs(gcoap_request_memo_get_hdr(memo)->id);
+
+    if ((obs_memo->observer == NULL) || !obs_memo->con_pending ||
+        (obs_memo->con_msgid != msgid)) {
+        return NULL;
+    }
+    return obs_memo;
+}
+
+/*
+ * Stops retransmitting the confirmable notifications of a registration that
+ * is removed, so their memos and resend buffers become available again.
+ *
+ * obs_memo[in]   Registration being removed
+ */
+static void _obs_con_memos_expire(const gcoap_observe_memo_t *obs_memo)
+{
+    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+
+        if (((memo->state == GCOAP_MEMO_RETRANSMIT) ||
+             (memo->state == GCOAP_MEMO_WAIT)) &&
+            (memo->resp_handler == _on_obs_con_timeout) &&
+            (memo->context == obs_memo)) {
+            /* the registration is gone, there is nothing left to notify */
+            memo->resp_handler = NULL;
+            event_timeout_clear(&memo->resp_evt_tmout);
+            _expire_request(memo);
+        }
+    }
+}
+
+/* Removes the registration of an observer that did not acknowledge a
+ * confirmable notification (RFC 7641, sec. 4.5) */
+static void _on_obs_con_timeout(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                                const sock_udp_ep_t *remote)
+{
+    (void)pdu;
+    (void)remote;
+    gcoap_observe_memo_t *obs_memo = _obs_con_memo_pending(memo);
+
+    if (obs_memo != NULL) {
+        DEBUG("gcoap: observer did not acknowledge, removing it\n");
+        obs_memo->con_pending = false;
+        _free_obs_memo(obs_memo);
+    }
+}
+#endif
+
 /*
  * Find registered observe memo for a resource.
  *
@@ -1251,6 +2059,24 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
     }
 }
 
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+/* like _find_obs_memo_resource(), for the registration of a remote endpoint */
+static void _find_obs_memo_resource_remote(gcoap_observe_memo_t **memo,
+                                           const coap_resource_t *resource,
+                                           const sock_udp_ep_t *remote)
+{
+    *memo = NULL;
+    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        if (_coap_state.observe_memos[i].observer != NULL
+                && _coap_state.observe_memos[i].resource == resource
+                && sock_udp_ep_equal(_coap_state.observe_memos[i].observer, remote)) {
+            *memo = &_coap_state.observe_memos[i];
+            break;
+        }
+    }
+}
+#endif
+
 /*
  * Transport layer functions
  */
@@ -1279,13 +2105,44 @@ static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type)
     return 0;
 }
 
+/* Sends a PDU built in the receive buffer, which is consumed if it is a
+ * zero-copy buffer (buf_ctx set) */
+static ssize_t _tl_send_pdu(gcoap_socket_t *sock, void **buf_ctx, const void *data,
+                            size_t len, const sock_udp_ep_t *remote,
+                            sock_udp_aux_tx_t *aux)
+{
+#if IS_USED(MODULE_SOCK_UDP_ZERO_COPY)
+    if ((buf_ctx != NULL) && (*buf_ctx != NULL)) {
+        void *ctx = *buf_ctx;
+
+        assert(sock->type == GCOAP_SOCKET_TYPE_UDP);
+        *buf_ctx = NULL;
+        return sock_udp_send_buf_aux(sock->socket.udp, ctx, len, remote, aux);
+    }
+#else
+    (void)buf_ctx;
+#endif
+    return _tl_send(sock, data, len, remote, aux);
+}
+
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    const iolist_t snip = {
+        .iol_base = (void *)data,
+        .iol_len = len,
+    };
+
+    return _tl_sendv(sock, &snip, remote, aux);
+}
+
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
     ssize_t res = -1;
     switch (sock->type) {
         case GCOAP_SOCKET_TYPE_UDP:
-            res = sock_udp_send_aux(sock->socket.udp, data, len, remote, aux);
+            res = sock_udp_sendv_aux(sock->socket.udp, snips, remote, aux);
             break;
 #if IS_USED(MODULE_GCOAP_DTLS)
         case GCOAP_SOCKET_TYPE_DTLS:
@@ -1300,8 +2157,8 @@ static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
             }
 
             /* send application data */
-            res = sock_dtls_send(sock->socket.dtls, &sock->ctx_dtls_session, data, len,
-                                    SOCK_NO_TIMEOUT);
+            res = sock_dtls_sendv(sock->socket.dtls, &sock->ctx_dtls_session, snips,
+                                  SOCK_NO_TIMEOUT);
             switch (res) {
             case -EHOSTUNREACH:
             case -ENOTCONN:
@@ -1471,7 +2328,7 @@ static void _receive_from_cache_cb(void *ctx)
                 memo->state = (ce->truncated) ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 memo->resp_handler(memo, &pdu, &memo->remote_ep);
                 _memo_clear_resend_buffer(memo);
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
             }
         }
     }
@@ -1615,6 +2472,7 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
+    _memo_index_init();
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
@@ -1622,6 +2480,10 @@ kernel_pid_t gcoap_init(void)
     if (IS_USED(MODULE_NANOCOAP_CACHE)) {
         nanocoap_cache_init();
     }
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+    /* stale entries are removed in the gcoap thread, which uses the cache */
+    nanocoap_cache_expire_init(&_queue);
+#endif
     /* initialize the forward proxy operation, if compiled */
     if (IS_ACTIVE(MODULE_GCOAP_FORWARD_PROXY)) {
         gcoap_forward_proxy_init();
@@ -1661,6 +2523,9 @@ void gcoap_register_listener(gcoap_listener_t *listener)
 
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
+#if IS_USED(MODULE_GCOAP_DISPATCH_TRIE)
+        listener->dispatch_root = _trie_build(listener);
+#endif
     }
 }
 
@@ -1733,7 +2598,7 @@ int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
     obs_req_memo = _find_req_memo_by_token(remote, token, tokenlen);
     if (obs_req_memo) {
         /* forget the existing observe memo. */
-        obs_req_memo->state = GCOAP_MEMO_UNUSED;
+        _memo_free(obs_req_memo);
         res = 0;
     }
 
@@ -1787,7 +2652,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
 
             if (res < 0) {
                 DEBUG("gcoap: Error from cache check");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return res;
             }
@@ -1800,7 +2665,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
              * the provided buffer once is possible */
             if (len > CONFIG_GCOAP_PDU_BUF_SIZE) {
                 DEBUG("gcoap: Request too large for retransmit buffer");
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 mutex_unlock(&_coap_state.lock);
                 return -EINVAL;
             }
@@ -1825,7 +2690,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
                 memo->state = GCOAP_MEMO_RETRANSMIT;
             }
             else {
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
                 DEBUG("gcoap: no space for PDU in resend bufs\n");
             }
             break;
@@ -1836,10 +2701,13 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             timeout = CONFIG_GCOAP_NON_TIMEOUT_MSEC;
             break;
         default:
-            memo->state = GCOAP_MEMO_UNUSED;
+            _memo_free(memo);
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            _memo_index_add(memo);
+        }
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
@@ -1897,7 +2765,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             if (timeout > 0) {
                 event_timeout_clear(&memo->resp_evt_tmout);
             }
-            memo->state = GCOAP_MEMO_UNUSED;
+            _memo_free(memo);
     }
         DEBUG("gcoap: sock send failed: %" PRIdSIZE "\n", res);
     }
@@ -1986,6 +2854,85 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
     return ret <= 0 ? 0 : (size_t)ret;
 }
 
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+size_t gcoap_obs_send_all(const uint8_t *buf, size_t len,
+                          const coap_resource_t *resource)
+{
+    const coap_udp_hdr_t *hdr = (const coap_udp_hdr_t *)buf;
+    size_t hdrlen = sizeof(*hdr) + coap_hdr_tkl_ext_len(hdr) +
+                    coap_hdr_get_token_len(hdr);
+    size_t sent = 0;
+
+    assert(len >= hdrlen);
+    /* options and payload are the same for every observer */
+    iolist_t body = {
+        .iol_base = (uint8_t *)buf + hdrlen,
+        .iol_len = len - hdrlen,
+    };
+
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        gcoap_observe_memo_t *memo = &_coap_state.observe_memos[i];
+        /* room for an extended token length, see coap_build_udp_hdr() */
+        uint8_t memo_hdr[sizeof(coap_udp_hdr_t) + 2 + GCOAP_TOKENLEN_MAX];
+        uint8_t type = COAP_TYPE_NON;
+
+        if ((memo->observer == NULL) || (memo->resource != resource)) {
+            continue;
+        }
+#if CONFIG_GCOAP_OBS_CON_INTERVAL
+        if (memo->notify_count < CONFIG_GCOAP_OBS_CON_INTERVAL) {
+            memo->notify_count++;
+        }
+        /* only one confirmable notification at a time is retransmitted */
+        if ((memo->notify_count >= CONFIG_GCOAP_OBS_CON_INTERVAL) && !memo->con_pending) {
+            type = COAP_TYPE_CON;
+        }
+#endif
+
+        uint16_t msgid = gcoap_next_msg_id();
+        ssize_t memo_hdrlen = coap_build_udp_hdr(memo_hdr, sizeof(memo_hdr), type,
+                                                 &memo->token[0], memo->token_len,
+                                                 hdr->code, msgid);
+        if (memo_hdrlen <= 0) {
+            continue;
+        }
+
+        iolist_t snips = {
+            .iol_next = &body,
+            .iol_base = memo_hdr,
+            .iol_len = memo_hdrlen,
+        };
+        if (type == COAP_TYPE_CON) {
+            if (_obs_con_memo_add(memo, &snips)) {
+                memo->notify_count = 0;
+                memo->con_msgid = msgid;
+                memo->con_pending = true;
+            }
+            else {
+                /* try again with the next notification */
+                memo_hdrlen = coap_build_udp_hdr(memo_hdr, sizeof(memo_hdr), COAP_TYPE_NON,
+                                                 &memo->token[0], memo->token_len,
+                                                 hdr->code, msgid);
+                snips.iol_len = memo_hdrlen;
+            }
+        }
+        /* Store message ID of the last notification sent, to match an RST */
+        memo->last_msgid = msgid;
+
+        sock_udp_aux_tx_t aux = { 0 };
+        if (memo->notifier) {
+            memcpy(&aux.local, memo->notifier, sizeof(*memo->notifier));
+            aux.flags = SOCK_AUX_SET_LOCAL;
+        }
+        if (_tl_sendv(&memo->socket, &snips, memo->observer, &aux) > 0) {
+            sent++;
+        }
+    }
+    mutex_unlock(&_coap_state.lock);
+    return sent;
+}
+#endif
+
 uint8_t gcoap_op_state(void)
 {
     uint8_t count = 0;
@@ -23,21 +23,175 @@
 #include "kernel_defines.h"
 #include "net/nanocoap/cache.h"
 #include "hashes/sha256.h"
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+#include "event/callback.h"
+#include "event/timeout.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static int _cache_replacement_lru(void);
+#define BUCKET_MASK     (CONFIG_NANOCOAP_CACHE_BUCKETS - 1)
+
+static_assert((CONFIG_NANOCOAP_CACHE_BUCKETS & BUCKET_MASK) == 0,
+              "CONFIG_NANOCOAP_CACHE_BUCKETS must be a power of two");
+static_assert(CONFIG_NANOCOAP_CACHE_BUCKETS <= 0x10000,
+              "CONFIG_NANOCOAP_CACHE_BUCKETS too large");
+static_assert(CONFIG_NANOCOAP_CACHE_KEY_LENGTH >= 2,
+              "CONFIG_NANOCOAP_CACHE_KEY_LENGTH too small for the hash table");
+static_assert(!(IS_USED(MODULE_NANOCOAP_CACHE_LFU) && IS_USED(MODULE_NANOCOAP_CACHE_GDSF)),
+              "only one of nanocoap_cache_lfu and nanocoap_cache_gdsf can be used");
+
+/* fixed point factor of the GDSF priority of an entry, hits / size */
+#define GDSF_SCALE      (1U << 10)
+
 static int _cache_update_lru(clist_node_t *node);
+#if IS_USED(MODULE_NANOCOAP_CACHE_LFU)
+static int _cache_replacement_lfu(void);
+static int _cache_update_lfu(clist_node_t *node);
+#elif IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+static int _cache_replacement_gdsf(void);
+static int _cache_update_gdsf(clist_node_t *node);
+#else
+static int _cache_replacement_lru(void);
+#endif
 
 static clist_node_t _cache_list_head = { NULL };
 static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
-
+static nanocoap_cache_entry_t *_buckets[CONFIG_NANOCOAP_CACHE_BUCKETS];
+static nanocoap_cache_stats_t _stats;
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_LFU)
+static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lfu;
+static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lfu;
+#elif IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_gdsf;
+static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_gdsf;
+
+/* inflation value, priority of the last replaced entry */
+static uint32_t _gdsf_inflation;
+#else
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
+#endif
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+static void _expire(void *arg);
+
+static event_queue_t *_expire_queue;
+static event_callback_t _expire_event = EVENT_CALLBACK_INIT(_expire, NULL);
+static event_timeout_t _expire_timeout;
+/* first second at which an entry becomes stale, valid if _expire_pending */
+static uint32_t _expire_at;
+static bool _expire_pending;
+#endif
+
+static nanocoap_cache_entry_t **_bucket(const uint8_t *cache_key)
+{
+    /* the cache key is a prefix of a SHA-256 digest, so any bits of it are
+     * as good as a hash */
+    return &_buckets[(cache_key[0] | (cache_key[1] << 8)) & BUCKET_MASK];
+}
+
+static int _cache_update_lru(clist_node_t *node)
+{
+    if (clist_remove(&_cache_list_head, node)) {
+        /* Move an accessed node to the end of the list. Least
+         * recently used nodes are at the beginning of this list */
+        clist_rpush(&_cache_list_head, node);
+        return 0;
+    }
+    return -1;
+}
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_LFU) || IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+/* finds the entry with the lowest value of less(), the least recently used
+ * one of equal entries */
+static nanocoap_cache_entry_t *_find_min(bool (*less)(const nanocoap_cache_entry_t *,
+                                                      const nanocoap_cache_entry_t *))
+{
+    clist_node_t *node = _cache_list_head.next;
+    nanocoap_cache_entry_t *min = NULL;
+
+    if (!node) {
+        return NULL;
+    }
+    do {
+        /* the list head points to the last node, so start with the first */
+        node = node->next;
+        nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+        if (!min || less(ce, min)) {
+            min = ce;
+        }
+    } while (node != _cache_list_head.next);
+
+    return min;
+}
+#endif
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_LFU)
+static bool _less_hits(const nanocoap_cache_entry_t *a, const nanocoap_cache_entry_t *b)
+{
+    return a->hits < b->hits;
+}
+
+static int _cache_replacement_lfu(void)
+{
+    nanocoap_cache_entry_t *lfu_ce = _find_min(_less_hits);
+
+    if (!lfu_ce) {
+        return -1;
+    }
+    return nanocoap_cache_del(lfu_ce);
+}
+
+static int _cache_update_lfu(clist_node_t *node)
+{
+    nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+
+    if (ce->hits < UINT16_MAX) {
+        ce->hits++;
+    }
+    return _cache_update_lru(node);
+}
+#elif IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+static bool _less_priority(const nanocoap_cache_entry_t *a, const nanocoap_cache_entry_t *b)
+{
+    /* the inflation value may wrap around */
+    return (int32_t)(a->priority - b->priority) < 0;
+}
+
+static void _gdsf_set_priority(nanocoap_cache_entry_t *ce)
+{
+    size_t size = ce->response_len ? ce->response_len : 1;
+
+    ce->priority = _gdsf_inflation + (ce->hits * GDSF_SCALE) / size;
+}
+
+static int _cache_replacement_gdsf(void)
+{
+    nanocoap_cache_entry_t *ce = _find_min(_less_priority);
+
+    if (!ce) {
+        return -1;
+    }
+    _gdsf_inflation = ce->priority;
+    return nanocoap_cache_del(ce);
+}
+
+static int _cache_update_gdsf(clist_node_t *node)
+{
+    nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
 
+    if (ce->hits < UINT16_MAX) {
+        ce->hits++;
+    }
+    _gdsf_set_priority(ce);
+    return _cache_update_lru(node);
+}
+#else
 static int _cache_replacement_lru(void)
 {
     clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
@@ -50,29 +204,96 @@ static int _cache_replacement_lru(void)
     nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
     return nanocoap_cache_del(lru_ce);
 }
+#endif
 
-static int _cache_update_lru(clist_node_t *node)
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+static void _expire_schedule(uint32_t max_age)
 {
-    if (clist_remove(&_cache_list_head, node)) {
-        /* Move an accessed node to the end of the list. Least
-         * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
-        return 0;
+    /* an entry is stale one second after its Max-Age */
+    uint32_t at = max_age + 1;
+
+    if (!_expire_queue ||
+        (_expire_pending && ((int32_t)(at - _expire_at) >= 0))) {
+        return;
     }
-    return -1;
+
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+    _expire_at = at;
+    _expire_pending = true;
+    event_timeout_set(&_expire_timeout,
+                      ((int32_t)(at - now) > 0) ? at - now : 0);
+}
+
+static void _expire(void *arg)
+{
+    (void)arg;
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+
+    _expire_pending = false;
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_BUCKETS; i++) {
+        nanocoap_cache_entry_t *ce = _buckets[i];
+
+        while (ce) {
+            nanocoap_cache_entry_t *next = ce->bucket_next;
+
+            if (nanocoap_cache_entry_is_stale(ce, now)) {
+                DEBUG("nanocoap_cache: entry %p expired\n", (void *)ce);
+                nanocoap_cache_del(ce);
+                _stats.expirations++;
+            }
+            else {
+                _expire_schedule(ce->max_age);
+            }
+            ce = next;
+        }
+    }
+}
+
+void nanocoap_cache_expire_init(event_queue_t *queue)
+{
+    _expire_queue = queue;
+    _expire_pending = false;
+    event_timeout_ztimer_init(&_expire_timeout, ZTIMER_SEC, queue,
+                              &_expire_event.super);
+}
+#endif
+
+static void _set_max_age(nanocoap_cache_entry_t *ce, uint32_t max_age)
+{
+    ce->max_age = max_age;
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+    _expire_schedule(max_age);
+#endif
 }
 
 void nanocoap_cache_init(void)
 {
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+    if (_expire_queue) {
+        event_timeout_clear(&_expire_timeout);
+        event_cancel(_expire_queue, &_expire_event.super);
+        _expire_pending = false;
+    }
+#endif
+#if IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+    _gdsf_inflation = 0;
+#endif
     _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(_buckets, 0, sizeof(_buckets));
+    memset(&_stats, 0, sizeof(_stats));
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
     }
 }
 
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
+}
+
 size_t nanocoap_cache_used_count(void)
 {
     return clist_count(&_cache_list_head);
@@ -154,31 +375,29 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
+static nanocoap_cache_entry_t *_lookup(const uint8_t *cache_key)
 {
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
-
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
+    for (nanocoap_cache_entry_t *ce = *_bucket(cache_key); ce; ce = ce->bucket_next) {
+        if (!memcmp(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+            return ce;
+        }
     }
-    return 0;
+    return NULL;
 }
 
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
+nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *cache_key)
 {
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
-}
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
 
-nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
-{
-    clist_node_t *node = _nanocoap_cache_foreach(key);
-
-    if (node) {
-        _update_strategy(node);
+    if (ce) {
+        _stats.hits++;
+        _update_strategy(&ce->node);
+    }
+    else {
+        _stats.misses++;
     }
 
-    return container_of(node, nanocoap_cache_entry_t, node);
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -198,8 +417,7 @@ nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
 nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigned request_method,
                                                const coap_pkt_t *resp, size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -212,7 +430,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
         if (ce) {
             /* set max_age to now(), so that the cache is considered
              * stale immdiately */
-            ce->max_age = ztimer_now(ZTIMER_SEC);
+            _set_max_age(ce, ztimer_now(ZTIMER_SEC));
         }
     }
     /* When a cache that recognizes and processes the ETag response
@@ -231,7 +449,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
             /* refresh max_age() */
             uint32_t max_age = 60;
             coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
-            ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
+            _set_max_age(ce, ztimer_now(ZTIMER_SEC) + max_age);
         }
         /* TODO: handle the copying of the new options (if changed) */
     }
@@ -242,7 +460,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
         if (ce) {
             /* set max_age to now(), so that the cache is considered
              * stale immdiately */
-            ce->max_age = ztimer_now(ZTIMER_SEC);
+            _set_max_age(ce, ztimer_now(ZTIMER_SEC));
         }
     }
     /* This response is cacheable: Caches can use the Max-Age Option
@@ -259,6 +477,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
 
     return ce;
 }
+
 static nanocoap_cache_entry_t *_nanocoap_cache_pop(void)
 {
     clist_node_t *node;
@@ -277,7 +496,7 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
     bool add_to_cache = false;
 
     if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
@@ -286,7 +505,11 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
         return NULL;
     }
 
-    if (!ce) {
+    if (ce) {
+        /* storing a response again counts as access */
+        _update_strategy(&ce->node);
+    }
+    else {
         /* did not find .. get an empty cache container */
         ce = _nanocoap_cache_pop();
         add_to_cache = true;
@@ -298,6 +521,7 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
         if (_replacement_strategy()) {
             return NULL;
         }
+        _stats.evictions++;
         /* could remove an entry */
         ce = _nanocoap_cache_pop();
         add_to_cache = true;
@@ -318,11 +542,22 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     /* default value is 60 seconds, if MAX_AGE not present */
     uint32_t max_age = 60;
     coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
-    ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
+    _set_max_age(ce, ztimer_now(ZTIMER_SEC) + max_age);
 
     if (add_to_cache) {
+        nanocoap_cache_entry_t **bucket = _bucket(cache_key);
+
+        ce->bucket_next = *bucket;
+        *bucket = ce;
         clist_rpush(&_cache_list_head, &ce->node);
+#if IS_USED(MODULE_NANOCOAP_CACHE_LFU) || IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+        ce->hits = 1;
+#endif
     }
+#if IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+    /* the size of the response may have changed */
+    _gdsf_set_priority(ce);
+#endif
 
     return ce;
 }
@@ -344,14 +579,20 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
+    nanocoap_cache_entry_t **prev = _bucket(ce->cache_key);
 
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
-        memset(entry, 0, sizeof(nanocoap_cache_entry_t));
-        clist_rpush(&_empty_list_head, entry);
-        return 0;
+    /* only entries in the hash table are in the cache */
+    while (*prev && (*prev != ce)) {
+        prev = &(*prev)->bucket_next;
+    }
+    if (!*prev) {
+        return -1;
     }
 
-    return -1;
+    *prev = ce->bucket_next;
+    clist_remove(&_cache_list_head, (clist_node_t *)&ce->node);
+    memset((nanocoap_cache_entry_t *)ce, 0, sizeof(nanocoap_cache_entry_t));
+    clist_rpush(&_empty_list_head, (clist_node_t *)&ce->node);
+
+    return 0;
 }
@@ -1167,6 +1167,44 @@ ssize_t nanocoap_get_blockwise_to_buf(nanocoap_sock_t *sock, const char *path,
     return (res < 0) ? (ssize_t)res : (ssize_t)_buf.len;
 }
 
+/* with sock_udp_zero_copy, the response is built in a buffer of the stack, so
+ * it can be sent without copying; rsp_buf is only used if none is available */
+static void *_rsp_buf_get(void *rsp_buf, size_t rsp_buf_len, void **rsp_ctx)
+{
+    *rsp_ctx = NULL;
+#if IS_USED(MODULE_SOCK_UDP_ZERO_COPY)
+    void *buf = sock_udp_buf_alloc(rsp_buf_len, rsp_ctx);
+    if (buf != NULL) {
+        return buf;
+    }
+#else
+    (void)rsp_buf_len;
+#endif
+    return rsp_buf;
+}
+
+static void _rsp_buf_send(sock_udp_t *sock, void *rsp_ctx, const void *rsp,
+                          ssize_t len, const sock_udp_ep_t *remote,
+                          sock_udp_aux_tx_t *aux)
+{
+#if IS_USED(MODULE_SOCK_UDP_ZERO_COPY)
+    if (rsp_ctx != NULL) {
+        if (len > 0) {
+            sock_udp_send_buf_aux(sock, rsp_ctx, len, remote, aux);
+        }
+        else {
+            sock_udp_buf_free(rsp_ctx);
+        }
+        return;
+    }
+#else
+    (void)rsp_ctx;
+#endif
+    if (len > 0) {
+        sock_udp_send_aux(sock, rsp, len, remote, aux);
+    }
+}
+
 int nanocoap_server(sock_udp_ep_t *local, void *rsp_buf, size_t rsp_buf_len)
 {
     sock_udp_t sock;
@@ -1228,12 +1266,13 @@ int nanocoap_server(sock_udp_ep_t *local, void *rsp_buf, size_t rsp_buf_len)
         }
         ctx.local = &aux_in.local;
 #endif
-        if ((res = coap_handle_req(&pkt, rsp_buf, rsp_buf_len, &ctx)) <= 0) {
+        void *rsp_ctx;
+        void *rsp = _rsp_buf_get(rsp_buf, rsp_buf_len, &rsp_ctx);
+        if ((res = coap_handle_req(&pkt, rsp, rsp_buf_len, &ctx)) <= 0) {
             DEBUG("nanocoap: error handling request %" PRIdSIZE "\n", res);
-            continue;
         }
 
-        sock_udp_send_aux(&sock, rsp_buf, res, &remote, aux_out_ptr);
+        _rsp_buf_send(&sock, rsp_ctx, rsp, res, &remote, aux_out_ptr);
     }
 
     return 0;
@@ -10,11 +10,23 @@
  * @{
  *
  * @file
+ *
+ * The bulk of the buffer is summed up in words of the host's natural width
+ * and in host byte order, deferring the carries to a wide accumulator that is
+ * folded only once. As the one's complement sum is independent of the byte
+ * order (RFC 1071, section 2), the folded result is just converted from big
+ * endian afterwards.
  */
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
+#include "endian.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
@@ -22,6 +34,67 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static uint16_t _fold(uint64_t sum)
+{
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return sum;
+}
+
+/* sums the 16-bit words of buf in host byte order, len must be even */
+static uint16_t _sum_words(const uint8_t *buf, uint16_t len)
+{
+    uint64_t sum = 0;
+
+#if defined(__SSE2__)
+    /* zero-extend the 16-bit words to 32-bit lanes: with at most 2^12 blocks
+     * of two words per lane, the lanes can't overflow */
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    uint32_t lanes[4];
+
+    for (; len >= 16; buf += 16, len -= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)buf);
+        acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(v, zero));
+        acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(v, zero));
+    }
+    _mm_storeu_si128((__m128i *)(void *)lanes, acc);
+    sum = (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif UINTPTR_MAX > UINT32_MAX
+    for (; len >= 16; buf += 16, len -= 16) {
+        uint64_t w[2];
+        memcpy(w, buf, sizeof(w));
+        sum += (w[0] & 0xffffffff) + (w[0] >> 32);
+        sum += (w[1] & 0xffffffff) + (w[1] >> 32);
+    }
+#else
+    /* on 32-bit platforms, this compiles to a chain of add-with-carry */
+    for (; len >= 16; buf += 16, len -= 16) {
+        uint32_t w[4];
+        memcpy(w, buf, sizeof(w));
+        sum += w[0];
+        sum += w[1];
+        sum += w[2];
+        sum += w[3];
+    }
+#endif
+
+    for (; len >= 4; buf += 4, len -= 4) {
+        uint32_t w;
+        memcpy(&w, buf, sizeof(w));
+        sum += w;
+    }
+    if (len) {
+        uint16_t w;
+        memcpy(&w, buf, sizeof(w));
+        sum += w;
+    }
+
+    return _fold(sum);
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -47,10 +120,9 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    /* group bytes by 16-bit words and add them */
+    csum += be16toh(_sum_words(buf, len & ~1));
+    buf += len & ~1;
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
@@ -123,6 +123,38 @@ static int _dispatch_single(gnrc_netreg_entry_t *sendto, uint16_t cmd, void *dat
     return status;
 }
 
+/* number of subscriber threads that are woken up at once by
+ * gnrc_netapi_dispatch() */
+#define DISPATCH_BATCH_SIZE     (4U)
+
+static inline bool _is_thread(const gnrc_netreg_entry_t *entry)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    return entry->type == GNRC_NETREG_TYPE_DEFAULT;
+#else
+    (void)entry;
+    return true;
+#endif
+}
+
+static void _dispatch_batch(const kernel_pid_t *pids, unsigned numof,
+                            uint16_t cmd, gnrc_pktsnip_t *pkt)
+{
+    msg_t msg = {
+        .type = cmd,
+        .content.ptr = pkt,
+    };
+    unsigned sent = msg_send_multi(&msg, pids, numof);
+
+    if (sent < numof) {
+        LOG_WARNING("gnrc_netapi: dropped %u of %u messages\n",
+                    numof - sent, numof);
+    }
+    for (; sent < numof; sent++) {
+        gnrc_pktbuf_release_error(pkt, -EIO);
+    }
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -130,19 +162,42 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
 
     int numof = gnrc_netreg_num(type, demux_ctx);
 
-    if (numof != 0) {
+    if (numof == 1) {
+        int status = _dispatch_single(gnrc_netreg_lookup(type, demux_ctx),
+                                      cmd, pkt);
+        if (status < 0) {
+            gnrc_pktbuf_release_error(pkt, status);
+        }
+    }
+    else if (numof > 1) {
         gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+        kernel_pid_t pids[DISPATCH_BATCH_SIZE];
+        unsigned pids_numof = 0;
 
         /* the packet is replicated over all interfaces that it's being sent on */
         gnrc_pktbuf_hold(pkt, numof - 1);
 
+        /* wake up all subscribed threads at once, so the first one does not
+         * preempt us before the others got the packet */
         while (sendto) {
-            int status = _dispatch_single(sendto, cmd, pkt);
-            if (status < 0) {
-                gnrc_pktbuf_release_error(pkt, status);
+            if (_is_thread(sendto)) {
+                pids[pids_numof++] = sendto->target.pid;
+                if (pids_numof == DISPATCH_BATCH_SIZE) {
+                    _dispatch_batch(pids, pids_numof, cmd, pkt);
+                    pids_numof = 0;
+                }
+            }
+            else {
+                int status = _dispatch_single(sendto, cmd, pkt);
+                if (status < 0) {
+                    gnrc_pktbuf_release_error(pkt, status);
+                }
             }
             sendto = gnrc_netreg_getnext(sendto);
         }
+        if (pids_numof > 0) {
+            _dispatch_batch(pids, pids_numof, cmd, pkt);
+        }
     }
 
     gnrc_netreg_release_shared();
@@ -16,6 +16,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <string.h>
 
 #include "net/ethernet/hdr.h"
@@ -170,45 +171,99 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return res;
 }
 
-static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+/* reads a frame into a newly allocated snip, returns its length */
+static int _recv_copy(netdev_t *dev, gnrc_pktsnip_t **pkt,
+                      netdev_eth_rx_info_t *rx_info)
 {
-    netdev_t *dev = netif->dev;
-    gnrc_pktsnip_t *pkt = NULL;
-    netdev_eth_rx_info_t rx_info = { .flags = 0 };
     int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
 
-    if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
+    if (bytes_expected <= 0) {
+        return bytes_expected;
+    }
+    *pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+    if (!*pkt) {
+        DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
 
-        if (!pkt) {
-            DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+        /* drop the packet */
+        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        return -ENOBUFS;
+    }
 
-            /* drop the packet */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
+    int nread = dev->driver->recv(dev, (*pkt)->data, bytes_expected, rx_info);
+    if (nread <= 0) {
+        DEBUG("gnrc_netif_ethernet: read error.\n");
+        gnrc_pktbuf_release(*pkt);
+        *pkt = NULL;
+        return nread;
+    }
+    if (nread < bytes_expected) {
+        /* we've got less than the expected packet size,
+         * so free the unused space.*/
 
-            goto out;
-        }
+        DEBUG("gnrc_netif_ethernet: reallocating.\n");
+        gnrc_pktbuf_realloc_data(*pkt, nread);
+    }
+    return nread;
+}
 
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
-        if (nread <= 0) {
-            DEBUG("gnrc_netif_ethernet: read error.\n");
-            goto safe_out;
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+static void _rx_buf_release(void *arg)
+{
+    netdev_rx_buf_release(arg);
+}
+
+/* lets the packet buffer reference the receive buffer of the driver instead
+ * of copying the frame, returns -ENOBUFS if the frame is left for
+ * _recv_copy() */
+static int _recv_lent(netdev_t *dev, gnrc_pktsnip_t **pkt,
+                      netdev_eth_rx_info_t *rx_info)
+{
+    netdev_rx_buf_t *rx_buf;
+    int nread;
+
+    if (dev->driver->recv_lend == NULL) {
+        return -ENOBUFS;
+    }
+    nread = dev->driver->recv_lend(dev, &rx_buf, rx_info);
+    if (nread <= 0) {
+        return nread;
+    }
+    *pkt = gnrc_pktbuf_add_lent(NULL, rx_buf->data, nread, GNRC_NETTYPE_UNDEF,
+                                _rx_buf_release, rx_buf);
+    if (!*pkt) {
+        /* out of lent slots, fall back to copying the frame */
+        DEBUG("gnrc_netif_ethernet: cannot lend receive buffer.\n");
+        *pkt = gnrc_pktbuf_add(NULL, rx_buf->data, nread, GNRC_NETTYPE_UNDEF);
+        netdev_rx_buf_release(rx_buf);
+        if (!*pkt) {
+            DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+            return -ENOMEM;
         }
+    }
+    return nread;
+}
+#endif
+
+static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    gnrc_pktsnip_t *pkt = NULL;
+    netdev_eth_rx_info_t rx_info = { .flags = 0 };
+    int nread = -ENOBUFS;
+
+#if IS_USED(MODULE_NETDEV_RX_LEND)
+    nread = _recv_lent(dev, &pkt, &rx_info);
+#endif
+    if (nread == -ENOBUFS) {
+        nread = _recv_copy(dev, &pkt, &rx_info);
+    }
+
+    if (nread > 0) {
 #ifdef MODULE_NETSTATS_L2
         netif->stats.rx_count++;
         netif->stats.rx_bytes += nread;
 #endif
 
-        if (nread < bytes_expected) {
-            /* we've got less than the expected packet size,
-             * so free the unused space.*/
-
-            DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
-        }
-
         DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
               gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
               nread);
@@ -258,7 +313,6 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         pkt = gnrc_pkt_append(pkt, netif_hdr);
     }
 
-out:
     return pkt;
 
 safe_out:
@@ -34,6 +34,9 @@
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST) */
 #include "net/netstats.h"
 #include "net/netstats/neighbor.h"
 #include "fmt.h"
@@ -1526,6 +1529,10 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     if (res > 0) {
         netif->l2addr_len = res;
     }
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE)
+    /* compressed addresses may be derived from the link-layer address */
+    netif->sixlo.iphc_flow_gen++;
+#endif
 }
 
 static void _init_from_device(gnrc_netif_t *netif)
@@ -2121,6 +2128,12 @@ static void *_gnrc_netif_thread(void *args)
 
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+    /* forward fragments of datagrams with a VRB entry right away */
+    if (gnrc_sixlowpan_frag_vrb_fast_forward(pkt)) {
+        return;
+    }
+#endif
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
@@ -31,8 +31,25 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+static_assert((CONFIG_GNRC_NETREG_BUCKETS & (CONFIG_GNRC_NETREG_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_NETREG_BUCKETS must be a power of two");
+static_assert(CONFIG_GNRC_NETREG_BUCKETS >= GNRC_NETTYPE_NUMOF,
+              "CONFIG_GNRC_NETREG_BUCKETS must be at least GNRC_NETTYPE_NUMOF");
+
+/* The registry as hash table by gnrc_nettype_t and demux context. As the type
+ * is added to the hash of the demux context modulo the number of buckets,
+ * entries with the same demux context but a different type always end up in
+ * different buckets, so the demux context alone identifies the entries of a
+ * type within a bucket. */
+static gnrc_netreg_entry_t *netreg[CONFIG_GNRC_NETREG_BUCKETS];
+
+static gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* Fibonacci hashing, the upper bits are the best mixed ones */
+    uint32_t hash = (demux_ctx * UINT32_C(2654435761)) >> 16;
+
+    return &netreg[(hash + type) & (CONFIG_GNRC_NETREG_BUCKETS - 1)];
+}
 
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
@@ -63,7 +80,7 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -153,13 +170,15 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **bucket = _bucket(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*bucket, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*bucket, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +191,11 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    gnrc_netreg_entry_t **bucket = _bucket(type, entry->demux_ctx);
+    /* the entry might not be registered, e.g. for an unbound sock */
+    if (*bucket) {
+        LL_DELETE(*bucket, entry);
+    }
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +237,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_bucket(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
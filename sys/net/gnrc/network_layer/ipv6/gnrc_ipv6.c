@@ -59,6 +59,13 @@ static msg_t _msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 
+#if IS_USED(MODULE_FIB_TRIE)
+/**
+ * @brief node pool of the longest-prefix-match index of the forwarding table
+ */
+static fib_trie_node_t _fib_trie_nodes[FIB_TRIE_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE)];
+#endif
+
 /**
  * @brief the IPv6 forwarding table
  */
@@ -94,6 +101,9 @@ kernel_pid_t gnrc_ipv6_init(void)
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
+#if IS_USED(MODULE_FIB_TRIE)
+    gnrc_ipv6_fib_table.trie.nodes = _fib_trie_nodes;
+#endif
     fib_init(&gnrc_ipv6_fib_table);
 #endif
 
@@ -184,14 +194,11 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
  */
 static inline bool _find_entry_in_nc(uint8_t *l2addr, uint8_t l2addr_len, ipv6_addr_t *ipv6)
 {
-    void *state = NULL;
     gnrc_ipv6_nib_nc_t nce;
 
-    while (gnrc_ipv6_nib_nc_iter(0, &state, &nce)) {
-        if (l2util_addr_equal(l2addr, l2addr_len, nce.l2addr, nce.l2addr_len)) {
-            *ipv6 = nce.ipv6;
-            return true;
-        }
+    if (gnrc_ipv6_nib_nc_get_by_l2addr(0, l2addr, l2addr_len, &nce)) {
+        *ipv6 = nce.ipv6;
+        return true;
     }
     return false;
 }
@@ -19,6 +19,9 @@
 #include <string.h>
 #include <kernel_defines.h>
 
+#include "bitarithm.h"
+#include "bitfield.h"
+#include "hashes.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -42,6 +45,47 @@ static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+#if CONFIG_GNRC_IPV6_NIB_NUMOF < UINT8_MAX
+typedef uint8_t _onl_idx_t;
+#define _ONL_IDX_NIL        (UINT8_MAX)
+#else
+typedef uint16_t _onl_idx_t;
+#define _ONL_IDX_NIL        (UINT16_MAX)
+#endif
+
+/* open addressing with linear probing, kept at most half full */
+#define _ONL_INDEX_SIZE     (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+/* _nodes by IPv6 address */
+static _onl_idx_t _nodes_by_addr[_ONL_INDEX_SIZE];
+static BITFIELD(_nodes_addr_indexed, CONFIG_GNRC_IPV6_NIB_NUMOF);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+/* _nodes by link-layer address */
+static _onl_idx_t _nodes_by_l2addr[_ONL_INDEX_SIZE];
+static BITFIELD(_nodes_l2addr_indexed, CONFIG_GNRC_IPV6_NIB_NUMOF);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+#if CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF < UINT8_MAX
+typedef uint8_t _offl_idx_t;
+#define _OFFL_IDX_NIL   (UINT8_MAX)
+#else
+typedef uint16_t _offl_idx_t;
+#define _OFFL_IDX_NIL   (UINT16_MAX)
+#endif
+
+/* hash buckets by (prefix, prefix length) of the indexed off-link entries */
+static _offl_idx_t _dsts_buckets[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+/* next entry in the same bucket */
+static _offl_idx_t _dsts_chain[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+/* slots of _dsts that are in the index */
+static BITFIELD(_dsts_used, CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF);
+/* prefix lengths of the indexed entries */
+static BITFIELD(_dsts_pfx_lens, IPV6_ADDR_BIT_LEN + 1);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -66,7 +110,28 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    memset(_nodes_addr_indexed, 0, sizeof(_nodes_addr_indexed));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    memset(_nodes_l2addr_indexed, 0, sizeof(_nodes_l2addr_indexed));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+    memset(_dsts_used, 0, sizeof(_dsts_used));
+    memset(_dsts_pfx_lens, 0, sizeof(_dsts_pfx_lens));
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
 #endif  /* TEST_SUITES */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    /* all bytes set is _ONL_IDX_NIL for either index type */
+    memset(_nodes_by_addr, 0xff, sizeof(_nodes_by_addr));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    memset(_nodes_by_l2addr, 0xff, sizeof(_nodes_by_l2addr));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+    /* all bytes set is _OFFL_IDX_NIL for either index type */
+    memset(_dsts_buckets, 0xff, sizeof(_dsts_buckets));
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -91,6 +156,148 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
     }
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+static inline unsigned _onl_index_next(unsigned slot)
+{
+    return (slot + 1 < _ONL_INDEX_SIZE) ? (slot + 1) : 0;
+}
+
+static inline unsigned _addr_hash(const ipv6_addr_t *addr)
+{
+    return fnv_hash(addr->u8, sizeof(*addr)) % _ONL_INDEX_SIZE;
+}
+
+static unsigned _onl_addr_hash(const _nib_onl_entry_t *node)
+{
+    return _addr_hash(&node->ipv6);
+}
+
+static void _onl_index_add(_onl_idx_t *index, unsigned slot, unsigned idx)
+{
+    while (index[slot] != _ONL_IDX_NIL) {
+        slot = _onl_index_next(slot);
+    }
+    index[slot] = idx;
+}
+
+/* removes idx by shifting the following entries of the probe sequence back,
+ * so lookups can stop at the first empty slot */
+static void _onl_index_remove(_onl_idx_t *index, unsigned slot, unsigned idx,
+                              unsigned (*hash)(const _nib_onl_entry_t *))
+{
+    while (index[slot] != idx) {
+        assert(index[slot] != _ONL_IDX_NIL);
+        slot = _onl_index_next(slot);
+    }
+    for (unsigned next = _onl_index_next(slot);
+         index[next] != _ONL_IDX_NIL; next = _onl_index_next(next)) {
+        unsigned home = hash(&_nodes[index[next]]);
+
+        /* can the entry at next be moved to slot without getting
+         * unreachable from its home slot? */
+        if ((slot <= next) ? ((home <= slot) || (home > next))
+                           : ((home <= slot) && (home > next))) {
+            index[slot] = index[next];
+            slot = next;
+        }
+    }
+    index[slot] = _ONL_IDX_NIL;
+}
+
+static void _onl_addr_index(_nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+
+    if (!bf_isset(_nodes_addr_indexed, idx) &&
+        !ipv6_addr_is_unspecified(&node->ipv6)) {
+        _onl_index_add(_nodes_by_addr, _onl_addr_hash(node), idx);
+        bf_set(_nodes_addr_indexed, idx);
+    }
+}
+
+static void _onl_addr_unindex(_nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+
+    if (bf_isset(_nodes_addr_indexed, idx)) {
+        _onl_index_remove(_nodes_by_addr, _onl_addr_hash(node), idx,
+                          _onl_addr_hash);
+        bf_unset(_nodes_addr_indexed, idx);
+    }
+}
+
+/* returns the entry with the lowest index for addr on exactly iface, or, if
+ * any_iface is true, a used entry for addr where either interface may be 0 */
+static _nib_onl_entry_t *_onl_index_get(const ipv6_addr_t *addr,
+                                        unsigned iface, bool any_iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned slot = _addr_hash(addr); _nodes_by_addr[slot] != _ONL_IDX_NIL;
+         slot = _onl_index_next(slot)) {
+        _nib_onl_entry_t *node = &_nodes[_nodes_by_addr[slot]];
+        unsigned node_iface = _nib_onl_get_if(node);
+
+        if (((res != NULL) && (res < node)) ||
+            !ipv6_addr_equal(&node->ipv6, addr)) {
+            continue;
+        }
+        if (any_iface ? ((node->mode != _EMPTY) &&
+                         ((node_iface == 0) || (iface == 0) ||
+                          (node_iface == iface)))
+                      : (node_iface == iface)) {
+            res = node;
+        }
+    }
+    return res;
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+static unsigned _onl_l2addr_hash(const _nib_onl_entry_t *node)
+{
+    return fnv_hash(node->l2addr, node->l2addr_len) % _ONL_INDEX_SIZE;
+}
+
+static void _onl_l2addr_unindex(_nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+
+    if (bf_isset(_nodes_l2addr_indexed, idx)) {
+        _onl_index_remove(_nodes_by_l2addr, _onl_l2addr_hash(node), idx,
+                          _onl_l2addr_hash);
+        bf_unset(_nodes_l2addr_indexed, idx);
+    }
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+
+/* sets the IPv6 address of an entry, keeping the index up-to-date */
+static void _onl_set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    _onl_addr_unindex(node);
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+    _onl_addr_index(node);
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+    memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+}
+
+bool _nib_onl_clear(_nib_onl_entry_t *node)
+{
+    if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+        _onl_addr_unindex(node);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+        _onl_l2addr_unindex(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+        memset(node, 0, sizeof(_nib_onl_entry_t));
+        return true;
+    }
+    return false;
+}
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -98,6 +305,14 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr) &&
+        ((node = _onl_index_get(addr, iface, false)) != NULL)) {
+        DEBUG("  %p is an exact match\n", (void *)node);
+        _override_node(addr, iface, node);
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -223,6 +438,15 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    /* entries with unspecified address are not indexed */
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = _onl_index_get(addr, iface, true);
+
+        DEBUG("  %s\n", (node) ? "Found" : "No suitable entry found");
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -285,6 +509,54 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
     _nib_onl_clear(node);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+void _nib_nc_set_l2addr(_nib_onl_entry_t *node, const uint8_t *l2addr,
+                        size_t l2addr_len)
+{
+    assert(l2addr_len <= CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    _onl_l2addr_unindex(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+    if (l2addr != NULL) {
+        memcpy(node->l2addr, l2addr, l2addr_len);
+    }
+    node->l2addr_len = l2addr_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    if (l2addr_len > 0) {
+        unsigned idx = node - _nodes;
+
+        _onl_index_add(_nodes_by_l2addr, _onl_l2addr_hash(node), idx);
+        bf_set(_nodes_l2addr_indexed, idx);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+}
+
+_nib_onl_entry_t *_nib_nc_get_by_l2addr(const uint8_t *l2addr,
+                                        size_t l2addr_len, unsigned iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_INDEX)
+    for (unsigned slot = fnv_hash(l2addr, l2addr_len) % _ONL_INDEX_SIZE;
+         _nodes_by_l2addr[slot] != _ONL_IDX_NIL;
+         slot = _onl_index_next(slot)) {
+        _nib_onl_entry_t *node = &_nodes[_nodes_by_l2addr[slot]];
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        _nib_onl_entry_t *node = &_nodes[i];
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_INDEX */
+
+        if ((node->mode & _NC) && ((res == NULL) || (node < res)) &&
+            ((iface == 0) || (_nib_onl_get_if(node) == iface)) &&
+            l2util_addr_equal(l2addr, l2addr_len,
+                              node->l2addr, node->l2addr_len)) {
+            res = node;
+        }
+    }
+    return res;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN) || !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
 static inline int _get_l2addr_from_ipv6(const gnrc_netif_t *netif,
                                         const _nib_onl_entry_t *node,
@@ -475,6 +747,127 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+static inline bool _in_dsts(const _nib_offl_entry_t *dst)
+{
+    return (dst < (_dsts + CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF));
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+static unsigned _offl_hash(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    uint32_t hash = pfx_len;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(pfx->u32); i++) {
+        hash = (hash ^ pfx->u32[i].u32) * 0x9e3779b1;
+    }
+    return (hash ^ (hash >> 16)) % CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF;
+}
+
+static void _offl_index_add(_nib_offl_entry_t *dst)
+{
+    unsigned idx = dst - _dsts;
+    unsigned bucket = _offl_hash(&dst->pfx, dst->pfx_len);
+
+    assert(!bf_isset(_dsts_used, idx));
+    _dsts_chain[idx] = _dsts_buckets[bucket];
+    _dsts_buckets[bucket] = idx;
+    bf_set(_dsts_used, idx);
+    bf_set(_dsts_pfx_lens, dst->pfx_len);
+}
+
+static void _offl_index_remove(_nib_offl_entry_t *dst)
+{
+    unsigned idx = dst - _dsts;
+    _offl_idx_t *ptr = &_dsts_buckets[_offl_hash(&dst->pfx, dst->pfx_len)];
+
+    if (!bf_isset(_dsts_used, idx)) {
+        return;
+    }
+    while (*ptr != idx) {
+        assert(*ptr != _OFFL_IDX_NIL);
+        ptr = &_dsts_chain[*ptr];
+    }
+    *ptr = _dsts_chain[idx];
+    bf_unset(_dsts_used, idx);
+    /* removals are rare, so rather check all entries than keeping a counter
+     * for every prefix length */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        if (bf_isset(_dsts_used, i) && (_dsts[i].pfx_len == dst->pfx_len)) {
+            return;
+        }
+    }
+    bf_unset(_dsts_pfx_lens, dst->pfx_len);
+}
+
+/* returns the in-use entry with the lowest index for exactly pfx/pfx_len,
+ * with the same interface and a matching or unspecified next hop if
+ * next_hop_match is true */
+static _nib_offl_entry_t *_offl_index_find(const ipv6_addr_t *pfx,
+                                           unsigned pfx_len,
+                                           bool next_hop_match,
+                                           const ipv6_addr_t *next_hop,
+                                           unsigned iface)
+{
+    _nib_offl_entry_t *res = NULL;
+
+    for (_offl_idx_t i = _dsts_buckets[_offl_hash(pfx, pfx_len)];
+         i != _OFFL_IDX_NIL; i = _dsts_chain[i]) {
+        _nib_offl_entry_t *tmp = &_dsts[i];
+
+        if ((tmp->mode == _EMPTY) || (tmp->pfx_len != pfx_len) ||
+            !ipv6_addr_equal(&tmp->pfx, pfx) || ((res != NULL) && (res < tmp))) {
+            continue;
+        }
+        if (next_hop_match) {
+            assert(tmp->next_hop);
+            if ((_nib_onl_get_if(tmp->next_hop) != iface) ||
+                !(ipv6_addr_is_unspecified(&tmp->next_hop->ipv6) ||
+                  _addr_equals(next_hop, tmp->next_hop))) {
+                continue;
+            }
+        }
+        res = tmp;
+    }
+    return res;
+}
+
+static _nib_offl_entry_t *_offl_index_alloc(const ipv6_addr_t *next_hop,
+                                            unsigned iface,
+                                            const ipv6_addr_t *pfx,
+                                            unsigned pfx_len)
+{
+    ipv6_addr_t key;
+    _nib_offl_entry_t *dst;
+    int idx;
+
+    ipv6_addr_set_unspecified(&key);
+    ipv6_addr_init_prefix(&key, pfx, pfx_len);
+    if ((dst = _offl_index_find(&key, pfx_len, true, next_hop, iface))) {
+        DEBUG("  %p is an exact match\n", (void *)dst);
+        if (next_hop != NULL) {
+            /* sets next_hop if it was previously unspecified */
+            _onl_set_addr(dst->next_hop, next_hop);
+        }
+        /*mark that this NCE is used by an offl_entry*/
+        dst->next_hop->mode |= _DST;
+        return dst;
+    }
+    if ((idx = bf_find_first_unset(_dsts_used,
+                                   CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)) >= 0) {
+        return &_dsts[idx];
+    }
+    /* all slots are indexed, but an entry may have been allocated without
+     * ever being used */
+    for (dst = _dsts; _in_dsts(dst); dst++) {
+        if (dst->mode == _EMPTY) {
+            _offl_index_remove(dst);
+            return dst;
+        }
+    }
+    return NULL;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
@@ -489,6 +882,12 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
           iface);
     DEBUG("pfx = %s/%u)\n", ipv6_addr_to_str(addr_str, pfx,
                                              sizeof(addr_str)), pfx_len);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+    dst = _offl_index_alloc(next_hop, iface, pfx, pfx_len);
+    if ((dst == NULL) || bf_isset(_dsts_used, dst - _dsts)) {
+        return dst;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
         _nib_offl_entry_t *tmp = &_dsts[i];
         _nib_onl_entry_t *tmp_node = tmp->next_hop;
@@ -510,7 +909,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                 DEBUG("  %p is an exact match\n", (void *)tmp);
                 if (next_hop != NULL) {
                     /* sets next_hop if it was previously unspecified */
-                    memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    _onl_set_addr(tmp_node, next_hop);
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -518,6 +917,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             }
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
         if (!dst->next_hop && !(dst->next_hop = _nib_onl_alloc(next_hop, iface))) {
@@ -526,17 +926,17 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         }
         _override_node(next_hop, iface, dst->next_hop);
         dst->next_hop->mode |= _DST;
+        /* clear stale bits of a reused entry beyond the prefix */
+        ipv6_addr_set_unspecified(&dst->pfx);
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+        _offl_index_add(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
     }
     return dst;
 }
 
-static inline bool _in_dsts(const _nib_offl_entry_t *dst)
-{
-    return (dst < (_dsts + CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF));
-}
-
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static inline unsigned _idx_dsts(const _nib_offl_entry_t *dst)
 {
@@ -566,6 +966,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+        _offl_index_remove(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -601,6 +1004,30 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+    (void)best_match;
+    /* probe the prefix lengths in use, longest first */
+    for (int i = sizeof(_dsts_pfx_lens) - 1; i >= 0; i--) {
+        unsigned lens = _dsts_pfx_lens[i];
+
+        while (lens) {
+            /* most significant bit of a byte is the lowest prefix length */
+            unsigned bit = bitarithm_lsb(lens);
+            unsigned pfx_len = (i << 3) + 7 - bit;
+            ipv6_addr_t pfx;
+
+            lens &= ~(1U << bit);
+            ipv6_addr_set_unspecified(&pfx);
+            ipv6_addr_init_prefix(&pfx, dst, pfx_len);
+            if ((res = _offl_index_find(&pfx, pfx_len, false, NULL, 0))) {
+                DEBUG("nib: best match %s/%u\n",
+                      ipv6_addr_to_str(addr_str, &res->pfx, sizeof(addr_str)),
+                      pfx_len);
+                return res;
+            }
+        }
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -620,6 +1047,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
             }
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
     return res;
 }
 
@@ -880,7 +1308,7 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _onl_set_addr(node, addr);
     }
     _nib_onl_set_if(node, iface);
 }
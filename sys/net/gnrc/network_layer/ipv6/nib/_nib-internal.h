@@ -367,14 +367,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
  * @return  true, if entry was cleared.
  * @return  false, if entry was not cleared.
  */
-static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
-{
-    if (node->mode == _EMPTY) {
-        memset(node, 0, sizeof(_nib_onl_entry_t));
-        return true;
-    }
-    return false;
-}
+bool _nib_onl_clear(_nib_onl_entry_t *node);
 
 /**
  * @brief   Iterates over on-link entries
@@ -457,6 +450,39 @@ void _nib_nc_remove(_nib_onl_entry_t *node);
  */
 void _nib_nc_get(const _nib_onl_entry_t *node, gnrc_ipv6_nib_nc_t *nce);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) || defined(DOXYGEN)
+/**
+ * @brief   Sets the link-layer address of an on-link entry
+ *
+ * @pre `l2addr_len <= CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN`
+ *
+ * @param[in,out] node      On-link entry.
+ * @param[in] l2addr        The link-layer address. May be NULL to only change
+ *                          the length.
+ * @param[in] l2addr_len    Length of @p l2addr. May be 0.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ARSM != 0.
+ */
+void _nib_nc_set_l2addr(_nib_onl_entry_t *node, const uint8_t *l2addr,
+                        size_t l2addr_len);
+
+/**
+ * @brief   Gets a neighbor cache entry by its stored link-layer address
+ *
+ * @param[in] l2addr        The link-layer address.
+ * @param[in] l2addr_len    Length of @p l2addr.
+ * @param[in] iface         The interface to the neighbor. May be 0 for any
+ *                          interface.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ARSM != 0.
+ *
+ * @return  The neighbor cache entry with @p l2addr on success.
+ * @return  NULL, if there is no such entry.
+ */
+_nib_onl_entry_t *_nib_nc_get_by_l2addr(const uint8_t *l2addr,
+                                        size_t l2addr_len, unsigned iface);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
 /**
  * @brief   Sets a NUD-managed neighbor cache entry to reachable and sets the
  *          respective event in @ref _nib_evtimer "event timer"
@@ -43,10 +43,7 @@ int gnrc_ipv6_nib_nc_set(const ipv6_addr_t *ipv6, unsigned iface,
         return -ENOMEM;
     }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
-    if ((l2addr != NULL) && (l2addr_len > 0)) {
-        memcpy(node->l2addr, l2addr, l2addr_len);
-    }
-    node->l2addr_len = l2addr_len;
+    _nib_nc_set_l2addr(node, (l2addr_len > 0) ? l2addr : NULL, l2addr_len);
 #else
     (void)l2addr;
     (void)l2addr_len;
@@ -105,26 +102,78 @@ void gnrc_ipv6_nib_nc_del(const ipv6_addr_t *ipv6, unsigned iface)
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
 bool gnrc_ipv6_nib_nc_del_l2(unsigned iface, const uint8_t *l2addr, size_t l2addr_len)
+{
+    _nib_onl_entry_t *node;
+
+    _nib_acquire();
+    /* Find and remove entry with matching l2 address.*/
+    if ((node = _nib_nc_get_by_l2addr(l2addr, l2addr_len, iface)) != NULL) {
+        _nib_nc_remove(node);
+    }
+    _nib_release();
+
+    return (node != NULL);
+}
+#endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
+bool gnrc_ipv6_nib_nc_get_by_l2addr(unsigned iface, const uint8_t *l2addr,
+                                    size_t l2addr_len, gnrc_ipv6_nib_nc_t *nce)
 {
     _nib_onl_entry_t *node = NULL;
-    bool res = false;
 
+    assert((l2addr != NULL) && (nce != NULL));
     _nib_acquire();
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    if ((node = _nib_nc_get_by_l2addr(l2addr, l2addr_len, iface)) != NULL) {
+        _nib_nc_get(node, nce);
+        /* link-local addresses of 6LNs may resolve differently, see below */
+        if (!l2util_addr_equal(l2addr, l2addr_len, nce->l2addr,
+                               nce->l2addr_len)) {
+            node = NULL;
+        }
+    }
+#endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN)
+    gnrc_netif_t *netif = NULL;
 
-    /* Find and remove entry with matching l2 address.*/
+    /* the link-layer address of a 6LN's link-local neighbor is derived from
+     * its IPv6 address, so look up the IPv6 address derived from l2addr */
+    while ((node == NULL) && ((netif = gnrc_netif_iter(netif)) != NULL)) {
+        ipv6_addr_t ipv6;
+
+        if (((iface != 0) && (netif->pid != (kernel_pid_t)iface)) ||
+            (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) &&
+             (!gnrc_netif_is_6ln(netif) || gnrc_netif_is_rtr(netif))) ||
+            (_build_ll_ipv6_from_addr(netif, l2addr, l2addr_len, &ipv6) < 0)) {
+            continue;
+        }
+        if (((node = _nib_onl_get(&ipv6, netif->pid)) != NULL) &&
+            (node->mode & _NC)) {
+            _nib_nc_get(node, nce);
+            if (l2util_addr_equal(l2addr, l2addr_len, nce->l2addr,
+                                  nce->l2addr_len)) {
+                break;
+            }
+        }
+        node = NULL;
+    }
+#endif /* CONFIG_GNRC_IPV6_NIB_6LN */
+#if !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM) && !IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LN)
+    /* no index, link-layer addresses are only known through _nib_nc_get() */
     while ((node = _nib_onl_iter(node)) != NULL) {
-        if ((_nib_onl_get_if(node) == iface) &&
-            l2util_addr_equal(l2addr, l2addr_len, node->l2addr, node->l2addr_len)) {
-            _nib_nc_remove(node);
-            res = true;
-            break;
+        if ((node->mode & _NC) &&
+            ((iface == 0) || (_nib_onl_get_if(node) == iface))) {
+            _nib_nc_get(node, nce);
+            if (l2util_addr_equal(l2addr, l2addr_len, nce->l2addr,
+                                  nce->l2addr_len)) {
+                break;
+            }
         }
     }
+#endif /* !CONFIG_GNRC_IPV6_NIB_ARSM && !CONFIG_GNRC_IPV6_NIB_6LN */
     _nib_release();
-
-    return res;
+    return (node != NULL);
 }
-#endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
 
 void gnrc_ipv6_nib_nc_mark_reachable(const ipv6_addr_t *ipv6)
 {
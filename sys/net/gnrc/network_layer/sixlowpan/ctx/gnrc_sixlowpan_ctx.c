@@ -30,6 +30,10 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+static unsigned _ctx_gen;
+/* minute at which the lifetime of the next context used for compression
+ * expires */
+static uint32_t _ctx_next_inval_time = UINT32_MAX;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
@@ -129,11 +133,57 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    if (comp && (_ctx_inval_times[id] < _ctx_next_inval_time)) {
+        _ctx_next_inval_time = _ctx_inval_times[id];
+    }
+    _ctx_gen++;
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
+{
+    if (id >= GNRC_SIXLOWPAN_CTX_SIZE) {
+        return;
+    }
+
+    mutex_lock(&_ctx_mutex);
+    DEBUG("6lo ctx: remove context %u\n", id);
+    _ctxs[id].prefix_len = 0;
+    _ctx_gen++;
+    mutex_unlock(&_ctx_mutex);
+}
+
+unsigned gnrc_sixlowpan_ctx_generation(void)
+{
+    unsigned gen;
+
+    mutex_lock(&_ctx_mutex);
+
+    /* only check the lifetimes when a context used for compression expired,
+     * _update_lifetime() changes the generation for it */
+    if ((_ctx_next_inval_time != UINT32_MAX) &&
+        (_current_minute() >= _ctx_next_inval_time)) {
+        _ctx_next_inval_time = UINT32_MAX;
+        for (unsigned id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+            if ((_ctxs[id].prefix_len > 0) &&
+                (_ctxs[id].flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+                _update_lifetime(id);
+            }
+            if ((_ctxs[id].prefix_len > 0) &&
+                (_ctxs[id].flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP) &&
+                (_ctx_inval_times[id] < _ctx_next_inval_time)) {
+                _ctx_next_inval_time = _ctx_inval_times[id];
+            }
+        }
+    }
+    gen = _ctx_gen;
+
+    mutex_unlock(&_ctx_mutex);
+    return gen;
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -158,6 +208,7 @@ static void _update_lifetime(uint8_t id)
         DEBUG("6lo ctx: context %u was invalidated for compression\n", id);
         _ctxs[id].ltime = 0;
         _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+        _ctx_gen++;
     }
     else {
         _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - now);
@@ -170,6 +221,8 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    _ctx_next_inval_time = UINT32_MAX;
+    _ctx_gen++;
 }
 #endif
 
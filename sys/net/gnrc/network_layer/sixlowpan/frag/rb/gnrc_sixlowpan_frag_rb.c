@@ -30,6 +30,7 @@
 #include "net/gnrc/sixlowpan/frag/vrb.h"
 #include "net/sixlowpan.h"
 #include "net/sixlowpan/sfr.h"
+#include "container.h"
 #include "thread.h"
 #include "xtimer.h"
 #include "utlist.h"
@@ -68,6 +69,26 @@ static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 static xtimer_t _gc_timer;
 static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+#define RBUF_BUCKETS_MASK   (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS - 1)
+
+/* hash buckets of the entries by (source, destination, tag); entries are
+ * referenced by their index + 1, so 0 is none */
+static uint16_t _rbuf_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS];
+static uint16_t _rbuf_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* time the GC timer fires at, if armed */
+static uint32_t _gc_deadline;
+static bool _gc_armed;
+
+static_assert((CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS & RBUF_BUCKETS_MASK) == 0,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS must be a power of two");
+#endif
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+/* RFC 4944 fragment offsets are given in units of 8 octets */
+#define RBUF_UNIT_SIZE      (8U)
+#endif
+
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
@@ -90,6 +111,11 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
+/* checks if an entry is identified by the given tuple */
+static bool _rbuf_matches(const gnrc_sixlowpan_frag_rb_t *e,
+                          const void *src, size_t src_len,
+                          const void *dst, size_t dst_len,
+                          uint16_t tag);
 
 /* status codes for _rbuf_add() */
 enum {
@@ -136,6 +162,156 @@ static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
     return RBUF_ADD_SUCCESS;
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+/* Minimal fragment forwarding hands the intervals of an entry over to the VRB,
+ * and SFR offsets are not in 8-octet units, so only RFC 4944 fragments of
+ * reassembled datagrams are tracked in the bitmaps */
+static bool _rbuf_uses_bitmap(const gnrc_sixlowpan_frag_rb_t *e,
+                              const gnrc_pktsnip_t *pkt)
+{
+    return !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) &&
+           sixlowpan_frag_is(pkt->data) &&
+           (e->super.datagram_size <=
+            (GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS * RBUF_UNIT_SIZE));
+}
+
+/* like _check_fragments(), at a granularity of 8-octet units */
+static int _check_fragments_bitmap(const gnrc_sixlowpan_frag_rb_t *e,
+                                   size_t frag_size, size_t offset)
+{
+    unsigned start = offset / RBUF_UNIT_SIZE;
+    unsigned end = (offset + frag_size - 1) / RBUF_UNIT_SIZE;
+    bool received = true;
+    bool overlaps = false;
+
+    for (unsigned unit = start; unit <= end; unit++) {
+        if (bf_isset(e->units, unit)) {
+            overlaps = true;
+        }
+        else {
+            received = false;
+        }
+    }
+    if (!overlaps) {
+        return RBUF_ADD_SUCCESS;
+    }
+    /* a duplicate covers the same units as a fragment received before: that
+     * one started at the same unit, and it ended at the same unit, if the next
+     * one was not received or starts another fragment */
+    if (received && bf_isset(e->starts, start) &&
+        ((end + 1 >= GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS) ||
+         !bf_isset(e->units, end + 1) || bf_isset(e->starts, end + 1))) {
+        DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+        return RBUF_ADD_DUPLICATE;
+    }
+    /* "A fresh reassembly may be commenced with the most recently received
+     * link fragment" https://tools.ietf.org/html/rfc4944#section-5.3 */
+    return RBUF_ADD_REPEAT;
+}
+
+static void _rbuf_update_bitmap(gnrc_sixlowpan_frag_rb_t *e,
+                                uint16_t offset, size_t frag_size)
+{
+    unsigned start = offset / RBUF_UNIT_SIZE;
+    unsigned end = (offset + frag_size - 1) / RBUF_UNIT_SIZE;
+
+    bf_set(e->starts, start);
+    for (unsigned unit = start; unit <= end; unit++) {
+        bf_set(e->units, unit);
+    }
+}
+#endif
+
+/* checks a fragment of a reassembly buffer entry for overlaps */
+static int _rbuf_check_fragments(gnrc_sixlowpan_frag_rb_t *e, bool bitmap,
+                                 size_t frag_size, size_t offset)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    if (bitmap) {
+        return _check_fragments_bitmap(e, frag_size, offset);
+    }
+#else
+    (void)bitmap;
+#endif
+    return _check_fragments(&e->super, frag_size, offset);
+}
+
+/* marks a fragment of a reassembly buffer entry as received */
+static bool _rbuf_update(gnrc_sixlowpan_frag_rb_t *e, bool bitmap,
+                         uint16_t offset, size_t frag_size)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    if (bitmap) {
+        _rbuf_update_bitmap(e, offset, frag_size);
+        return true;
+    }
+#else
+    (void)bitmap;
+#endif
+    return _rbuf_update_ints(&e->super, offset, frag_size);
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+static unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len,
+                           uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = hash * 31 + src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = hash * 31 + dst[i];
+    }
+    return (hash ^ (hash >> 16)) & RBUF_BUCKETS_MASK;
+}
+
+static uint16_t *_rbuf_bucket(const gnrc_sixlowpan_frag_rb_t *e)
+{
+    return &_rbuf_buckets[_rbuf_hash(e->super.src, e->super.src_len,
+                                     e->super.dst, e->super.dst_len,
+                                     e->super.tag)];
+}
+
+static void _rbuf_index_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    uint16_t *bucket = _rbuf_bucket(e);
+    unsigned i = e - rbuf;
+
+    _rbuf_next[i] = *bucket;
+    *bucket = i + 1;
+}
+
+static void _rbuf_index_rm(gnrc_sixlowpan_frag_rb_t *e)
+{
+    uint16_t *prev = _rbuf_bucket(e);
+    unsigned i = e - rbuf;
+
+    while (*prev && (*prev != i + 1)) {
+        prev = &_rbuf_next[*prev - 1];
+    }
+    if (*prev) {
+        *prev = _rbuf_next[i];
+    }
+}
+
+/* arms the GC timer to fire at deadline, unless it fires before */
+static void _gc_schedule(uint32_t deadline)
+{
+    uint32_t now_usec = xtimer_now_usec();
+
+    if (_gc_armed && ((int32_t)(deadline - _gc_deadline) >= 0)) {
+        return;
+    }
+    _gc_deadline = deadline;
+    _gc_armed = true;
+    xtimer_set_msg(&_gc_timer,
+                   ((int32_t)(deadline - now_usec) > 0) ? deadline - now_usec : 0,
+                   &_gc_timer_msg, thread_getpid());
+}
+#endif
+
 gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_add(gnrc_netif_hdr_t *netif_hdr,
                                                      gnrc_pktsnip_t *pkt,
                                                      size_t offset, unsigned page)
@@ -189,20 +365,37 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    for (uint16_t i = _rbuf_buckets[_rbuf_hash(src, src_len, dst, dst_len, tag)];
+         i; i = _rbuf_next[i - 1]) {
+        if (_rbuf_matches(&rbuf[i - 1], src, src_len, dst, dst_len, tag)) {
+            return &rbuf[i - 1];
+        }
+    }
+#else
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_matches(e, src, src_len, dst, dst_len, tag)) {
             return e;
         }
     }
+#endif
     return NULL;
 }
 
+static bool _rbuf_matches(const gnrc_sixlowpan_frag_rb_t *e,
+                          const void *src, size_t src_len,
+                          const void *dst, size_t dst_len,
+                          uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
@@ -338,7 +531,16 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    gnrc_sixlowpan_frag_rb_gc();
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)) {
+        /* the reassembly buffer is collected when its GC timer fires, but
+         * VRB entries are also created outside of this module */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+        gnrc_sixlowpan_frag_vrb_gc();
+#endif
+    }
+    else {
+        gnrc_sixlowpan_frag_rb_gc();
+    }
     /* only check VRB for subsequent frags, first frags create and not get VRB
      * entries below */
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) &&
@@ -347,32 +549,30 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         (entry.vrb = gnrc_sixlowpan_frag_vrb_get(src, netif_hdr->src_l2addr_len,
                                                  datagram_tag)) != NULL) {
         DEBUG("6lo rbuf minfwd: VRB entry found, trying to forward\n");
-        switch (_check_fragments(entry.super, frag_size, offset)) {
-            case RBUF_ADD_REPEAT:
+        switch (gnrc_sixlowpan_frag_rb_base_add_frag(entry.super, offset,
+                                                     frag_size)) {
+            case -EINVAL:
                 DEBUG("6lo rbuf minfwd: overlap found; dropping VRB\n");
                 gnrc_sixlowpan_frag_vrb_rm(entry.vrb);
                 /* we don't repeat for VRB */
                 gnrc_pktbuf_release(pkt);
                 return RBUF_ADD_ERROR;
-            case RBUF_ADD_DUPLICATE:
+            case -EEXIST:
                 DEBUG("6lo rbuf minfwd: not forwarding duplicate\n");
                 gnrc_pktbuf_release(pkt);
                 return RBUF_ADD_FORWARDED;
-            default:
+            case 0:
                 break;
-        }
-        res = RBUF_ADD_ERROR;
-        if (_rbuf_update_ints(entry.super, offset, frag_size)) {
-            DEBUG("6lo rbuf minfwd: trying to forward fragment\n");
-            entry.super->current_size += (uint16_t)frag_size;
-            if (_forward_frag(pkt, sizeof(sixlowpan_frag_n_t), entry.vrb,
-                              page) < 0) {
-                DEBUG("6lo rbuf minfwd: unable to forward fragment\n");
+            default:
                 return RBUF_ADD_ERROR;
-            }
-            res = RBUF_ADD_FORWARDED;
         }
-        return res;
+        DEBUG("6lo rbuf minfwd: trying to forward fragment\n");
+        if (_forward_frag(pkt, sizeof(sixlowpan_frag_n_t), entry.vrb,
+                          page) < 0) {
+            DEBUG("6lo rbuf minfwd: unable to forward fragment\n");
+            return RBUF_ADD_ERROR;
+        }
+        return RBUF_ADD_FORWARDED;
     }
     else if ((res = _rbuf_get(src, netif_hdr->src_l2addr_len,
                               dst, netif_hdr->dst_l2addr_len,
@@ -382,6 +582,11 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
     entry.rbuf = &rbuf[res];
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    bool bitmap = _rbuf_uses_bitmap(entry.rbuf, pkt);
+#else
+    bool bitmap = false;
+#endif
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     offset += entry.rbuf->offset_diff;
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
@@ -393,7 +598,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    switch (_check_fragments(entry.super, frag_size, offset)) {
+    switch (_rbuf_check_fragments(entry.rbuf, bitmap, frag_size, offset)) {
         case RBUF_ADD_REPEAT:
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
             gnrc_pktbuf_release(entry.rbuf->pkt);
@@ -406,7 +611,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             break;
     }
 
-    if (_rbuf_update_ints(entry.super, offset, frag_size)) {
+    if (_rbuf_update(entry.rbuf, bitmap, offset, frag_size)) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry.super->current_size += (uint16_t)frag_size;
         if (offset == 0) {
@@ -581,6 +786,12 @@ void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
     unsigned int i;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    uint32_t next_deadline = 0;
+    bool pending = false;
+
+    _gc_armed = false;
+#endif
 
     for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* since pkt occupies pktbuf, aggressively collect garbage */
@@ -600,7 +811,24 @@ void gnrc_sixlowpan_frag_rb_gc(void)
             _gc_pkt(&rbuf[i]);
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
         }
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+        else if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            uint32_t deadline = rbuf[i].super.arrival +
+                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US + 1;
+
+            if (!pending || ((int32_t)(deadline - next_deadline) < 0)) {
+                next_deadline = deadline;
+            }
+            pending = true;
+        }
+#endif
+    }
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    if (pending) {
+        /* collect the next entry to time out */
+        _gc_schedule(next_deadline);
     }
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
 #endif
@@ -608,8 +836,50 @@ void gnrc_sixlowpan_frag_rb_gc(void)
 
 static inline void _set_rbuf_timeout(void)
 {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    /* entries only time out later than the timer fires for the oldest */
+    _gc_schedule(xtimer_now_usec() + CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US + 1);
+#else
     xtimer_set_msg(&_gc_timer, CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US,
                    &_gc_timer_msg, thread_getpid());
+#endif
+}
+
+/* checks if the datagram size of an entry matches */
+static inline bool _rbuf_size_matches(const gnrc_sixlowpan_frag_rb_t *e,
+                                      size_t size)
+{
+    return (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+            /* not all SFR fragments carry the datagram size, so make 0 a
+             * legal value to not compare datagram size */
+            ((size == 0) || (e->super.datagram_size == size))) ||
+           (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+            (e->super.datagram_size == size));
+}
+
+/* refreshes an existing entry a fragment was received for */
+static int _rbuf_found(unsigned i, uint32_t now_usec)
+{
+    DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
+          gnrc_netif_addr_to_str(rbuf[i].super.src,
+                                 rbuf[i].super.src_len,
+                                 l2addr_str));
+    DEBUG("%s, %u, %u) found\n",
+          gnrc_netif_addr_to_str(rbuf[i].super.dst,
+                                 rbuf[i].super.dst_len,
+                                 l2addr_str),
+          (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+    if (rbuf[i].super.current_size == 0) {
+        /* ensure that only empty reassembly buffer entries and entries
+         * scheduled for deletion have `current_size == 0` */
+        DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+        return -1;
+    }
+#endif
+    rbuf[i].super.arrival = now_usec;
+    _set_rbuf_timeout();
+    return i;
 }
 
 static int _rbuf_get(const void *src, size_t src_len,
@@ -620,44 +890,33 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    /* check first if entry already available */
+    for (uint16_t i = _rbuf_buckets[_rbuf_hash(src, src_len, dst, dst_len, tag)];
+         i; i = _rbuf_next[i - 1]) {
+        if (_rbuf_matches(&rbuf[i - 1], src, src_len, dst, dst_len, tag) &&
+            _rbuf_size_matches(&rbuf[i - 1], size)) {
+            return _rbuf_found(i - 1, now_usec);
+        }
+    }
+#endif
+
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+#if !IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
         /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (_rbuf_matches(&rbuf[i], src, src_len, dst, dst_len, tag) &&
+            _rbuf_size_matches(&rbuf[i], size)) {
+            return _rbuf_found(i, now_usec);
         }
+#endif
 
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
+            if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)) {
+                /* the entry was already looked up */
+                break;
+            }
         }
 
         /* remember oldest slot */
@@ -746,6 +1005,13 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    memset(res->units, 0U, sizeof(res->units));
+    memset(res->starts, 0U, sizeof(res->starts));
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    _rbuf_index_add(res);
+#endif
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -772,6 +1038,10 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    _gc_armed = false;
+#endif
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -782,6 +1052,21 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+    uintptr_t addr = (uintptr_t)entry;
+
+    /* VRB entries share the base type, but are not indexed */
+    if ((addr >= (uintptr_t)&rbuf[0]) &&
+        (addr < (uintptr_t)&rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE])) {
+        gnrc_sixlowpan_frag_rb_t *e = container_of(entry,
+                                                   gnrc_sixlowpan_frag_rb_t,
+                                                   super);
+
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(e)) {
+            _rbuf_index_rm(e);
+        }
+    }
+#endif
     while (entry->ints != NULL) {
         gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
 
@@ -793,6 +1078,24 @@ void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
     entry->datagram_size = 0;
 }
 
+int gnrc_sixlowpan_frag_rb_base_add_frag(gnrc_sixlowpan_frag_rb_base_t *entry,
+                                         size_t offset, size_t frag_size)
+{
+    switch (_check_fragments(entry, frag_size, offset)) {
+        case RBUF_ADD_REPEAT:
+            return -EINVAL;
+        case RBUF_ADD_DUPLICATE:
+            return -EEXIST;
+        default:
+            break;
+    }
+    if (!_rbuf_update_ints(entry, offset, frag_size)) {
+        return -ENOMEM;
+    }
+    entry->current_size += (uint16_t)frag_size;
+    return 0;
+}
+
 static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0U
@@ -807,6 +1110,9 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_INDEX)
+        _gc_schedule(xtimer_now_usec() + CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER + 1);
+#endif
 #else   /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER == 0U */
         gnrc_sixlowpan_frag_rb_remove(rbuf);
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER */
@@ -822,6 +1128,9 @@ static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
         frag = frag->next;
         frags++;
     }
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    frags += bf_popcnt(rbuf->starts, sizeof(rbuf->starts) * 8);
+#endif
     return frags;
 }
 #endif
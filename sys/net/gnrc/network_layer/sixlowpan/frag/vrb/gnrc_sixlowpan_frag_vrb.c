@@ -19,6 +19,11 @@
 #include "net/gnrc/ipv6/nib.h"
 #endif  /* MODULE_GNRC_IPV6_NIB */
 #include "net/gnrc/netif.h"
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/sixlowpan.h"
+#endif
 #include "xtimer.h"
 
 #include "net/gnrc/sixlowpan/frag/fb.h"
@@ -37,6 +42,10 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 static char addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 #endif  /* MODULE_GNRC_IPV6_NIB */
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+static mutex_t _vrb_lock = MUTEX_INIT;
+#endif
+
 static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
                                 const uint8_t *src, size_t src_len,
                                 unsigned tag)
@@ -230,6 +239,95 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
     }
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+void gnrc_sixlowpan_frag_vrb_lock(void)
+{
+    mutex_lock(&_vrb_lock);
+}
+
+void gnrc_sixlowpan_frag_vrb_unlock(void)
+{
+    mutex_unlock(&_vrb_lock);
+}
+
+bool gnrc_sixlowpan_frag_vrb_fast_forward(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_snip = pkt->next;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    gnrc_netif_hdr_t *netif_hdr;
+    sixlowpan_frag_n_t *frag = pkt->data;
+    gnrc_netif_t *out_netif;
+    bool last;
+
+    /* the headers are rewritten in place, so nobody else may hold them */
+    if ((pkt->type != GNRC_NETTYPE_SIXLOWPAN) || (pkt->users > 1) ||
+        (pkt->size <= sizeof(sixlowpan_frag_n_t)) ||
+        !sixlowpan_frag_n_is(pkt->data) ||
+        (netif_snip == NULL) || (netif_snip->type != GNRC_NETTYPE_NETIF) ||
+        (netif_snip->users > 1) || (netif_snip->next != NULL)) {
+        return false;
+    }
+    if (!mutex_trylock(&_vrb_lock)) {
+        /* 6LoWPAN thread is busy, it might be using the VRB */
+        return false;
+    }
+    netif_hdr = netif_snip->data;
+    vrbe = gnrc_sixlowpan_frag_vrb_get(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                       netif_hdr->src_l2addr_len,
+                                       sixlowpan_frag_datagram_tag(pkt->data));
+    /* the link-layer header to the next hop needs to fit into the one the
+     * fragment was received with */
+    if ((vrbe == NULL) ||
+        (vrbe->super.dst_len > (netif_hdr->src_l2addr_len +
+                                netif_hdr->dst_l2addr_len))) {
+        mutex_unlock(&_vrb_lock);
+        return false;
+    }
+    switch (gnrc_sixlowpan_frag_rb_base_add_frag(
+                &vrbe->super, sixlowpan_frag_offset(frag),
+                pkt->size - sizeof(sixlowpan_frag_n_t))) {
+        case 0:
+            break;
+        case -EINVAL:
+            DEBUG("6lo vrb fast: overlap found; dropping VRB\n");
+            gnrc_sixlowpan_frag_vrb_rm(vrbe);
+            /* fall through */
+        default:
+            DEBUG("6lo vrb fast: not forwarding fragment\n");
+            mutex_unlock(&_vrb_lock);
+            gnrc_pktbuf_release(pkt);
+            return true;
+    }
+    frag->tag = byteorder_htons(vrbe->out_tag);
+    out_netif = vrbe->out_netif;
+    last = (vrbe->super.current_size >= vrbe->super.datagram_size);
+    gnrc_netif_hdr_init(netif_hdr, 0, vrbe->super.dst_len);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr, vrbe->super.dst,
+                                vrbe->super.dst_len);
+    if (last) {
+        DEBUG("6lo vrb fast: current_size (%u) >= datagram_size (%u)\n",
+              vrbe->super.current_size, vrbe->super.datagram_size);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    }
+    else {
+        netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    mutex_unlock(&_vrb_lock);
+    gnrc_netif_hdr_set_netif(netif_hdr, out_netif);
+    /* shrinking is done in place */
+    gnrc_pktbuf_realloc_data(netif_snip, gnrc_netif_hdr_sizeof(netif_hdr));
+    /* reverse order from reception to sending */
+    pkt->next = NULL;
+    netif_snip->next = pkt;
+    if (gnrc_netif_send(out_netif, netif_snip) < 1) {
+        DEBUG("6lo vrb fast: unable to send %p over interface %u\n",
+              (void *)netif_snip, out_netif->pid);
+        gnrc_pktbuf_release(netif_snip);
+    }
+    return true;
+}
+#endif
+
 #ifdef TEST_SUITES
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
@@ -23,6 +23,9 @@
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
@@ -406,6 +409,11 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
         msg_receive(&msg);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+        /* network interfaces forward fragments through the VRB while we are
+         * idle */
+        gnrc_sixlowpan_frag_vrb_lock();
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -451,6 +459,9 @@ static void *_event_loop(void *args)
                 DEBUG("6lo: operation not supported\n");
                 break;
         }
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+        gnrc_sixlowpan_frag_vrb_unlock();
+#endif
     }
 
     return NULL;
@@ -154,6 +154,83 @@ static inline bool _context_overlaps_iid(gnrc_sixlowpan_ctx_t *ctx,
              (iid->uint8[(ctx->prefix_len / 8) - 8] & byte_mask[ctx->prefix_len % 8])));
 }
 
+static gnrc_sixlowpan_ctx_t *_compression_ctx(const ipv6_addr_t *addr)
+{
+    gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_addr(addr);
+
+    /* do not use context for compression if */
+    /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
+    if (ctx && !(ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
+        return NULL;
+    }
+    /* prefix bits not covered by context information must be zero */
+    if (ctx &&
+        ipv6_addr_match_prefix(&ctx->prefix, addr) < SIXLOWPAN_IPHC_PREFIX_LEN) {
+        return NULL;
+    }
+    return ctx;
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE)
+static inline unsigned _flow_cache_gen(const gnrc_netif_t *iface)
+{
+    /* both generations only ever increase, so their sum changes whenever one
+     * of them does */
+    return gnrc_sixlowpan_ctx_generation() + iface->sixlo.iphc_flow_gen;
+}
+
+static const gnrc_netif_6lo_iphc_flow_t *_flow_cache_get(
+        const gnrc_netif_t *iface, const ipv6_hdr_t *ipv6_hdr,
+        const gnrc_netif_hdr_t *netif_hdr, unsigned gen)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE_SIZE; i++) {
+        const gnrc_netif_6lo_iphc_flow_t *flow = &iface->sixlo.iphc_flows[i];
+
+        if (flow->used && (flow->gen == gen) &&
+            (flow->nh == ipv6_hdr->nh) &&
+            (flow->l2_dst_len == netif_hdr->dst_l2addr_len) &&
+            ipv6_addr_equal(&flow->dst, &ipv6_hdr->dst) &&
+            ipv6_addr_equal(&flow->src, &ipv6_hdr->src) &&
+            (memcmp(flow->l2_dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    flow->l2_dst_len) == 0)) {
+            DEBUG("6lo iphc: found flow in cache\n");
+            return flow;
+        }
+    }
+    return NULL;
+}
+
+static void _flow_cache_add(gnrc_netif_t *iface, const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr, unsigned gen,
+                            const uint8_t *iphc_hdr, const uint8_t *addr_inline,
+                            size_t addr_inline_len)
+{
+    gnrc_netif_6lo_iphc_flow_t *flow;
+
+    if ((netif_hdr->dst_l2addr_len > sizeof(flow->l2_dst)) ||
+        (addr_inline_len > sizeof(flow->addr_inline))) {
+        return;
+    }
+    /* replace entries round-robin */
+    flow = &iface->sixlo.iphc_flows[iface->sixlo.iphc_flow_next++];
+    if (iface->sixlo.iphc_flow_next >= CONFIG_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE_SIZE) {
+        iface->sixlo.iphc_flow_next = 0;
+    }
+    flow->src = ipv6_hdr->src;
+    flow->dst = ipv6_hdr->dst;
+    memcpy(flow->l2_dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    flow->l2_dst_len = netif_hdr->dst_l2addr_len;
+    flow->nh = ipv6_hdr->nh;
+    flow->iphc2 = iphc_hdr[IPHC2_IDX];
+    flow->cid = iphc_hdr[CID_EXT_IDX];
+    flow->gen = gen;
+    flow->used = true;
+    memcpy(flow->addr_inline, addr_inline, addr_inline_len);
+    flow->addr_inline_len = addr_inline_len;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE) */
+
 static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
                                     const gnrc_netif_hdr_t *netif_hdr,
                                     gnrc_netif_t *netif);
@@ -1079,9 +1156,11 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                                 uint8_t *iphc_hdr)
 {
     gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
+    const gnrc_netif_6lo_iphc_flow_t *flow = NULL;
     ipv6_hdr_t *ipv6_hdr;
     bool addr_comp = false;
     uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+    uint16_t addr_pos;
 
     assert(iface != NULL);
 
@@ -1095,47 +1174,41 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
     iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
     iphc_hdr[IPHC2_IDX] = 0;
 
-    /* check for available contexts */
-    if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        src_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->src));
-        /* do not use source context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (src_ctx && !(src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            src_ctx = NULL;
-        }
-        /* prefix bits not covered by context information must be zero */
-        if (src_ctx &&
-            ipv6_addr_match_prefix(&src_ctx->prefix, &ipv6_hdr->src) < SIXLOWPAN_IPHC_PREFIX_LEN) {
-            src_ctx = NULL;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE)
+    unsigned flow_gen = _flow_cache_gen(iface);
+
+    flow = _flow_cache_get(iface, ipv6_hdr, netif_hdr, flow_gen);
+#endif
+    if (flow != NULL) {
+        /* address compression is already known for this flow */
+        iphc_hdr[IPHC2_IDX] = flow->iphc2;
+        if (flow->iphc2 & SIXLOWPAN_IPHC2_CID_EXT) {
+            iphc_hdr[CID_EXT_IDX] = flow->cid;
+            inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
         }
     }
-
-    if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
-        dst_ctx = gnrc_sixlowpan_ctx_lookup_addr(&(ipv6_hdr->dst));
-        /* do not use destination context for compression if */
-        /* GNRC_SIXLOWPAN_CTX_FLAGS_COMP is not set */
-        if (dst_ctx && !(dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP)) {
-            dst_ctx = NULL;
+    else {
+        /* check for available contexts */
+        if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
+            src_ctx = _compression_ctx(&ipv6_hdr->src);
         }
-        /* prefix bits not covered by context information must be zero */
-        if (dst_ctx &&
-            ipv6_addr_match_prefix(&dst_ctx->prefix, &ipv6_hdr->dst) < SIXLOWPAN_IPHC_PREFIX_LEN) {
-            dst_ctx = NULL;
+        if (!ipv6_addr_is_multicast(&ipv6_hdr->dst)) {
+            dst_ctx = _compression_ctx(&ipv6_hdr->dst);
         }
-    }
-
-    /* if contexts available and both != 0 */
-    /* since this moves inline_pos we have to do this ahead*/
-    if (((src_ctx != NULL) &&
-            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
-        ((dst_ctx != NULL) &&
-            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
-        /* add context identifier extension */
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
-        iphc_hdr[CID_EXT_IDX] = 0;
 
-        /* move position to behind CID extension */
-        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+        /* if contexts available and both != 0 */
+        /* since this moves inline_pos we have to do this ahead*/
+        if (((src_ctx != NULL) &&
+                ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
+            ((dst_ctx != NULL) &&
+                ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
+            /* add context identifier extension */
+            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
+            iphc_hdr[CID_EXT_IDX] = 0;
+
+            /* move position to behind CID extension */
+            inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+        }
     }
 
     /* compress flow label and traffic class */
@@ -1197,6 +1270,12 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
             break;
     }
 
+    if (flow != NULL) {
+        memcpy(iphc_hdr + inline_pos, flow->addr_inline, flow->addr_inline_len);
+        return inline_pos + flow->addr_inline_len;
+    }
+    addr_pos = inline_pos;
+
     if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
         iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
     }
@@ -1369,6 +1448,12 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         inline_pos += 16;
     }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_FLOW_CACHE)
+    _flow_cache_add(iface, ipv6_hdr, netif_hdr, flow_gen, iphc_hdr,
+                    iphc_hdr + addr_pos, inline_pos - addr_pos);
+#else
+    (void)addr_pos;
+#endif
     return inline_pos;
 }
 
@@ -24,6 +24,112 @@
 
 mutex_t gnrc_pktbuf_mutex = MUTEX_INIT;
 
+#if CONFIG_GNRC_PKTBUF_LENT_NUMOF
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    void (*release)(void *arg);
+    void *arg;
+    uint16_t users;
+} _lent_t;
+
+static _lent_t _lent[CONFIG_GNRC_PKTBUF_LENT_NUMOF];
+
+static _lent_t *_lent_get(const void *ptr)
+{
+    const uint8_t *pos = ptr;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_LENT_NUMOF; i++) {
+        if ((_lent[i].users > 0) && (pos >= _lent[i].data) &&
+            (pos < (_lent[i].data + _lent[i].size))) {
+            return &_lent[i];
+        }
+    }
+    return NULL;
+}
+
+bool gnrc_pktbuf_lent_contains(const void *ptr)
+{
+    return _lent_get(ptr) != NULL;
+}
+
+bool gnrc_pktbuf_lent_hold(const void *data)
+{
+    _lent_t *lent = _lent_get(data);
+
+    if (lent == NULL) {
+        return false;
+    }
+    assert(lent->users < UINT16_MAX);
+    lent->users++;
+    return true;
+}
+
+bool gnrc_pktbuf_lent_release(const void *data)
+{
+    _lent_t *lent = _lent_get(data);
+
+    if (lent == NULL) {
+        return false;
+    }
+    if (--lent->users == 0) {
+        DEBUG("pktbuf: returning lent data %p\n", (void *)lent->data);
+        lent->release(lent->arg);
+    }
+    return true;
+}
+#endif
+
+gnrc_pktsnip_t *gnrc_pktbuf_add_lent(gnrc_pktsnip_t *next, void *data, size_t size,
+                                     gnrc_nettype_t type,
+                                     void (*release)(void *arg), void *arg)
+{
+#if CONFIG_GNRC_PKTBUF_LENT_NUMOF
+    gnrc_pktsnip_t *pkt;
+    _lent_t *lent = NULL;
+
+    assert((data != NULL) && (size > 0) && (release != NULL));
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_LENT_NUMOF; i++) {
+        if (_lent[i].users == 0) {
+            lent = &_lent[i];
+            /* reserve the slot */
+            lent->users = 1;
+            lent->size = 0;
+            break;
+        }
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    if (lent == NULL) {
+        DEBUG("pktbuf: no slot left for lent data\n");
+        return NULL;
+    }
+    pkt = gnrc_pktbuf_add(next, NULL, 0, type);
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        lent->users = 0;
+    }
+    else {
+        lent->data = data;
+        lent->size = size;
+        lent->release = release;
+        lent->arg = arg;
+        pkt->data = data;
+        pkt->size = size;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+#else
+    (void)next;
+    (void)data;
+    (void)size;
+    (void)type;
+    (void)release;
+    (void)arg;
+    return NULL;
+#endif
+}
+
 gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt,
                                         gnrc_pktsnip_t *snip)
 {
@@ -27,6 +27,7 @@
 #include <stdlib.h>
 
 #include "mutex.h"
+#include "net/gnrc/pktbuf.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -65,6 +66,61 @@ bool gnrc_pktbuf_contains(void *ptr);
  */
 void gnrc_pktbuf_free_internal(void *data, size_t size);
 
+#if CONFIG_GNRC_PKTBUF_LENT_NUMOF || defined(DOXYGEN)
+/**
+ * @brief   Checks if a pointer points into data lent to the packet buffer
+ *
+ * @param[in] ptr   a pointer
+ *
+ * @return  true, if @p ptr points into data added with gnrc_pktbuf_add_lent()
+ */
+bool gnrc_pktbuf_lent_contains(const void *ptr);
+
+/**
+ * @brief   Adds a user to lent data, if @p data points into lent data
+ *
+ * Used when lent data is split in place.
+ *
+ * @pre     @ref gnrc_pktbuf_mutex is locked
+ *
+ * @param[in] data  a data section
+ *
+ * @return  true, if @p data points into lent data
+ */
+bool gnrc_pktbuf_lent_hold(const void *data);
+
+/**
+ * @brief   Removes a user from lent data, if @p data points into lent data
+ *
+ * Hands the data back to its owner when the last user is removed.
+ *
+ * @pre     @ref gnrc_pktbuf_mutex is locked
+ *
+ * @param[in] data  a data section
+ *
+ * @return  true, if @p data points into lent data
+ */
+bool gnrc_pktbuf_lent_release(const void *data);
+#else
+static inline bool gnrc_pktbuf_lent_contains(const void *ptr)
+{
+    (void)ptr;
+    return false;
+}
+
+static inline bool gnrc_pktbuf_lent_hold(const void *data)
+{
+    (void)data;
+    return false;
+}
+
+static inline bool gnrc_pktbuf_lent_release(const void *data)
+{
+    (void)data;
+    return false;
+}
+#endif
+
 /* for testing */
 #ifdef TEST_SUITES
 /**
@@ -135,6 +135,14 @@ static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t ty
         _set_pktsnip(pkt, header, NULL, 0, pkt->type);
         return header;
     }
+    if (gnrc_pktbuf_lent_hold(pkt->data)) {
+        /* lent data is split in place */
+        _set_pktsnip(header, pkt->next, pkt->data, size, type);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+        pkt->size -= size;
+        pkt->next = header;
+        return header;
+    }
     /* we can not just "snip off" something from the end of a malloc'd section
      * so we need to realloc for marked snip */
     payload = _malloc(pkt->size - size);
@@ -181,9 +189,22 @@ static int _realloc_data(gnrc_pktsnip_t *pkt, size_t size)
     /* new size is 0 and data pointer isn't already NULL */
     if ((size == 0) && (pkt->data != NULL)) {
         /* set data pointer to NULL */
-        _free(pkt->data);
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
         pkt->data = NULL;
     }
+    else if ((pkt->data != NULL) && gnrc_pktbuf_lent_contains(pkt->data)) {
+        /* lent data is shrunk in place, but has to be copied to grow */
+        if (size > pkt->size) {
+            void *data = _malloc(size);
+            if (data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                return ENOMEM;
+            }
+            memcpy(data, pkt->data, pkt->size);
+            gnrc_pktbuf_lent_release(pkt->data);
+            pkt->data = data;
+        }
+    }
     else {
         void *data = (pkt->data) ? realloc(pkt->data, size) : _malloc(size);
         if (data == NULL) {
@@ -289,6 +310,9 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
 void gnrc_pktbuf_free_internal(void *data, size_t size)
 {
     (void)size;
+    if ((data != NULL) && gnrc_pktbuf_lent_release(data)) {
+        return;
+    }
     _free(data);
 }
 
@@ -0,0 +1,604 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer with segregated pools of fixed size blocks
+ *
+ * Every size class is a static pool of equally sized blocks with its own
+ * free list, so allocation and release are O(1) and the pools never need to
+ * be defragmented. gnrc_pktbuf_mark() keeps the marked data in place and, if
+ * the split point is aligned, the rest as well, so a block may be shared by
+ * several snips. Each block has a reference counter for that, and is only
+ * returned to its free list when the last data section in it is released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "od.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "string_utils.h"
+
+#include "pktbuf_internal.h"
+#include "pktbuf_sizeclass.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* blocks are aligned to 8 bytes */
+#define _ALIGN(size)        (((size) + 7) & ~((size_t)7))
+
+#define _SNIP_SIZE          _ALIGN(sizeof(gnrc_pktsnip_t))
+#define _SNIP_BYTES         (_SNIP_SIZE * CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF)
+#define _HDR_BYTES          (CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE * \
+                             CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF)
+#define _FRAME_BYTES        (CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE * \
+                             CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_NUMOF)
+#define _MTU_BYTES          (CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE * \
+                             CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_NUMOF)
+#define _ARENA_SIZE         (_SNIP_BYTES + _HDR_BYTES + _FRAME_BYTES + _MTU_BYTES)
+#define _BLOCKS_NUMOF       (CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF + \
+                             CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF + \
+                             CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_NUMOF + \
+                             CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_NUMOF)
+
+static_assert((CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE % 8) == 0,
+              "CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE has to be a multiple of 8");
+static_assert((CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE % 8) == 0,
+              "CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE has to be a multiple of 8");
+static_assert((CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE % 8) == 0,
+              "CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE has to be a multiple of 8");
+static_assert((_SNIP_SIZE <= CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE) &&
+              (CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE <=
+               CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE) &&
+              (CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE <=
+               CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE),
+              "gnrc_pktbuf_sizeclass: size classes have to be ordered by size");
+static_assert(_BLOCKS_NUMOF <= UINT16_MAX,
+              "gnrc_pktbuf_sizeclass: too many blocks");
+
+/**
+ * @brief   Marks an unused block
+ */
+typedef struct _free {
+    struct _free *next;     /**< next unused block of the same class */
+} _free_t;
+
+/**
+ * @brief   Layout of a size class in the arena
+ */
+typedef struct {
+    uint16_t size;          /**< block size */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t first;         /**< index of the first block in _block_users */
+    size_t offset;          /**< offset of the first block in the arena */
+} _class_t;
+
+/**
+ * @brief   Run time state of a size class
+ */
+typedef struct {
+    _free_t *free;          /**< first unused block */
+    uint16_t used;          /**< blocks in use */
+    uint16_t used_max;      /**< high-water mark of blocks in use */
+    uint32_t allocs;        /**< allocations taken from this class */
+    uint32_t fallbacks;     /**< allocations that had to use a bigger class */
+    size_t requested;       /**< bytes requested by the blocks in use */
+} _pool_t;
+
+static const _class_t _classes[GNRC_PKTBUF_SIZECLASS_NUMOF] = {
+    [GNRC_PKTBUF_SIZECLASS_SNIP] = {
+        .size = _SNIP_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF,
+        .first = 0,
+        .offset = 0,
+    },
+    [GNRC_PKTBUF_SIZECLASS_HDR] = {
+        .size = CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF,
+        .offset = _SNIP_BYTES,
+    },
+    [GNRC_PKTBUF_SIZECLASS_FRAME] = {
+        .size = CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF +
+                 CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF,
+        .offset = _SNIP_BYTES + _HDR_BYTES,
+    },
+    [GNRC_PKTBUF_SIZECLASS_MTU] = {
+        .size = CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_NUMOF,
+        .first = CONFIG_GNRC_PKTBUF_SIZECLASS_SNIP_NUMOF +
+                 CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF +
+                 CONFIG_GNRC_PKTBUF_SIZECLASS_FRAME_NUMOF,
+        .offset = _SNIP_BYTES + _HDR_BYTES + _FRAME_BYTES,
+    },
+};
+
+static alignas(uint64_t) uint8_t _arena[_ARENA_SIZE];
+static _pool_t _pools[GNRC_PKTBUF_SIZECLASS_NUMOF];
+/* number of data sections (or the snip) using a block, 0 if unused */
+static uint16_t _block_users[_BLOCKS_NUMOF];
+static uint32_t _fails;
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static inline uint8_t *_block(unsigned cls, unsigned blk)
+{
+    return &_arena[_classes[cls].offset + (blk * _classes[cls].size)];
+}
+
+/* finds size class and block number of a pointer into the arena */
+static unsigned _locate(const void *ptr, unsigned *blk)
+{
+    size_t offset = (uintptr_t)ptr - (uintptr_t)_arena;
+    unsigned cls = GNRC_PKTBUF_SIZECLASS_NUMOF - 1;
+
+    while (offset < _classes[cls].offset) {
+        cls--;
+    }
+    *blk = (offset - _classes[cls].offset) / _classes[cls].size;
+    return cls;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_arena, GNRC_PKTBUF_CANARY, sizeof(_arena));
+    }
+    memset(_pools, 0, sizeof(_pools));
+    memset(_block_users, 0, sizeof(_block_users));
+    _fails = 0;
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SIZECLASS_NUMOF; cls++) {
+        /* push in reverse, so blocks are handed out in ascending order */
+        for (unsigned blk = _classes[cls].numof; blk > 0; blk--) {
+            /* Silence false -Wcast-align: blocks are aligned to 8 bytes */
+            _free_t *b = (_free_t *)(uintptr_t)_block(cls, blk - 1);
+            b->next = _pools[cls].free;
+            _pools[cls].free = b;
+        }
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE (%u)\n",
+              size, CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    new_data_marked = pkt->data;
+    /* the rest would not be aligned => move it to its own block (lent data is
+     * always split in place) */
+    if ((pkt->size != size) && (_ALIGN(size) != size) &&
+        gnrc_pktbuf_contains(pkt->data)) {
+        void *new_data_rest = _pktbuf_alloc(pkt->size - size);
+        unsigned blk;
+        unsigned cls = _locate(pkt->data, &blk);
+
+        if (new_data_rest == NULL) {
+            DEBUG("pktbuf: could not reallocate remaining section.\n");
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
+        _pools[cls].requested -= pkt->size - size;
+        pkt->data = new_data_rest;
+    }
+    /* blocks are reference counted, so both sections can stay in place */
+    else if (pkt->size != size) {
+        if (!gnrc_pktbuf_lent_hold(pkt->data)) {
+            unsigned blk;
+            unsigned cls = _locate(pkt->data, &blk);
+
+            assert(_block_users[_classes[cls].first + blk] < UINT16_MAX);
+            _block_users[_classes[cls].first + blk]++;
+        }
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) &&
+            (gnrc_pktbuf_contains(pkt->data) || gnrc_pktbuf_lent_contains(pkt->data))));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    else if ((pkt->data != NULL) && !gnrc_pktbuf_contains(pkt->data)) {
+        /* lent data is shrunk in place, but has to be copied to grow */
+        if (size > pkt->size) {
+            void *new_data = _pktbuf_alloc(size);
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&gnrc_pktbuf_mutex);
+                return ENOMEM;
+            }
+            memcpy(new_data, pkt->data, pkt->size);
+            gnrc_pktbuf_lent_release(pkt->data);
+            pkt->data = new_data;
+        }
+    }
+    else if (pkt->data != NULL) {
+        unsigned blk;
+        unsigned cls = _locate(pkt->data, &blk);
+        size_t end = ((uint8_t *)pkt->data - _block(cls, blk)) + size;
+
+        /* shrinking always fits, growing only if no other section shares the
+         * rest of the block */
+        if ((size < pkt->size) ||
+            ((_block_users[_classes[cls].first + blk] == 1) &&
+             (end <= _classes[cls].size))) {
+            _pools[cls].requested += size;
+            _pools[cls].requested -= pkt->size;
+        }
+        else {
+            void *new_data = _pktbuf_alloc(size);
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&gnrc_pktbuf_mutex);
+                return ENOMEM;
+            }
+            memcpy(new_data, pkt->data, pkt->size);
+            gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+            pkt->data = new_data;
+        }
+    }
+    else {
+        pkt->data = _pktbuf_alloc(size);
+        if (pkt->data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        assert(pkt->users + num <= 0xff);
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        pkt->users == GNRC_PKTBUF_CANARY) {
+        puts("gnrc_pktbuf: use after free detected\n");
+        DEBUG_BREAKPOINT(3);
+    }
+
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+void gnrc_pktbuf_sizeclass_get_stats(unsigned cls,
+                                     gnrc_pktbuf_sizeclass_stats_t *stats)
+{
+    assert(cls < GNRC_PKTBUF_SIZECLASS_NUMOF);
+    mutex_lock(&gnrc_pktbuf_mutex);
+    stats->size = _classes[cls].size;
+    stats->numof = _classes[cls].numof;
+    stats->used = _pools[cls].used;
+    stats->used_max = _pools[cls].used_max;
+    stats->allocs = _pools[cls].allocs;
+    stats->fallbacks = _pools[cls].fallbacks;
+    stats->requested = _pools[cls].requested;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+uint32_t gnrc_pktbuf_sizeclass_get_fails(void)
+{
+    return _fails;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snip", "hdr", "frame", "mtu" };
+    size_t in_use = 0, lost = 0;
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_arena[0], (void *)&_arena[sizeof(_arena)],
+           (unsigned)sizeof(_arena));
+    puts("  class  size  used   max  numof     allocs  fallbacks  lost");
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SIZECLASS_NUMOF; cls++) {
+        gnrc_pktbuf_sizeclass_stats_t stats;
+        size_t cls_lost;
+
+        gnrc_pktbuf_sizeclass_get_stats(cls, &stats);
+        cls_lost = ((size_t)stats.used * stats.size) - stats.requested;
+        printf("  %-5s %5u %5u %5u  %5u %10" PRIu32 " %10" PRIu32 " %5u\n",
+               names[cls], stats.size, stats.used, stats.used_max,
+               stats.numof, stats.allocs, stats.fallbacks, (unsigned)cls_lost);
+        in_use += (size_t)stats.used * stats.size;
+        lost += cls_lost;
+    }
+    printf("  bytes in use: %u (%u lost to rounding), failed allocations: %" PRIu32 "\n",
+           (unsigned)in_use, (unsigned)lost, _fails);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SIZECLASS_NUMOF; cls++) {
+        if (_pools[cls].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - every block in the free list of a class is a block of that class and
+     *    has no users
+     *  - the number of blocks in the free list of a class plus the number of
+     *    blocks with users is the number of blocks of that class
+     *  - the number of blocks with users is the used counter of the class
+     */
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SIZECLASS_NUMOF; cls++) {
+        unsigned free = 0, used = 0;
+
+        for (_free_t *ptr = _pools[cls].free; ptr != NULL; ptr = ptr->next) {
+            unsigned blk;
+
+            if (!gnrc_pktbuf_contains(ptr) || (_locate(ptr, &blk) != cls) ||
+                ((uint8_t *)ptr != _block(cls, blk)) ||
+                (_block_users[_classes[cls].first + blk] != 0) ||
+                (++free > _classes[cls].numof)) {
+                return false;
+            }
+        }
+        for (unsigned blk = 0; blk < _classes[cls].numof; blk++) {
+            if (_block_users[_classes[cls].first + blk] != 0) {
+                used++;
+            }
+        }
+        if ((used != _pools[cls].used) || ((free + used) != _classes[cls].numof)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    unsigned cls = 0;
+
+    while ((cls < GNRC_PKTBUF_SIZECLASS_NUMOF) && (size > _classes[cls].size)) {
+        cls++;
+    }
+    /* take the next bigger class if the fitting one is exhausted */
+    for (unsigned c = cls; c < GNRC_PKTBUF_SIZECLASS_NUMOF; c++) {
+        _pool_t *pool = &_pools[c];
+        _free_t *ptr = pool->free;
+        unsigned blk;
+
+        if (ptr == NULL) {
+            continue;
+        }
+        pool->free = ptr->next;
+        if (++pool->used > pool->used_max) {
+            pool->used_max = pool->used;
+        }
+        pool->allocs++;
+        pool->requested += size;
+        if (c != cls) {
+            _pools[cls].fallbacks++;
+        }
+        _locate(ptr, &blk);
+        _block_users[_classes[c].first + blk] = 1;
+
+        const void *mismatch;
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+            (mismatch = memchk(ptr + 1, GNRC_PKTBUF_CANARY,
+                               _classes[c].size - sizeof(_free_t)))) {
+            printf("[%p] mismatch at offset %"PRIuPTR"/%u"
+                   " (ignoring %" PRIuSIZE " initial bytes that were repurposed)\n",
+                   (void *)ptr, (uintptr_t)mismatch - (uintptr_t)ptr,
+                   _classes[c].size, sizeof(_free_t));
+#ifdef MODULE_OD
+            od_hex_dump(ptr, _classes[c].size, 0);
+#endif
+            assert(0);
+        }
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            /* clear out canary */
+            memset(ptr, ~GNRC_PKTBUF_CANARY, _classes[c].size);
+        }
+        return ptr;
+    }
+    DEBUG("pktbuf: no block left for %" PRIuSIZE " bytes\n", size);
+    _fails++;
+    return NULL;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    unsigned blk, cls;
+    uint16_t *users;
+    _free_t *ptr;
+
+    if (data == NULL) {
+        return;
+    }
+
+    if (gnrc_pktbuf_lent_release(data)) {
+        return;
+    }
+
+    if (!gnrc_pktbuf_contains(data)) {
+        assert(0);
+        return;
+    }
+
+    cls = _locate(data, &blk);
+    users = &_block_users[_classes[cls].first + blk];
+    if (*users == 0) {
+        printf("pktbuf: double free detected! (at %p, len=%u)\n",
+               data, (unsigned)size);
+        DEBUG_BREAKPOINT(2);
+        return;
+    }
+    assert(_pools[cls].requested >= size);
+    _pools[cls].requested -= size;
+    if (--(*users) > 0) {
+        /* other sections of the block are still in use */
+        return;
+    }
+    /* Silence false -Wcast-align: blocks are aligned to 8 bytes */
+    ptr = (_free_t *)(uintptr_t)_block(cls, blk);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(ptr, GNRC_PKTBUF_CANARY, _classes[cls].size);
+    }
+    ptr->next = _pools[cls].free;
+    _pools[cls].free = ptr;
+    _pools[cls].used--;
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_arena;
+    const uintptr_t end = start + sizeof(_arena);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+/** @} */
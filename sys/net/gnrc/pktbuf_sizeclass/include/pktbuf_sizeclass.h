@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @brief   Internal definitions of the size class implementation of
+ *          @ref net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Size classes and their statistics, for usage in tests
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Size classes of the packet buffer, ordered by block size
+ */
+enum {
+    GNRC_PKTBUF_SIZECLASS_SNIP = 0,     /**< packet snip descriptors */
+    GNRC_PKTBUF_SIZECLASS_HDR,          /**< netif, IPv6 and other headers */
+    GNRC_PKTBUF_SIZECLASS_FRAME,        /**< link layer frames */
+    GNRC_PKTBUF_SIZECLASS_MTU,          /**< MTU sized payloads */
+    GNRC_PKTBUF_SIZECLASS_NUMOF,        /**< number of size classes */
+};
+
+/**
+ * @brief   Statistics of a size class
+ */
+typedef struct {
+    uint16_t size;          /**< block size in bytes */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t used;          /**< number of blocks currently in use */
+    uint16_t used_max;      /**< maximum number of blocks ever in use */
+    uint32_t allocs;        /**< number of allocations taken from this class */
+    /**
+     * @brief   number of allocations of this class's size served by a bigger
+     *          class, as this class was exhausted
+     */
+    uint32_t fallbacks;
+    size_t requested;       /**< bytes requested by the blocks in use */
+} gnrc_pktbuf_sizeclass_stats_t;
+
+/**
+ * @brief   Gets the statistics of a size class
+ *
+ * @param[in] cls       the size class
+ * @param[out] stats    the statistics of @p cls
+ */
+void gnrc_pktbuf_sizeclass_get_stats(unsigned cls,
+                                     gnrc_pktbuf_sizeclass_stats_t *stats);
+
+/**
+ * @brief   Gets the number of allocations that failed since initialization
+ *
+ * @return  number of failed allocations
+ */
+uint32_t gnrc_pktbuf_sizeclass_get_fails(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -120,8 +120,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         return NULL;
     }
     /* marked data would not fit _unused_t marker => move data around to allow
-     * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
+     * for proper free (lent data is always split in place) */
+    if ((pkt->size != size) && (size < required_new_size) &&
+        gnrc_pktbuf_contains(pkt->data)) {
         void *new_data_rest;
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
@@ -146,6 +147,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     }
     else {
         new_data_marked = pkt->data;
+        if (pkt->size != size) {
+            /* both sections now use the lent data */
+            gnrc_pktbuf_lent_hold(pkt->data);
+        }
         /* if (pkt->size - size) != 0 take remainder of data, otherwise set NULL */
         pkt->data = (pkt->size != size) ? (((uint8_t *)pkt->data) + size) :
                                           NULL;
@@ -164,7 +169,8 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
     mutex_lock(&gnrc_pktbuf_mutex);
     assert(pkt != NULL);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
-           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+           ((pkt->size > 0) && (pkt->data != NULL) &&
+            (gnrc_pktbuf_contains(pkt->data) || gnrc_pktbuf_lent_contains(pkt->data))));
     /* new size and old size are equal */
     if (size == pkt->size) {
         /* nothing to do */
@@ -191,7 +197,8 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
+    /* lent data is shrunk in place */
+    else if ((_align(pkt->size) > aligned_size) && gnrc_pktbuf_contains(pkt->data)) {
         gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + aligned_size,
                      pkt->size - aligned_size);
     }
@@ -467,6 +474,10 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         return;
     }
 
+    if (gnrc_pktbuf_lent_release(data)) {
+        return;
+    }
+
     if (!gnrc_pktbuf_contains(data)) {
         assert(0);
         return;
@@ -55,6 +55,19 @@ extern "C" {
  */
 #define GNRC_SOCK_DYN_PORTRANGE_ERR (0)
 
+/**
+ * @brief   Size of the bitmap of used ports in the dynamic port range
+ *
+ * With `gnrc_sock_check_reuse`, the dynamic ports of bound UDP socks are
+ * tracked in a bitmap, hashed by the port number. Only if the bit of a
+ * candidate port is set, the socks have to be searched for it. Must be a
+ * power of two. With @ref GNRC_SOCK_DYN_PORTRANGE_NUM bits, the bitmap is
+ * exact and the socks are never searched.
+ */
+#ifndef CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS
+#define CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS  (256U)
+#endif
+
 /**
  * @brief   Check if remote address of a UDP packet matches the address the socket
  *          is bound to.
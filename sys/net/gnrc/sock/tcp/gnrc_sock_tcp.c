@@ -21,6 +21,13 @@
 #include "net/sock/tcp.h"
 #include "sock_types.h"
 
+#ifdef SOCK_HAS_ASYNC
+#  include "net/sock/async.h"
+#endif
+#ifdef SOCK_HAS_ASYNC_CTX
+#  include "net/sock/async/event.h"
+#endif
+
 int sock_tcp_connect(sock_tcp_t *sock, const sock_tcp_ep_t *remote,
                      uint16_t local_port, uint16_t flags)
 {
@@ -68,6 +75,9 @@ void sock_tcp_disconnect(sock_tcp_t *sock)
     /* Asserts defined by API. */
     assert(sock != NULL);
     gnrc_tcp_close(sock);
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_event_close(sock_tcp_get_async_ctx(sock));
+#endif
 }
 
 void sock_tcp_stop_listen(sock_tcp_queue_t *queue)
@@ -75,6 +85,9 @@ void sock_tcp_stop_listen(sock_tcp_queue_t *queue)
     /* Asserts defined by API. */
     assert(queue != NULL);
     gnrc_tcp_stop_listen(queue);
+#ifdef SOCK_HAS_ASYNC_CTX
+    sock_event_close(sock_tcp_queue_get_async_ctx(queue));
+#endif
 }
 
 int sock_tcp_get_local(sock_tcp_t *sock, sock_tcp_ep_t *ep)
@@ -139,8 +152,48 @@ ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
     assert(sock != NULL);
     assert(data != NULL);
 
+#ifdef MODULE_SOCK_ASYNC_EVENT
+    /* Event handlers must not wait for the peer, that would stall all socks
+     * served by their event queue. They are notified with SOCK_ASYNC_MSG_SENT
+     * once more data can be queued. */
+    event_queue_t *queue = sock->async_ctx.queue;
+    if ((queue != NULL) && (queue->waiter == thread_get_active())) {
+        return gnrc_tcp_try_send(sock, data, len);
+    }
+#endif
+
     /* Forward call to gnrc_tcp_send.
      * NOTE: gnrc_tcp_send offers a timeout. By setting it to 0, the call blocks
      * until at least some data was transmitted. */
     return gnrc_tcp_send(sock, data, len, 0);
 }
+
+#ifdef SOCK_HAS_ASYNC
+void sock_tcp_set_cb(sock_tcp_t *sock, sock_tcp_cb_t cb, void *cb_arg)
+{
+    /* Asserts defined by API. */
+    assert(sock != NULL);
+    sock->async_cb_arg = cb_arg;
+    sock->async_cb = cb;
+}
+
+void sock_tcp_queue_set_cb(sock_tcp_queue_t *queue, sock_tcp_queue_cb_t cb, void *cb_arg)
+{
+    /* Asserts defined by API. */
+    assert(queue != NULL);
+    queue->async_cb_arg = cb_arg;
+    queue->async_cb = cb;
+}
+
+#ifdef SOCK_HAS_ASYNC_CTX
+sock_async_ctx_t *sock_tcp_get_async_ctx(sock_tcp_t *sock)
+{
+    return &sock->async_ctx;
+}
+
+sock_async_ctx_t *sock_tcp_queue_get_async_ctx(sock_tcp_queue_t *queue)
+{
+    return &queue->async_ctx;
+}
+#endif  /* SOCK_HAS_ASYNC_CTX */
+#endif  /* SOCK_HAS_ASYNC */
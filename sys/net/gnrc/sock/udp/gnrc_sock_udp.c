@@ -34,6 +34,7 @@
 #endif
 
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+#  include "bitfield.h"
 #  include "utlist.h"
 #endif
 
@@ -42,7 +43,76 @@
 #include "debug.h"
 
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+static_assert((CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS &
+               (CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS - 1)) == 0,
+              "CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS must be a power of two");
+
 static sock_udp_t *_udp_socks = NULL;
+/* dynamic ports of the socks bound to the unspecified address */
+static BITFIELD(_dyn_ports, CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS);
+
+/**
+ * @brief   Checks if the port of a sock blocks it for dynamic allocation
+ */
+static bool _blocks_dyn_port(const sock_udp_t *sock)
+{
+    const uint8_t *const p = (uint8_t *)&sock->local.addr;
+
+    if ((unsigned)(sock->local.port - GNRC_SOCK_DYN_PORTRANGE_MIN) >=
+        GNRC_SOCK_DYN_PORTRANGE_NUM) {
+        return false;
+    }
+    for (unsigned i = 0; i < sizeof(sock->local.addr); i++) {
+        if (p[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static unsigned _dyn_port_bit(uint16_t port)
+{
+    return (port - GNRC_SOCK_DYN_PORTRANGE_MIN) &
+           (CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS - 1);
+}
+
+static void _sock_add(sock_udp_t *sock)
+{
+    /* prepend to current socks */
+    sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
+    _udp_socks = sock;
+    if (_blocks_dyn_port(sock)) {
+        bf_set(_dyn_ports, _dyn_port_bit(sock->local.port));
+    }
+}
+
+static void _sock_del(sock_udp_t *sock)
+{
+    if (_udp_socks != NULL) {
+        gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
+        LL_DELETE(head, (gnrc_sock_reg_t *)sock);
+        _udp_socks = (sock_udp_t *)head;
+    }
+    if (_blocks_dyn_port(sock)) {
+        unsigned bit = _dyn_port_bit(sock->local.port);
+
+        /* other socks may share the bit */
+        bf_unset(_dyn_ports, bit);
+        for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
+             ptr = (sock_udp_t *)ptr->reg.next) {
+            if (_blocks_dyn_port(ptr) &&
+                (_dyn_port_bit(ptr->local.port) == bit)) {
+                bf_set(_dyn_ports, bit);
+                break;
+            }
+        }
+    }
+}
+#else
+static void _sock_add(sock_udp_t *sock)
+{
+    (void)sock;
+}
 #endif
 
 /**
@@ -51,19 +121,16 @@ static sock_udp_t *_udp_socks = NULL;
 static bool _dyn_port_used(uint16_t port)
 {
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+    if (!bf_isset(_dyn_ports, _dyn_port_bit(port))) {
+        return false;
+    }
+    if (CONFIG_GNRC_SOCK_UDP_DYN_PORT_BITS >= GNRC_SOCK_DYN_PORTRANGE_NUM) {
+        /* bitmap is exact */
+        return true;
+    }
     for (sock_udp_t *ptr = _udp_socks; ptr != NULL;
          ptr = (sock_udp_t *)ptr->reg.next) {
-        bool spec_addr = false;
-        for (unsigned i = 0; i < sizeof(ptr->local.addr); i++) {
-            const uint8_t *const p = (uint8_t *)&ptr->local.addr;
-            if (p[i] != 0) {
-                spec_addr = true;
-            }
-        }
-        if (spec_addr) {
-            continue;
-        }
-        if (ptr->local.port == port) {
+        if (_blocks_dyn_port(ptr) && (ptr->local.port == port)) {
             /* port already in use by another sock */
             return true;
         }
@@ -127,12 +194,10 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
                 }
             }
         }
-        /* prepend to current socks */
-        sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-        _udp_socks = sock;
 #endif
         memcpy(&sock->local, local, sizeof(sock_udp_ep_t));
         sock->local.port = port;
+        _sock_add(sock);
     }
     if (remote != NULL) {
         if (gnrc_af_not_supported(remote->family)) {
@@ -166,10 +231,7 @@ void sock_udp_close(sock_udp_t *sock)
     sock_event_close(sock_udp_get_async_ctx(sock));
 #endif
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-    if (_udp_socks != NULL) {
-        gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
-        LL_DELETE(head, (gnrc_sock_reg_t *)sock);
-    }
+    _sock_del(sock);
 #endif
 }
 
@@ -334,17 +396,13 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+/* selects the end points for sending, binds an unbound sock implicitly */
+static int _get_send_eps(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         sock_udp_aux_tx_t *aux, sock_ip_ep_t *local,
+                         sock_ip_ep_t *rem, uint16_t *src_port,
+                         uint16_t *dst_port)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
 
     assert((sock != NULL) || (remote != NULL));
 
@@ -373,8 +431,8 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -382,69 +440,66 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
-#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
-            /* prepend to current socks */
-            sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
-            _udp_socks = sock;
-#endif /* MODULE_GNRC_SOCK_CHECK_REUSE */
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
+            _sock_add(sock);
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
-        src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
+        *src_port = aux->local.port;
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
-        dst_port = sock->remote.port;
+        memcpy(rem, &sock->remote, sizeof(*rem));
+        *dst_port = sock->remote.port;
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
-        dst_port = remote->port;
+        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(*rem));
+        *dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
+    return 0;
+}
 
-    /* allocate snip for payload */
-    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
-    if (payload == NULL) {
-        return -ENOMEM;
-    }
-
-    /* copy payload data into payload snip */
-    iolist_to_buffer(snips, payload->data, payload->size);
+/* prepends the UDP header to payload and sends it, consumes payload */
+static ssize_t _send(sock_udp_t *sock, gnrc_pktsnip_t *payload,
+                     const sock_ip_ep_t *local, const sock_ip_ep_t *rem,
+                     uint16_t src_port, uint16_t dst_port)
+{
+    gnrc_pktsnip_t *pkt;
+    ssize_t res;
 
     pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    res = gnrc_sock_send(pkt, (sock_ip_ep_t *)local, (sock_ip_ep_t *)rem,
+                         PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -453,10 +508,110 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
     return res;
 }
 
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    int res;
+    gnrc_pktsnip_t *payload;
+    uint16_t src_port = 0, dst_port;
+    sock_ip_ep_t local;
+    sock_ip_ep_t rem;
+
+    res = _get_send_eps(sock, remote, aux, &local, &rem, &src_port, &dst_port);
+    if (res < 0) {
+        return res;
+    }
+
+    /* allocate snip for payload */
+    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -ENOMEM;
+    }
+
+    /* copy payload data into payload snip */
+    iolist_to_buffer(snips, payload->data, payload->size);
+
+    return _send(sock, payload, &local, &rem, src_port, dst_port);
+}
+
+#ifdef MODULE_SOCK_UDP_ZERO_COPY
+void *sock_udp_buf_alloc(size_t len, void **buf_ctx)
+{
+    gnrc_pktsnip_t *pkt;
+
+    assert(buf_ctx != NULL);
+    pkt = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    *buf_ctx = pkt;
+    return (pkt != NULL) ? pkt->data : NULL;
+}
+
+void *sock_udp_buf_claim(void **buf_ctx, size_t len)
+{
+    gnrc_pktsnip_t *pkt;
+
+    assert((buf_ctx != NULL) && (*buf_ctx != NULL));
+    pkt = *buf_ctx;
+    if (pkt->users > 1) {
+        /* datagram was delivered to other socks as well */
+        gnrc_pktsnip_t *copy = gnrc_pktbuf_add(NULL, NULL, len,
+                                               GNRC_NETTYPE_UNDEF);
+
+        if (copy == NULL) {
+            return NULL;
+        }
+        memcpy(copy->data, pkt->data, (pkt->size < len) ? pkt->size : len);
+        gnrc_pktbuf_release(pkt);
+        *buf_ctx = copy;
+        return copy->data;
+    }
+    if (gnrc_pktbuf_realloc_data(pkt, len) != 0) {
+        return NULL;
+    }
+    /* the headers of the received datagram are not needed anymore, new ones
+     * are prepended as separate snips when sending */
+    gnrc_pktbuf_release(pkt->next);
+    pkt->next = NULL;
+    pkt->type = GNRC_NETTYPE_UNDEF;
+    return pkt->data;
+}
+
+ssize_t sock_udp_send_buf_aux(sock_udp_t *sock, void *buf_ctx, size_t len,
+                              const sock_udp_ep_t *remote,
+                              sock_udp_aux_tx_t *aux)
+{
+    int res;
+    gnrc_pktsnip_t *payload = buf_ctx;
+    uint16_t src_port = 0, dst_port;
+    sock_ip_ep_t local;
+    sock_ip_ep_t rem;
+
+    assert((payload != NULL) && (payload->next == NULL) &&
+           (len <= payload->size));
+    res = _get_send_eps(sock, remote, aux, &local, &rem, &src_port, &dst_port);
+    if ((res == 0) && (gnrc_pktbuf_realloc_data(payload, len) != 0)) {
+        res = -ENOMEM;
+    }
+    if (res < 0) {
+        gnrc_pktbuf_release(payload);
+        return res;
+    }
+
+    return _send(sock, payload, &local, &rem, src_port, dst_port);
+}
+
+void sock_udp_buf_free(void *buf_ctx)
+{
+    gnrc_pktbuf_release(buf_ctx);
+}
+#endif  /* MODULE_SOCK_UDP_ZERO_COPY */
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -28,6 +28,7 @@
 #include "net/af.h" /* IWYU pragma: keep */
 #include "net/tcp.h"
 #include "net/gnrc/netif.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/tcp.h"
 #include "net/sock.h"
 #include "include/gnrc_tcp_common.h"
@@ -71,6 +72,26 @@ static void _unsched_mbox(evtimer_mbox_event_t *event)
     TCP_DEBUG_LEAVE;
 }
 
+/**
+ * @brief Check if a connection teardown is in progress.
+ *
+ * @note FSM_EVENT_CALL_CLOSE moves a TCB to one of these states or to CLOSED or
+ *       LISTEN, a TCB in SYN_SENT waits for the connection timeout. Once the teardown
+ *       is over, the eventloop re-opens a listening TCB and it may receive the next
+ *       SYN before the closing thread checks the state again. So the end of the
+ *       teardown is detected by leaving these states, not by reaching CLOSED or LISTEN.
+ *
+ * @param[in] state   Connection state.
+ *
+ * @returns   true if @p state is one of the states of a connection teardown.
+ */
+static bool _closing(_gnrc_tcp_fsm_state_t state)
+{
+    return (state == FSM_STATE_SYN_SENT) || (state == FSM_STATE_FIN_WAIT_1) ||
+           (state == FSM_STATE_FIN_WAIT_2) || (state == FSM_STATE_CLOSING) ||
+           (state == FSM_STATE_TIME_WAIT) || (state == FSM_STATE_LAST_ACK);
+}
+
 static void _close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -93,12 +114,14 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     /* Setup connection timeout */
     _sched_connection_timeout(&tcb->event_misc, &mbox);
 
-    /* Start connection teardown sequence */
-    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+    /* Start connection teardown sequence, reset the connection if no FIN can be sent */
+    if (_gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0) < 0) {
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
+    }
 
-    /* Loop until the connection has been closed */
+    /* Loop until the teardown is over */
     state = _gnrc_tcp_fsm_get_state(tcb);
-    while ((state != FSM_STATE_CLOSED) && (state != FSM_STATE_LISTEN)) {
+    while (_closing(state)) {
         mbox_get(&mbox, &msg);
         switch (msg.type) {
             case MSG_TYPE_CONNECTION_TIMEOUT:
@@ -122,6 +145,72 @@ static void _close(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+#ifdef SOCK_HAS_ASYNC
+/**
+ * @brief Start the teardown of an accepted connection without waiting for it.
+ *
+ * @note The eventloop re-opens the listening TCB once the teardown completed or
+ *       the connection timeout expired.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _close_async(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
+
+    tcb->async_cb = NULL;
+    if (state == FSM_STATE_ESTABLISHED || state == FSM_STATE_CLOSE_WAIT) {
+        _gnrc_tcp_eventloop_sched(&tcb->event_timeout,
+                                  CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS,
+                                  MSG_TYPE_CONNECTION_TIMEOUT, tcb);
+        if (_gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0) < 0) {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
+/**
+ * @brief Queue as much data for transmission as the windows allow.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     data   Data to send.
+ * @param[in]     len    Number of bytes in @p data.
+ *
+ * @returns   Number of bytes queued.
+ */
+static ssize_t _send_avail(gnrc_tcp_tcb_t *tcb, const void *data, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    ssize_t ret = 0;
+
+    while ((size_t)ret < len) {
+        int sent = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL,
+                                 (uint8_t *)data + ret, len - ret);
+        if (sent <= 0) {
+            break;
+        }
+        ret += sent;
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+/**
+ * @brief Check if gnrc_tcp_send() may return without waiting for the peer.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ * @param[in] ret   Number of bytes queued so far.
+ *
+ * @returns   true if data was queued and the retransmit queue can take more data.
+ */
+static bool _send_done(const gnrc_tcp_tcb_t *tcb, ssize_t ret)
+{
+    return (ret > 0) && (tcb->pkt_retransmit_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE);
+}
+
 static void _abort(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -331,6 +420,12 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
     mutex_init(&queue->lock);
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
+#ifdef SOCK_HAS_ASYNC
+    queue->async_cb = NULL;
+#endif
+#ifdef SOCK_HAS_ASYNC_CTX
+    memset(&queue->async_ctx, 0, sizeof(queue->async_ctx));
+#endif
     TCP_DEBUG_LEAVE;
 }
 
@@ -524,6 +619,9 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
 #endif
             tcb->local_port = local->port;
             tcb->status |= STATUS_LISTENING;
+#ifdef SOCK_HAS_ASYNC
+            tcb->queue = queue;
+#endif
 
             /* Open connection */
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
@@ -710,6 +808,16 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         return 0;
     }
 
+    /* Queue data right away, only set up timeouts if the peer must be waited for */
+    if (tcb->snd_wnd > 0) {
+        ret = _send_avail(tcb, data, len);
+        if (_send_done(tcb, ret)) {
+            mutex_unlock(&(tcb->function_lock));
+            TCP_DEBUG_LEAVE;
+            return ret;
+        }
+    }
+
     /* Setup messaging */
     _gnrc_tcp_fsm_set_mbox(tcb, &mbox);
 
@@ -721,8 +829,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent and the retransmit queue can take more data */
+    while (ret >= 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -745,9 +853,14 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send as much data as the windows allow, if we are not probing */
+        if (!probing_mode) {
+            ret += _send_avail(tcb, (uint8_t *)data + ret, len - ret);
+        }
+
+        /* Return as soon as further data could be queued for transmission */
+        if (_send_done(tcb, ret)) {
+            break;
         }
 
         /* Wait for responses */
@@ -811,13 +924,55 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     return ret;
 }
 
-ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
-                      const uint32_t timeout_duration_ms)
+ssize_t gnrc_tcp_try_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len)
 {
     TCP_DEBUG_ENTER;
     assert(tcb != NULL);
     assert(data != NULL);
 
+    ssize_t ret = 0;
+    _gnrc_tcp_fsm_state_t state = 0;
+
+    /* Lock the TCB for this function call, unless a thread waits in another call */
+    if (!mutex_trylock(&(tcb->function_lock))) {
+        TCP_DEBUG_ERROR("-EAGAIN: TCB is in use.");
+        TCP_DEBUG_LEAVE;
+        return -EAGAIN;
+    }
+
+    /* Check if connection is in a valid state */
+    state = _gnrc_tcp_fsm_get_state(tcb);
+    if (state != FSM_STATE_ESTABLISHED && state != FSM_STATE_CLOSE_WAIT) {
+        TCP_DEBUG_ERROR("-ENOTCONN: TCB is not connected.");
+        ret = -ENOTCONN;
+    }
+    else if (len) {
+        ret = _send_avail(tcb, data, len);
+        if (ret == 0) {
+            TCP_DEBUG_ERROR("-EAGAIN: Window or retransmit queue full. Try again.");
+            ret = -EAGAIN;
+        }
+    }
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+/**
+ * @brief Common implementation of gnrc_tcp_recv() and gnrc_tcp_recv_buf().
+ *
+ * @param[in,out] tcb                   TCB holding the connection information.
+ * @param[in]     event                 FSM_EVENT_CALL_RECV or FSM_EVENT_CALL_RECV_BUF.
+ * @param[out]    data                  Argument passed to the FSM along with @p event.
+ * @param[in]     max_len               Argument passed to the FSM along with @p event.
+ * @param[in]     timeout_duration_ms   Timeout for receive in milliseconds.
+ *
+ * @returns   See gnrc_tcp_recv().
+ */
+static ssize_t _recv(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event, void *data,
+                     const size_t max_len, const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
@@ -839,7 +994,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     }
 
     /* Early return for zero length buffers to store received data */
-    if (!max_len) {
+    if ((event == FSM_EVENT_CALL_RECV) && !max_len) {
         mutex_unlock(&(tcb->function_lock));
         TCP_DEBUG_LEAVE;
         return 0;
@@ -848,15 +1003,16 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     /* If FIN was received (CLOSE_WAIT), no further data can be received. */
     /* Copy received data into given buffer and return number of bytes. Can be zero. */
     if (state == FSM_STATE_CLOSE_WAIT) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         mutex_unlock(&(tcb->function_lock));
         TCP_DEBUG_LEAVE;
         return ret;
     }
 
-    /* If this call is non-blocking (timeout_duration_ms == 0): Try to read data and return */
-    if (timeout_duration_ms == 0) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+    /* Try to read data and return if there was some or if this call is non-blocking
+     * (timeout_duration_ms == 0). Only wait for data after that. */
+    ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
+    if ((ret > 0) || (timeout_duration_ms == 0)) {
         if (ret == 0) {
             TCP_DEBUG_ERROR("-EAGAIN: Not data available, try later again.");
             ret = -EAGAIN;
@@ -888,7 +1044,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
         }
 
         /* Try to read available data */
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
 
         /* If FIN was received (CLOSE_WAIT), no further data can be received. Leave event loop */
         if (state == FSM_STATE_CLOSE_WAIT) {
@@ -932,12 +1088,68 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     return ret;
 }
 
+ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
+                      const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    ssize_t ret = _recv(tcb, FSM_EVENT_CALL_RECV, data, max_len, timeout_duration_ms);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, void **buf_ctx,
+                          const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(data != NULL);
+    assert(buf_ctx != NULL);
+
+    gnrc_pktsnip_t *snip = *buf_ctx;
+    ssize_t ret;
+
+    *data = NULL;
+    /* Hand lent data back and only return data that is available already */
+    if (snip != NULL) {
+        gnrc_pktbuf_release(snip);
+        *buf_ctx = NULL;
+        ret = _recv(tcb, FSM_EVENT_CALL_RECV_BUF, &snip, 0, 0);
+        if (ret == -EAGAIN) {
+            ret = 0;
+        }
+    }
+    else {
+        ret = _recv(tcb, FSM_EVENT_CALL_RECV_BUF, &snip, 0, timeout_duration_ms);
+    }
+    if (ret > 0) {
+        *data = (uint8_t *)snip->data + snip->size - ret;
+        *buf_ctx = snip;
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+#endif
+
 void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
     assert(tcb != NULL);
 
     mutex_lock(&(tcb->function_lock));
+#ifdef SOCK_HAS_ASYNC
+    /* Event driven queues must not block on the teardown of accepted connections */
+    if ((tcb->status & STATUS_LISTENING) && (tcb->queue != NULL) &&
+        (tcb->queue->async_cb != NULL)) {
+        _close_async(tcb);
+        mutex_unlock(&(tcb->function_lock));
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+#endif
     _close(tcb);
     mutex_unlock(&(tcb->function_lock));
 
@@ -977,6 +1189,9 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
     /* Cleanup */
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
+#ifdef SOCK_HAS_ASYNC
+    queue->async_cb = NULL;
+#endif
     mutex_unlock(&(queue->lock));
     TCP_DEBUG_LEAVE;
 }
@@ -273,6 +273,25 @@ static int _receive(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+/**
+ * @brief Handle the expiry of a connection timeout scheduled on the eventloop.
+ *
+ * @param[in,out] tcb   TCB whose connection timed out.
+ */
+static void _connection_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Listening TCBs are re-opened, all others are closed for good */
+    if (tcb->status & STATUS_LISTENING) {
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+    }
+    else {
+        _gnrc_tcp_fsm(tcb, FSM_EVENT_TIMEOUT_CONNECTION, NULL, NULL, 0);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 static void *_eventloop(__attribute__((unused)) void *arg)
 {
     TCP_DEBUG_ENTER;
@@ -330,14 +349,11 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                               FSM_EVENT_TIMEOUT_TIMEWAIT, NULL, NULL, 0);
                 break;
 
-           /* A connection opening attempt from a TCB in listening mode failed.
-            * Clear retransmission and re-open for next attempt */
+           /* A connection opening attempt or an asynchronous close of a TCB in listening
+            * mode failed. Clear retransmission and re-open for next attempt */
             case MSG_TYPE_CONNECTION_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_CONNECTION_TIMEOUT.");
-                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
-                              FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
-                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
-                              FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+                _connection_timeout((gnrc_tcp_tcb_t *)msg.content.ptr);
                 break;
 
             default:
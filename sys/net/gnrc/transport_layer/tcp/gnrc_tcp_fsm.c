@@ -92,11 +92,14 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (uint8_t i = 0; i < tcb->pkt_retransmit_len; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
+        tcb->pkt_retransmit_len = 0;
     }
+    tcb->status &= ~STATUS_RTT_PENDING;
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -161,6 +164,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
                 /* Free potentially allocated receive buffer */
                 _gnrc_tcp_rcvbuf_release_buffer(tcb);
+
+                /* Stop a connection timeout left behind by a stopped listening queue */
+                _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
                 TCP_DEBUG_INFO("Connection closed");
             }
             /* Re-open connection as listenng */
@@ -176,6 +182,12 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
         case FSM_STATE_LISTEN:
             /* Clear Accepted Status */
             tcb->status &= ~(STATUS_ACCEPTED);
+#ifdef SOCK_HAS_ASYNC
+            /* The event callback and a pending connection timeout of an
+             * asynchronous close belonged to the previous connection */
+            tcb->async_cb = NULL;
+            _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
+#endif
 
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
@@ -220,9 +232,15 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 LL_PREPEND(list->head, tcb);
             }
             mutex_unlock(&list->lock);
+
+            /* Start new connection in slow start */
+            _gnrc_tcp_pkt_init_cwnd(tcb);
             break;
 
         case FSM_STATE_SYN_RCVD:
+            /* Start new connection in slow start */
+            _gnrc_tcp_pkt_init_cwnd(tcb);
+
             /* Setup timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_sched(&tcb->event_timeout,
@@ -317,20 +335,33 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    uint32_t wnd = (tcb->cwnd < tcb->snd_wnd) ? tcb->cwnd : tcb->snd_wnd;
+    uint32_t flight = tcb->snd_nxt - tcb->snd_una;
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
+    /* Check if window is open and the retransmit queue can take another packet,
+     * without using the slot reserved for the FIN */
+    if (flight < wnd && tcb->pkt_retransmit_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
+        size_t smss = (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+        size_t payload = wnd - flight;
+        payload = (payload < smss) ? payload : smss;
+
+        /* Avoid small segments while data is in flight (Silly Window Syndrome) */
+        if (payload < len && payload < smss && flight > 0) {
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
         payload = (payload < len) ? payload : len;
 
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt, buf, payload) < 0) {
+            /* Packet buffer is full: Retry when in-flight data was acknowledged */
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
         TCP_DEBUG_LEAVE;
@@ -340,6 +371,26 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     return 0;
 }
 
+/**
+ * @brief Announce the receive window if enough receive buffer space became free.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _announce_rcv_wnd(gnrc_tcp_tcb_t *tcb)
+{
+    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
+    if (_gnrc_tcp_rcvbuf_get_free(tcb) >= CONFIG_GNRC_TCP_MSS) {
+        tcb->rcv_wnd = _gnrc_tcp_rcvbuf_get_free(tcb);
+
+        /* Send ACK to announce window update */
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                            tcb->rcv_nxt, NULL, 0);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+    }
+}
+
 /**
  * @brief FSM handling function for receiving data.
  *
@@ -353,28 +404,37 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
 
-    if (ringbuffer_empty(&tcb->rcv_buf)) {
-        TCP_DEBUG_LEAVE;
-        return 0;
-    }
-
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    size_t rcvd = _gnrc_tcp_rcvbuf_read(tcb, buf, len);
 
-    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    if (rcvd > 0) {
+        _announce_rcv_wnd(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
 
-        /* Send ACK to announce window update */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+/**
+ * @brief FSM handling function for receiving data without copying it.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[out]    snip   Unread payload snip handed over to the caller.
+ *
+ * @returns   Number of unread bytes at the end of @p snip.
+ */
+static int _fsm_call_recv_buf(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **snip)
+{
+    TCP_DEBUG_ENTER;
+    size_t rcvd = _gnrc_tcp_rcvbuf_lend(tcb, snip);
+
+    if (rcvd > 0) {
+        _announce_rcv_wnd(tcb);
     }
     TCP_DEBUG_LEAVE;
     return rcvd;
 }
+#endif
 
 /**
  * @brief FSM handling function for starting connection teardown sequence.
@@ -382,6 +442,7 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
  * @param[in,out] tcb   TCB holding the connection information.
  *
  * @returns   Zero on success.
+ *            -ENOMEM if the FIN could not be queued.
  */
 static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
 {
@@ -390,12 +451,19 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
     if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED ||
         tcb->state == FSM_STATE_CLOSE_WAIT) {
 
-        /* Send FIN packet */
+        /* Send FIN packet, the retransmit queue always has room for it */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
+                                tcb->rcv_nxt, NULL, 0) < 0 ||
+            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false) < 0) {
+            TCP_DEBUG_ERROR("-ENOMEM: Can't queue FIN.");
+            if (out_pkt != NULL) {
+                gnrc_pktbuf_release(out_pkt);
+            }
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
+        }
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
 
@@ -715,6 +783,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
                 }
+                /* Duplicate ACK: Count towards fast retransmit (see RFC 5681) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && !(ctl & MSK_FIN) &&
+                         seg_wnd == tcb->snd_wnd) {
+                    _gnrc_tcp_pkt_dup_ack(tcb);
+                }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
@@ -736,27 +809,29 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     }
                 }
                 /* Additional processing */
-                /* Check additionally if previously sent FIN was acknowledged */
+                /* Check additionally if previously sent FIN was acknowledged.
+                 * The FIN is the last segment sent, so it is acknowledged with
+                 * everything else */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_una == tcb->snd_nxt) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_una == tcb->snd_nxt) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_una == tcb->snd_nxt) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -772,18 +847,12 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
-
                 /* Accept only data that is expected, to be received */
                 if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                    /* Store payload in receive buffer, headers are invalid afterwards */
+                    tcb->rcv_nxt += _gnrc_tcp_rcvbuf_add(tcb, in_pkt);
                     /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                    tcb->rcv_wnd = _gnrc_tcp_rcvbuf_get_free(tcb);
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
@@ -813,7 +882,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->snd_una == tcb->snd_nxt) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +926,9 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_len > 0) {
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -949,6 +1018,11 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_CALL_RECV :
             ret = _fsm_call_recv(tcb, buf, len);
             break;
+        case FSM_EVENT_CALL_RECV_BUF :
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+            ret = _fsm_call_recv_buf(tcb, buf);
+#endif
+            break;
         case FSM_EVENT_CALL_CLOSE :
             ret = _fsm_call_close(tcb);
             break;
@@ -978,6 +1052,109 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
     return ret;
 }
 
+#ifdef SOCK_HAS_ASYNC
+/**
+ * @brief Connection state right before an FSM call, to derive asynchronous events from.
+ */
+typedef struct {
+    gnrc_tcp_tcb_cb_t cb;     /**< Event callback of the connection */
+    void *cb_arg;             /**< Event callback argument */
+    uint32_t snd_una;         /**< Send unacknowledged */
+    uint16_t snd_wnd;         /**< Send window */
+    size_t rcv_free;          /**< Free receive buffer space */
+    uint8_t state;            /**< Connection state */
+} _async_snapshot_t;
+
+/**
+ * @brief Derive the asynchronous events caused by an FSM call.
+ *
+ * @pre The FSM lock of @p tcb is held.
+ *
+ * @param[in] tcb      TCB holding the connection information.
+ * @param[in] event    Event the FSM processed.
+ * @param[in] result   Return value of the FSM.
+ * @param[in] before   Connection state right before the FSM call.
+ * @param[out] queue   Queue to report a new connection to, or NULL.
+ *
+ * @returns   Events to report to the callback of the connection.
+ */
+static sock_async_flags_t _async_events(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
+                                        int32_t result, const _async_snapshot_t *before,
+                                        gnrc_tcp_tcb_queue_t **queue)
+{
+    sock_async_flags_t flags = 0;
+    bool state_changed = (tcb->state != before->state);
+
+    *queue = NULL;
+    switch (event) {
+        case FSM_EVENT_CALL_RECV:
+        case FSM_EVENT_CALL_RECV_BUF:
+            /* Report data that was left in the receive buffer */
+            if ((result > 0) && (_gnrc_tcp_rcvbuf_get_free(tcb) < GNRC_TCP_RCV_BUF_SIZE)) {
+                flags |= SOCK_ASYNC_MSG_RECV;
+            }
+            break;
+
+        case FSM_EVENT_RCVD_PKT:
+        case FSM_EVENT_TIMEOUT_TIMEWAIT:
+        case FSM_EVENT_TIMEOUT_RETRANSMIT:
+        case FSM_EVENT_TIMEOUT_CONNECTION:
+            /* A listening TCB became established: announce it on its queue */
+            if (state_changed && (tcb->status & STATUS_LISTENING) &&
+                !(tcb->status & STATUS_ACCEPTED) &&
+                (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT)) {
+                *queue = tcb->queue;
+                break;
+            }
+            if (_gnrc_tcp_rcvbuf_get_free(tcb) < before->rcv_free) {
+                flags |= SOCK_ASYNC_MSG_RECV;
+            }
+            /* Acknowledged data or a re-opened window make room to send more */
+            if (((tcb->snd_una != before->snd_una) ||
+                 ((before->snd_wnd == 0) && (tcb->snd_wnd > 0))) &&
+                (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT)) {
+                flags |= SOCK_ASYNC_MSG_SENT;
+            }
+            if (state_changed &&
+                (tcb->state == FSM_STATE_CLOSE_WAIT || tcb->state == FSM_STATE_CLOSED ||
+                 tcb->state == FSM_STATE_LISTEN)) {
+                flags |= SOCK_ASYNC_CONN_FIN;
+            }
+            break;
+
+        default:
+            /* Anything else was requested by the user itself */
+            break;
+    }
+    return flags;
+}
+
+/**
+ * @brief Report events caused by an FSM call to the asynchronous event callbacks.
+ *
+ * @note Packets and timeouts are processed by the TCP eventloop thread, so the
+ *       callbacks run on it. They must not call blocking functions of the API,
+ *       as the eventloop can't process the packets they would wait for.
+ *
+ * @param[in] tcb      TCB holding the connection information.
+ * @param[in] flags    Events to report to the callback of the connection.
+ * @param[in] queue    Queue to report a new connection to, or NULL.
+ * @param[in] before   Connection state right before the FSM call.
+ */
+static void _async_notify(gnrc_tcp_tcb_t *tcb, sock_async_flags_t flags,
+                          gnrc_tcp_tcb_queue_t *queue, const _async_snapshot_t *before)
+{
+    TCP_DEBUG_ENTER;
+    if ((queue != NULL) && (queue->async_cb != NULL)) {
+        queue->async_cb(queue, SOCK_ASYNC_CONN_RECV, queue->async_cb_arg);
+    }
+    if (flags && (before->cb != NULL)) {
+        before->cb(tcb, flags, before->cb_arg);
+    }
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
                   gnrc_pktsnip_t *in_pkt, void *buf, size_t len)
 {
@@ -985,6 +1162,18 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
     /* Lock FSM */
     mutex_lock(&(tcb->fsm_lock));
 
+#ifdef SOCK_HAS_ASYNC
+    /* The callback is taken here, a connection returning to LISTEN clears it */
+    _async_snapshot_t before = {
+        .cb = tcb->async_cb,
+        .cb_arg = tcb->async_cb_arg,
+        .snd_una = tcb->snd_una,
+        .snd_wnd = tcb->snd_wnd,
+        .rcv_free = _gnrc_tcp_rcvbuf_get_free(tcb),
+        .state = tcb->state,
+    };
+#endif
+
     /* Call FSM */
     tcb->status &= ~STATUS_NOTIFY_USER;
     int32_t result = _fsm_unprotected(tcb, event, in_pkt, buf, len);
@@ -996,8 +1185,17 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         msg.content.ptr = tcb;
         mbox_try_put(tcb->mbox, &msg);
     }
+#ifdef SOCK_HAS_ASYNC
+    gnrc_tcp_tcb_queue_t *queue;
+    sock_async_flags_t flags = _async_events(tcb, event, result, &before, &queue);
+#endif
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
+
+#ifdef SOCK_HAS_ASYNC
+    /* Callbacks run without the FSM lock, so they may call non-blocking functions of the API */
+    _async_notify(tcb, flags, queue, &before);
+#endif
     TCP_DEBUG_LEAVE;
     return result;
 }
@@ -20,6 +20,7 @@
 #include <utlist.h>
 #include <errno.h>
 #include "byteorder.h"
+#include "container.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "net/inet_csum.h"
@@ -49,6 +50,59 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the segment size used for congestion control.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Smaller value of the peers and our own MSS.
+ */
+static inline uint32_t _smss(const gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->mss == 0 || tcb->mss > CONFIG_GNRC_TCP_MSS) {
+        return CONFIG_GNRC_TCP_MSS;
+    }
+    return tcb->mss;
+}
+
+/**
+ * @brief Calculates the RTO for the oldest segment in the retransmit queue
+ *        from the current round trip time estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If there is no measurement yet: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief Performs boundary checks on the current RTO and (re-)starts the
+ *        retransmission timer for the oldest segment in the retransmit queue.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -287,12 +341,20 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+
+        /* Time this segment unless the round trip time is measured already */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = tcb->snd_nxt;
+        }
     }
     else {
         tcb->retries += 1;
+
+        /* Measurements are ambiguous after a retransmission (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_PENDING;
     }
 
     /* Pass packet down the network stack */
@@ -383,6 +445,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     gnrc_pktsnip_t *snp = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
+    uint8_t pos = 0;
 
     /* No packet received */
     if (pkt == NULL) {
@@ -391,8 +454,13 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
+    /* Search pkt in retransmit queue */
+    while (pos < tcb->pkt_retransmit_len && tcb->pkt_retransmit[pos] != pkt) {
+        pos++;
+    }
+
     /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    if (pos == ARRAY_SIZE(tcb->pkt_retransmit)) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -415,20 +483,22 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Enqueue pkt and increase users: every send attempt consumes a user */
+    if (pos == tcb->pkt_retransmit_len) {
+        tcb->pkt_retransmit[tcb->pkt_retransmit_len++] = pkt;
+    }
     gnrc_pktbuf_hold(pkt, 1);
 
+    /* The timer covers the oldest segment, it is already running for later ones */
+    if (pos > 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
     /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+        tcb->retries = 0;
+        _calc_rto(tcb);
     }
     else {
         /* If this is a retransmission: Double the rto (Timer Backoff) */
@@ -440,19 +510,14 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
-    }
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+        /* A timeout signals congestion: Restart with slow start (see RFC 5681) */
+        tcb->ssthresh = _max((tcb->snd_nxt - tcb->snd_una) / 2, 2 * _smss(tcb));
+        tcb->cwnd = _smss(tcb);
+        tcb->dup_acks = 0;
     }
 
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    _sched_retransmit(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -461,40 +526,58 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
     uint32_t seg = 0;
+    uint8_t acked = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
-    }
+    /* Release all segments the cumulative ACK covers entirely */
+    while (acked < tcb->pkt_retransmit_len) {
+        snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[acked], GNRC_NETTYPE_TCP);
+        if (snp == NULL) {
+            TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
 
-    hdr = (tcp_hdr_t *) snp->data;
+        hdr = (tcp_hdr_t *) snp->data;
+        seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+            tcb->pkt_retransmit[acked]) - 1;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(tcb->pkt_retransmit[acked]);
+        acked++;
+    }
+
+    /* Nothing acknowledged entirely: the timer keeps running */
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    /* Stop timer and remove acknowledged segments from retransmit queue */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    tcb->pkt_retransmit_len -= acked;
+    memmove(tcb->pkt_retransmit, &tcb->pkt_retransmit[acked],
+            tcb->pkt_retransmit_len * sizeof(tcb->pkt_retransmit[0]));
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_PENDING;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -509,6 +592,72 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Grow congestion window or deflate it after fast recovery (see RFC 5681) */
+    if (tcb->dup_acks >= DUP_ACK_THRESHOLD) {
+        tcb->cwnd = tcb->ssthresh;
+    }
+    else if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += _smss(tcb);
+    }
+    else {
+        tcb->cwnd += _max((_smss(tcb) * _smss(tcb)) / tcb->cwnd, 1);
+    }
+    tcb->dup_acks = 0;
+
+    /* Restart timer for the oldest segment still in flight */
+    if (tcb->pkt_retransmit_len > 0) {
+        _calc_rto(tcb);
+        _sched_retransmit(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int _gnrc_tcp_pkt_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+
+    /* Nothing in flight: the ACK is no duplicate */
+    if (tcb->pkt_retransmit_len == 0) {
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks++;
+    }
+
+    /* Fast retransmit: the oldest segment is assumed lost */
+    if (tcb->dup_acks == DUP_ACK_THRESHOLD) {
+        tcb->ssthresh = _max((tcb->snd_nxt - tcb->snd_una) / 2, 2 * _smss(tcb));
+        tcb->cwnd = tcb->ssthresh + DUP_ACK_THRESHOLD * _smss(tcb);
+
+        /* Every send attempt consumes a user */
+        gnrc_pktbuf_hold(tcb->pkt_retransmit[0], 1);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
+    }
+    /* Fast recovery: each further duplicate signals a segment that left the network */
+    else if (tcb->dup_acks > DUP_ACK_THRESHOLD) {
+        tcb->cwnd += _smss(tcb);
+        tcb->status |= STATUS_NOTIFY_USER;
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int _gnrc_tcp_pkt_init_cwnd(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _smss(tcb);
+
+    /* Initial window (see RFC 5681): min(4 * SMSS, max(2 * SMSS, 4380 bytes)) */
+    tcb->cwnd = _max(2 * smss, 4380);
+    if (tcb->cwnd > 4 * smss) {
+        tcb->cwnd = 4 * smss;
+    }
+    tcb->ssthresh = UINT16_MAX;
+    tcb->dup_acks = 0;
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -15,9 +15,12 @@
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
+#include <assert.h>
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -25,6 +28,145 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+void _gnrc_tcp_rcvbuf_init(void)
+{
+}
+
+int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Received payload is held in the packet buffer, there is nothing to allocate */
+    (void)tcb;
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktbuf_release(tcb->rcv_pkt);
+    tcb->rcv_pkt = NULL;
+    tcb->rcv_pkt_offset = 0;
+    TCP_DEBUG_LEAVE;
+}
+
+size_t _gnrc_tcp_rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb)
+{
+    return GNRC_TCP_RCV_BUF_SIZE - (gnrc_pkt_len(tcb->rcv_pkt) - tcb->rcv_pkt_offset);
+}
+
+/**
+ * @brief Copy payload that spans multiple snips into a single new snip.
+ *
+ * @param[in] pay   First payload snip.
+ * @param[in] len   Number of payload bytes to copy.
+ *
+ * @returns   The new snip.
+ *            NULL if the packet buffer is full.
+ */
+static gnrc_pktsnip_t *_copy_payload(const gnrc_pktsnip_t *pay, size_t len)
+{
+    gnrc_pktsnip_t *snip = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+
+    if (snip != NULL) {
+        uint8_t *dst = snip->data;
+
+        for (; len > 0; pay = pay->next) {
+            size_t n = (pay->size < len) ? pay->size : len;
+
+            memcpy(dst, pay->data, n);
+            dst += n;
+            len -= n;
+        }
+    }
+    return snip;
+}
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    /* The event loop marks the TCP header, so the payload is the head of pkt */
+    gnrc_pktsnip_t *pay = pkt;
+    gnrc_pktsnip_t *hdr = pkt->next;
+    size_t space = _gnrc_tcp_rcvbuf_get_free(tcb);
+    size_t len = 0;
+
+    assert(pay->type == GNRC_NETTYPE_UNDEF);
+    for (gnrc_pktsnip_t *snp = pay; snp && snp->type == GNRC_NETTYPE_UNDEF; snp = snp->next) {
+        len += snp->size;
+    }
+    len = (len < space) ? len : space;
+    if (len == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    if ((pay->users > 1) || (hdr->type == GNRC_NETTYPE_UNDEF)) {
+        /* Payload is shared or split: fall back to a copy */
+        pay = _copy_payload(pay, len);
+        if (pay == NULL) {
+            TCP_DEBUG_ERROR("Packet buffer full, dropping payload.");
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+    }
+    else {
+        /* Take the payload out of pkt. The caller only releases what is still
+         * linked to pkt, so drop its reference to the headers here */
+        pay->next = NULL;
+        gnrc_pktbuf_release(hdr);
+        if (len < pay->size) {
+            gnrc_pktbuf_realloc_data(pay, len);
+        }
+        gnrc_pktbuf_hold(pay, 1);
+    }
+    tcb->rcv_pkt = gnrc_pkt_append(tcb->rcv_pkt, pay);
+    TCP_DEBUG_LEAVE;
+    return len;
+}
+
+size_t _gnrc_tcp_rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    uint8_t *dst = buf;
+    size_t rcvd = 0;
+
+    while ((tcb->rcv_pkt != NULL) && (rcvd < len)) {
+        gnrc_pktsnip_t *snip = tcb->rcv_pkt;
+        size_t n = snip->size - tcb->rcv_pkt_offset;
+
+        n = (n < len - rcvd) ? n : len - rcvd;
+        memcpy(&dst[rcvd], (uint8_t *)snip->data + tcb->rcv_pkt_offset, n);
+        rcvd += n;
+        tcb->rcv_pkt_offset += n;
+        if (tcb->rcv_pkt_offset == snip->size) {
+            tcb->rcv_pkt = snip->next;
+            tcb->rcv_pkt_offset = 0;
+            snip->next = NULL;
+            gnrc_pktbuf_release(snip);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
+
+size_t _gnrc_tcp_rcvbuf_lend(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **snip)
+{
+    TCP_DEBUG_ENTER;
+    size_t len = 0;
+
+    *snip = tcb->rcv_pkt;
+    if (*snip != NULL) {
+        len = (*snip)->size - tcb->rcv_pkt_offset;
+        tcb->rcv_pkt = (*snip)->next;
+        tcb->rcv_pkt_offset = 0;
+        (*snip)->next = NULL;
+    }
+    TCP_DEBUG_LEAVE;
+    return len;
+}
+#else
 /**
  * @brief Receive buffer entry.
  */
@@ -124,3 +266,28 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+size_t _gnrc_tcp_rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb)
+{
+    return ringbuffer_get_free(&tcb->rcv_buf);
+}
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    TCP_DEBUG_ENTER;
+    size_t len = 0;
+
+    /* Copy contents into receive buffer */
+    for (gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+         snp && snp->type == GNRC_NETTYPE_UNDEF; snp = snp->next) {
+        len += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
+    }
+    TCP_DEBUG_LEAVE;
+    return len;
+}
+
+size_t _gnrc_tcp_rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    return ringbuffer_get(&(tcb->rcv_buf), buf, len);
+}
+#endif
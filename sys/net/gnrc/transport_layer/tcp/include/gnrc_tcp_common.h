@@ -44,6 +44,7 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_PENDING    (1 << 5) /**< Internal: Status bitmask RTT_PENDING */
 /** @} */
 
 /**
@@ -90,6 +91,11 @@ extern "C" {
  */
 #define RTO_UNINITIALIZED (-1) /**< Internal: Constant RTO uninitialized */
 
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681).
+ */
+#define DUP_ACK_THRESHOLD (3U) /**< Internal: Constant duplicate ACK threshold */
+
 /**
  * @brief Overflow tolerant comparison operators for sequence and
           acknowledgement number comparison.
@@ -122,7 +122,10 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
+ *
+ * All packets covered entirely by @p ack are removed and the congestion
+ * window is grown accordingly.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -132,6 +135,29 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Handles a duplicate acknowledgment.
+ *
+ * Retransmits the oldest packet in the retransmission queue on the
+ * DUP_ACK_THRESHOLD-th duplicate (fast retransmit) and inflates the
+ * congestion window on any further duplicate (fast recovery).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if there is nothing in flight.
+ */
+int _gnrc_tcp_pkt_dup_ack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Initializes the congestion control state of a new connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ */
+int _gnrc_tcp_pkt_init_cwnd(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
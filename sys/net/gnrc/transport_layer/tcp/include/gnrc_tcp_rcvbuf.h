@@ -14,11 +14,13 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for allocating, accessing and freeing the receive buffer.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include "kernel_defines.h"
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -47,6 +49,54 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Get number of bytes that can still be stored in the receive buffer.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Number of free bytes in the receive buffer.
+ */
+size_t _gnrc_tcp_rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Store payload of a received segment in the receive buffer.
+ *
+ * @note With module gnrc_tcp_recv_buf the payload is taken over without copying
+ *       and the headers of @p pkt are released. Only the payload of @p pkt may
+ *       be accessed afterwards, the caller still releases @p pkt.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in,out] pkt   Received segment, with the payload marked as GNRC_NETTYPE_UNDEF.
+ *
+ * @returns   Number of payload bytes stored, at most the free space of the buffer.
+ */
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Copy data out of the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[out]    buf   Buffer to copy data into.
+ * @param[in]     len   Maximum number of bytes to copy.
+ *
+ * @returns   Number of bytes copied into @p buf.
+ */
+size_t _gnrc_tcp_rcvbuf_read(gnrc_tcp_tcb_t *tcb, void *buf, size_t len);
+
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF) || defined(DOXYGEN)
+/**
+ * @brief Take the oldest unread payload snip out of the receive buffer.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[out]    snip   The unread payload snip, the caller must release it. Unread
+ *                       data starts at the returned number of bytes before its end.
+ *
+ * @returns   Number of unread bytes in @p snip.
+ *            Zero if the receive buffer is empty.
+ */
+size_t _gnrc_tcp_rcvbuf_lend(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **snip);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,103 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#if IS_USED(MODULE_FIB_TRIE)
+/**
+ * @brief checks if the given table uses the trie index
+ */
+static inline bool fib_uses_trie(fib_table_t *table)
+{
+    return (table->table_type == FIB_TABLE_TYPE_SH) && (table->trie.nodes != NULL);
+}
+
+/**
+ * @brief returns the number of significant bits of a destination
+ *        all-zero addresses are default routes and have no significant bits
+ */
+static unsigned fib_trie_prefix_len(uint8_t *dst, size_t dst_size, uint32_t dst_flags)
+{
+    unsigned bits = dst_size << 3;
+    bool is_all_zeros_addr = true;
+
+    for (size_t i = 0; i < dst_size; ++i) {
+        if (dst[i] != 0) {
+            is_all_zeros_addr = false;
+            break;
+        }
+    }
+
+    if (is_all_zeros_addr) {
+        return 0;
+    }
+
+    if (dst_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        unsigned prefix_len = (dst_flags & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
+        return (prefix_len < bits) ? prefix_len : bits;
+    }
+
+    return bits;
+}
+
+static void fib_trie_sweep_cb(void *arg)
+{
+    fib_table_t *table = arg;
+    table->trie.sweep_pending = true;
+}
+
+/**
+ * @brief arms the sweep timer if the given lifetime expires before the
+ *        currently scheduled sweep
+ */
+static void fib_trie_schedule_sweep(fib_table_t *table, uint64_t lifetime)
+{
+    if ((lifetime == FIB_LIFETIME_NO_EXPIRE) || (lifetime >= table->trie.next_expiry)) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+
+    table->trie.next_expiry = lifetime;
+    table->trie.sweep_timer.callback = fib_trie_sweep_cb;
+    table->trie.sweep_timer.arg = table;
+    /* entries expire once their lifetime is strictly in the past */
+    xtimer_set64(&table->trie.sweep_timer, (lifetime >= now) ? (lifetime - now + 1) : 0);
+}
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief removes all expired entries if the sweep timer fired since the
+ *        last call and re-arms the timer for the next expiring entry
+ */
+static void fib_trie_sweep(fib_table_t *table)
+{
+    if (!table->trie.sweep_pending) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+    uint64_t next = FIB_LIFETIME_NO_EXPIRE;
+
+    table->trie.sweep_pending = false;
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        if ((entry->lifetime == 0) || (entry->lifetime == FIB_LIFETIME_NO_EXPIRE)) {
+            continue;
+        }
+        if (entry->lifetime < now) {
+            fib_remove(table, entry);
+        }
+        else if (entry->lifetime < next) {
+            next = entry->lifetime;
+        }
+    }
+
+    table->trie.next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    fib_trie_schedule_sweep(table, next);
+}
+#endif
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -84,6 +181,22 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
+#if IS_USED(MODULE_FIB_TRIE)
+    if (fib_uses_trie(table)) {
+        unsigned idx;
+
+        fib_trie_sweep(table);
+        int ret = fib_trie_find(&table->trie, dst, dst_size, &idx);
+        if (ret < 0) {
+            *entry_arr_size = 0;
+            return ret;
+        }
+        entry_arr[0] = &table->data.entries[idx];
+        *entry_arr_size = 1;
+        return ret;
+    }
+#endif
+
     uint64_t now = xtimer_now_usec64();
 
     size_t count = 0;
@@ -196,6 +309,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -205,7 +319,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry, uint8_t *next_hop,
                          size_t next_hop_size, uint32_t next_hop_flags,
                          uint32_t lifetime)
 {
@@ -226,6 +340,14 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
 
+#if IS_USED(MODULE_FIB_TRIE)
+    if (fib_uses_trie(table)) {
+        fib_trie_schedule_sweep(table, entry->lifetime);
+    }
+#else
+    (void)table;
+#endif
+
     return 0;
 }
 
@@ -272,6 +394,14 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+#if IS_USED(MODULE_FIB_TRIE)
+                if (fib_uses_trie(table)) {
+                    fib_trie_insert(&table->trie, i, dst, dst_size,
+                                    fib_trie_prefix_len(dst, dst_size, dst_flags));
+                    fib_trie_schedule_sweep(table, table->data.entries[i].lifetime);
+                }
+#endif
+
                 return 0;
             }
         }
@@ -283,13 +413,21 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry belongs to
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
     if (entry->global != NULL) {
+#if IS_USED(MODULE_FIB_TRIE)
+        if (fib_uses_trie(table)) {
+            fib_trie_remove(&table->trie, entry - table->data.entries);
+        }
+#else
+        (void)table;
+#endif
         universal_address_rem(entry->global);
     }
 
@@ -408,7 +546,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -438,7 +576,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -462,7 +600,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -482,7 +620,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -603,6 +741,12 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_TRIE)
+        if (fib_uses_trie(table)) {
+            xtimer_remove(&table->trie.sweep_timer);
+            fib_trie_init(&table->trie, table->size);
+        }
+#endif
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -628,6 +772,12 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#if IS_USED(MODULE_FIB_TRIE)
+        if (fib_uses_trie(table)) {
+            xtimer_remove(&table->trie.sweep_timer);
+            fib_trie_init(&table->trie, table->size);
+        }
+#endif
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
@@ -0,0 +1,309 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_fib_trie
+ * @{
+ *
+ * @file
+ * @brief       Path compressed binary trie for FIB lookups
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "macros/utils.h"
+#include "net/fib/trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline unsigned _bit(const uint8_t *key, unsigned pos)
+{
+    return (key[pos >> 3] >> (7 - (pos & 7))) & 0x1;
+}
+
+/* number of leading bits (up to max) a and b have in common */
+static unsigned _common_len(const uint8_t *a, const uint8_t *b, unsigned max)
+{
+    for (unsigned i = 0; (i << 3) < max; i++) {
+        uint8_t diff = a[i] ^ b[i];
+        if (diff) {
+            return MIN((i << 3) + 7 - bitarithm_msb(diff), max);
+        }
+    }
+    return max;
+}
+
+/* checks if a and b are equal in the bits [from, to) */
+static bool _bits_equal(const uint8_t *a, const uint8_t *b,
+                        unsigned from, unsigned to)
+{
+    for (unsigned i = from >> 3; (i << 3) < to; i++) {
+        uint8_t mask = 0xff;
+        if (i == (from >> 3)) {
+            mask &= 0xff >> (from & 7);
+        }
+        if (((i + 1) << 3) > to) {
+            mask &= 0xff << (((i + 1) << 3) - to);
+        }
+        if ((a[i] ^ b[i]) & mask) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint16_t _branch_alloc(fib_trie_t *trie)
+{
+    uint16_t b = trie->free;
+
+    /* there can never be more branching nodes than entries */
+    assert(b != FIB_TRIE_NIL);
+    trie->free = trie->nodes[b].next;
+    trie->nodes[b].next = FIB_TRIE_NIL;
+    trie->nodes[b].size = 0;
+    trie->nodes[b].in_tree = true;
+    return b;
+}
+
+static void _branch_free(fib_trie_t *trie, uint16_t b)
+{
+    trie->nodes[b].in_tree = false;
+    trie->nodes[b].next = trie->free;
+    trie->free = b;
+}
+
+/* makes parent point to new instead of old */
+static void _relink(fib_trie_t *trie, uint16_t parent, uint16_t old,
+                    uint16_t new)
+{
+    if (new != FIB_TRIE_NIL) {
+        trie->nodes[new].parent = parent;
+    }
+    if (parent == FIB_TRIE_NIL) {
+        trie->root = new;
+    }
+    else {
+        fib_trie_node_t *p = &trie->nodes[parent];
+        p->child[(p->child[0] == old) ? 0 : 1] = new;
+    }
+}
+
+/* moves the position of node src in the trie to node dst */
+static void _take_place(fib_trie_t *trie, uint16_t src, uint16_t dst)
+{
+    fib_trie_node_t *s = &trie->nodes[src];
+    fib_trie_node_t *d = &trie->nodes[dst];
+
+    d->child[0] = s->child[0];
+    d->child[1] = s->child[1];
+    d->in_tree = true;
+    for (unsigned i = 0; i < 2; i++) {
+        if (d->child[i] != FIB_TRIE_NIL) {
+            trie->nodes[d->child[i]].parent = dst;
+        }
+    }
+    _relink(trie, s->parent, src, dst);
+    s->in_tree = false;
+}
+
+void fib_trie_init(fib_trie_t *trie, size_t size)
+{
+    assert(size < FIB_TRIE_NIL / 2);
+
+    trie->size = size;
+    trie->root = FIB_TRIE_NIL;
+    trie->free = FIB_TRIE_NIL;
+    trie->sweep_pending = false;
+    trie->next_expiry = UINT64_MAX;
+    for (unsigned i = FIB_TRIE_NODES_NUMOF(size); i > 0; i--) {
+        fib_trie_node_t *node = &trie->nodes[i - 1];
+
+        node->in_tree = false;
+        node->size = 0;
+        if ((i - 1) >= size) {
+            node->next = trie->free;
+            trie->free = i - 1;
+        }
+    }
+}
+
+void fib_trie_insert(fib_trie_t *trie, unsigned idx, const uint8_t *addr,
+                     size_t addr_size, unsigned prefix_len)
+{
+    fib_trie_node_t *n = &trie->nodes[idx];
+    uint16_t parent = FIB_TRIE_NIL;
+    uint16_t *link = &trie->root;
+
+    assert((idx < trie->size) && !n->in_tree);
+    assert((addr_size <= UNIVERSAL_ADDRESS_SIZE) &&
+           (prefix_len <= (addr_size << 3)));
+
+    memset(n->key, 0, sizeof(n->key));
+    memcpy(n->key, addr, addr_size);
+    n->size = addr_size;
+    n->len = prefix_len;
+    n->child[0] = FIB_TRIE_NIL;
+    n->child[1] = FIB_TRIE_NIL;
+    n->next = FIB_TRIE_NIL;
+
+    while (*link != FIB_TRIE_NIL) {
+        uint16_t c = *link;
+        fib_trie_node_t *cn = &trie->nodes[c];
+        unsigned common = _common_len(cn->key, n->key, MIN(cn->len, n->len));
+
+        if ((common == cn->len) && (common == n->len)) {
+            if (c >= trie->size) {
+                /* entry takes the place of a branching node */
+                _take_place(trie, c, idx);
+                _branch_free(trie, c);
+            }
+            else {
+                /* another entry with the same prefix: chain it */
+                n->parent = c;
+                n->next = cn->next;
+                cn->next = idx;
+            }
+            return;
+        }
+        if (common == cn->len) {
+            parent = c;
+            link = &cn->child[_bit(n->key, cn->len)];
+            continue;
+        }
+        n->in_tree = true;
+        n->parent = parent;
+        if (common == n->len) {
+            /* entry becomes parent of the current node */
+            n->child[_bit(cn->key, n->len)] = c;
+            cn->parent = idx;
+            *link = idx;
+        }
+        else {
+            /* the prefixes diverge, split with a new branching node */
+            uint16_t b = _branch_alloc(trie);
+            fib_trie_node_t *bn = &trie->nodes[b];
+
+            memcpy(bn->key, n->key, sizeof(bn->key));
+            bn->len = common;
+            bn->parent = parent;
+            bn->child[_bit(n->key, common)] = idx;
+            bn->child[_bit(cn->key, common)] = c;
+            n->parent = b;
+            cn->parent = b;
+            *link = b;
+        }
+        return;
+    }
+    n->in_tree = true;
+    n->parent = parent;
+    *link = idx;
+}
+
+void fib_trie_remove(fib_trie_t *trie, unsigned idx)
+{
+    fib_trie_node_t *n = &trie->nodes[idx];
+
+    assert(idx < trie->size);
+
+    if (!n->in_tree) {
+        /* node is chained to the entry node holding its prefix */
+        uint16_t prev = n->parent;
+        while (trie->nodes[prev].next != idx) {
+            prev = trie->nodes[prev].next;
+        }
+        trie->nodes[prev].next = n->next;
+        return;
+    }
+
+    if (n->next != FIB_TRIE_NIL) {
+        /* the next entry with the same prefix takes over */
+        uint16_t d = n->next;
+        _take_place(trie, idx, d);
+        for (uint16_t i = trie->nodes[d].next; i != FIB_TRIE_NIL;
+             i = trie->nodes[i].next) {
+            trie->nodes[i].parent = d;
+        }
+        return;
+    }
+
+    if ((n->child[0] != FIB_TRIE_NIL) && (n->child[1] != FIB_TRIE_NIL)) {
+        /* still needed for branching */
+        uint16_t b = _branch_alloc(trie);
+        memcpy(trie->nodes[b].key, n->key, sizeof(n->key));
+        trie->nodes[b].len = n->len;
+        _take_place(trie, idx, b);
+        return;
+    }
+
+    uint16_t child = (n->child[0] != FIB_TRIE_NIL) ? n->child[0] : n->child[1];
+    uint16_t parent = n->parent;
+
+    _relink(trie, parent, idx, child);
+    n->in_tree = false;
+
+    if ((child == FIB_TRIE_NIL) && (parent != FIB_TRIE_NIL) &&
+        (parent >= trie->size)) {
+        /* branching node has only one child left */
+        fib_trie_node_t *pn = &trie->nodes[parent];
+        uint16_t other = (pn->child[0] != FIB_TRIE_NIL) ? pn->child[0]
+                                                         : pn->child[1];
+        _relink(trie, pn->parent, parent, other);
+        _branch_free(trie, parent);
+    }
+}
+
+int fib_trie_find(const fib_trie_t *trie, const uint8_t *dst, size_t dst_size,
+                  unsigned *idx)
+{
+    unsigned bits = dst_size << 3;
+    unsigned checked = 0;
+    uint16_t best = FIB_TRIE_NIL;
+    uint16_t c = trie->root;
+
+    while (c != FIB_TRIE_NIL) {
+        const fib_trie_node_t *cn = &trie->nodes[c];
+
+        if ((cn->len > bits) || !_bits_equal(cn->key, dst, checked, cn->len)) {
+            break;
+        }
+        checked = cn->len;
+
+        if (c < trie->size) {
+            bool found = false;
+            for (uint16_t e = c; e != FIB_TRIE_NIL; e = trie->nodes[e].next) {
+                const fib_trie_node_t *en = &trie->nodes[e];
+                if (en->size != dst_size) {
+                    continue;
+                }
+                if (memcmp(en->key, dst, dst_size) == 0) {
+                    *idx = e;
+                    return 1;
+                }
+                if (!found) {
+                    best = e;
+                    found = true;
+                }
+            }
+        }
+
+        if (cn->len == bits) {
+            break;
+        }
+        c = cn->child[_bit(dst, cn->len)];
+    }
+
+    if (best == FIB_TRIE_NIL) {
+        return -EHOSTUNREACH;
+    }
+    DEBUG("fib_trie_find: prefix match on entry %u\n", (unsigned)best);
+    *idx = best;
+    return 0;
+}
@@ -22,8 +22,12 @@
 
 #include "board.h"
 #include "irq.h"
+#include "kernel_defines.h"
 #include "periph/pm.h"
 #include "pm_layered.h"
+#if IS_USED(MODULE_PM_LAYERED_TICKLESS)
+#include "pm_layered/tickless.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -68,9 +72,17 @@ void pm_set_lowest(void)
         mode--;
     }
 
+#if IS_USED(MODULE_PM_LAYERED_TICKLESS)
+    /* don't sleep deeper than the next timer allows */
+    mode = pm_layered_tickless_mode(mode);
+    if (mode != PM_NUM_MODES) {
+        pm_layered_tickless_set(mode);
+    }
+#else
     if (mode != PM_NUM_MODES) {
         pm_set(mode);
     }
+#endif
     irq_restore(state);
 }
 
@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_pm_layered_tickless
+ * @{
+ *
+ * @file
+ * @brief       Tickless idle implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "irq.h"
+#include "pm_layered/tickless.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#ifndef PM_EXIT_LATENCY_US
+#  error "pm_layered_tickless: PM_EXIT_LATENCY_US is not defined for this CPU"
+#endif
+
+#if IS_USED(MODULE_ZTIMER_USEC)
+#define STATS_CLOCK             ZTIMER_USEC
+#define STATS_US_PER_TICK       (1U)
+#elif IS_USED(MODULE_ZTIMER_MSEC)
+#define STATS_CLOCK             ZTIMER_MSEC
+#define STATS_US_PER_TICK       (1000U)
+#endif
+
+static const uint32_t _exit_latency_us[PM_NUM_MODES] = PM_EXIT_LATENCY_US;
+
+static pm_layered_tickless_clock_t *_clocks;
+static pm_layered_tickless_stats_t _stats;
+
+void pm_layered_tickless_add_clock(pm_layered_tickless_clock_t *entry)
+{
+    unsigned state = irq_disable();
+
+    entry->next = _clocks;
+    _clocks = entry;
+    irq_restore(state);
+}
+
+static void _earliest(ztimer_clock_t *clock, uint32_t us_per_tick,
+                      uint64_t *us)
+{
+    uint32_t ticks;
+
+    if (ztimer_next_timeout(clock, &ticks)) {
+        uint64_t clock_us = (uint64_t)ticks * us_per_tick;
+
+        if (clock_us < *us) {
+            *us = clock_us;
+        }
+    }
+}
+
+bool pm_layered_tickless_next(uint32_t *us)
+{
+    uint64_t next = UINT64_MAX;
+    unsigned state = irq_disable();
+
+#if IS_USED(MODULE_ZTIMER_USEC)
+    _earliest(ZTIMER_USEC, 1, &next);
+#endif
+#if IS_USED(MODULE_ZTIMER_MSEC)
+    _earliest(ZTIMER_MSEC, 1000, &next);
+#endif
+#if IS_USED(MODULE_ZTIMER_SEC)
+    _earliest(ZTIMER_SEC, 1000000, &next);
+#endif
+    for (pm_layered_tickless_clock_t *c = _clocks; c; c = c->next) {
+        _earliest(c->clock, c->us_per_tick, &next);
+    }
+    irq_restore(state);
+
+    if (next == UINT64_MAX) {
+        return false;
+    }
+    *us = (next < UINT32_MAX) ? next : UINT32_MAX;
+    return true;
+}
+
+unsigned pm_layered_tickless_mode(unsigned mode)
+{
+    uint32_t us;
+
+    if ((mode >= PM_NUM_MODES) || !pm_layered_tickless_next(&us)) {
+        return mode;
+    }
+
+    unsigned res = mode;
+
+    while ((res < PM_NUM_MODES) && (_exit_latency_us[res] > us)) {
+        res++;
+    }
+    if (res != mode) {
+        DEBUG("pm_layered_tickless: next timer in %" PRIu32 " us, mode %u "
+              "instead of %u\n", us, res, mode);
+        _stats.demotions++;
+    }
+    return res;
+}
+
+void pm_layered_tickless_set(unsigned mode)
+{
+#ifdef STATS_CLOCK
+#if IS_USED(MODULE_ZTIMER_ONDEMAND)
+    /* don't start the clock just for the statistics */
+    bool measure = (STATS_CLOCK->users > 0);
+#else
+    const bool measure = true;
+#endif
+    uint32_t start = measure ? ztimer_now(STATS_CLOCK) : 0;
+#endif
+
+    pm_set(mode);
+
+    _stats.entries[mode]++;
+#ifdef STATS_CLOCK
+    if (measure) {
+        _stats.residency_us[mode] += (uint64_t)(ztimer_now(STATS_CLOCK) - start)
+                                     * STATS_US_PER_TICK;
+    }
+#endif
+}
+
+void pm_layered_tickless_get_stats(pm_layered_tickless_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = _stats;
+    irq_restore(state);
+}
+
+void pm_layered_tickless_reset_stats(void)
+{
+    unsigned state = irq_disable();
+
+    memset(&_stats, 0, sizeof(_stats));
+    irq_restore(state);
+}
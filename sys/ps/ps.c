@@ -35,6 +35,63 @@
 #include "tlsf-malloc.h"
 #endif
 
+#ifdef MODULE_SCHEDSTATISTICS
+/* runtime in the unit used to compute the percentages */
+static uint64_t _runtime(const schedstat_t *stat)
+{
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    return stat->runtime_cycles;
+#else
+    return stat->runtime_us;
+#endif
+}
+#endif
+
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+static void _print_hist(const char *name, int id, const uint32_t *hist)
+{
+    printf("\t%5s %3i |", name, id);
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_HIST_NUMOF; i++) {
+        printf(" %8" PRIu32, hist[i]);
+    }
+    puts("");
+}
+
+static void _print_isrs(uint64_t rt_sum)
+{
+    puts("\n\t irq | count      | runtime  | runtime_usec | max_usec");
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_ISR_NUMOF; i++) {
+        const schedstat_isr_t *stat = &sched_isrlist[i];
+
+        if (stat->irq == SCHEDSTAT_IRQ_NONE) {
+            break;
+        }
+
+        uint64_t runtime = stat->runtime_cycles * 100;
+
+        printf("\t%4i | %10u | %2u.%03u%% | %12" PRIu32 " | %8" PRIu32 "\n",
+               stat->irq, stat->count, (unsigned)(runtime / rt_sum),
+               (unsigned)(((runtime % rt_sum) * 1000) / rt_sum),
+               (uint32_t)schedstat_cycles_to_us(stat->runtime_cycles),
+               (uint32_t)schedstat_cycles_to_us(stat->max_cycles));
+    }
+
+    printf("\n\tRun lengths (bucket 0: < 1 us, bucket n: < 4^n us, "
+           "bucket %u: longer):\n", CONFIG_SCHEDSTATISTICS_HIST_NUMOF - 1);
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (thread_get(i) != NULL) {
+            _print_hist("pid", i, sched_pidlist[i].hist);
+        }
+    }
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_ISR_NUMOF; i++) {
+        if (sched_isrlist[i].irq == SCHEDSTAT_IRQ_NONE) {
+            break;
+        }
+        _print_hist("irq", sched_isrlist[i].irq, sched_isrlist[i].hist);
+    }
+}
+#endif
+
 /**
  * @brief Prints a list of running threads including stack usage to stdout.
  */
@@ -54,6 +111,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+           "| max_usec "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -78,15 +138,20 @@ void ps(void)
 #ifdef MODULE_SCHEDSTATISTICS
     uint64_t rt_sum = 0;
     if (!IS_ACTIVE(MODULE_CORE_IDLE_THREAD)) {
-        rt_sum = sched_pidlist[KERNEL_PID_UNDEF].runtime_us;
+        rt_sum = _runtime(&sched_pidlist[KERNEL_PID_UNDEF]);
     }
     for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
         thread_t *p = thread_get(i);
         if (p != NULL) {
-            rt_sum += sched_pidlist[i].runtime_us;
+            rt_sum += _runtime(&sched_pidlist[i]);
         }
     }
 #endif /* MODULE_SCHEDSTATISTICS */
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_ISR_NUMOF; i++) {
+        rt_sum += sched_isrlist[i].runtime_cycles;
+    }
+#endif
 
     for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
         thread_t *p = thread_get(i);
@@ -104,8 +169,8 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
             /* multiply with 100 for percentage and to avoid floats/doubles */
-            uint64_t runtime_us = sched_pidlist[i].runtime_us * 100;
-            uint32_t ztimer_us = {sched_pidlist[i].runtime_us};
+            uint64_t runtime_us = _runtime(&sched_pidlist[i]) * 100;
+            uint32_t ztimer_us = schedstat_runtime_us(&sched_pidlist[i]);
             unsigned runtime_major = runtime_us / rt_sum;
             unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
@@ -120,6 +185,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+                   " | %8"PRIu32" "
 #endif
                    "\n",
                    thread_getpid_of(p),
@@ -133,11 +201,18 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, ztimer_us
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+                   , (uint32_t)schedstat_cycles_to_us(sched_pidlist[i].max_cycles)
 #endif
                   );
         }
     }
 
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    _print_isrs(rt_sum);
+#endif
+
 #ifdef DEVELHELP
     printf("\t%5s %-21s|%13s%6s %6i (%5i) (%5i)\n", "|", "SUM", "|", "|",
            overall_stacksz, overall_used, overall_stacksz - overall_used);
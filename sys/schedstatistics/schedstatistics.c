@@ -24,7 +24,21 @@
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
+
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+#include "bitarithm.h"
+#include "irq.h"
+#include "time_units.h"
+#ifdef CPU_NATIVE
+#include <time.h>
+#else
+#include "clk.h"
+#include "cpu.h"
+#include "ztimer.h"
+#endif
+#else
 #include "ztimer.h"
+#endif
 
 /**
  * When core_idle_thread is not active, the KERNEL_PID_UNDEF is used to track
@@ -32,6 +46,180 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+#ifndef SCHEDSTAT_ISR_NESTING_MAX
+#define SCHEDSTAT_ISR_NESTING_MAX   (8U)
+#endif
+
+/* initialized statically, as interrupts are served before init_schedstatistics() */
+schedstat_isr_t sched_isrlist[CONFIG_SCHEDSTATISTICS_ISR_NUMOF] = {
+    [0 ... CONFIG_SCHEDSTATISTICS_ISR_NUMOF - 1] = { .irq = SCHEDSTAT_IRQ_NONE },
+};
+
+/* cycles spent in (outermost) ISRs since the last context switch */
+static uint64_t _isr_cycles;
+static unsigned _isr_depth;
+static uint64_t _isr_start[SCHEDSTAT_ISR_NESTING_MAX];
+static uint64_t _isr_nested[SCHEDSTAT_ISR_NESTING_MAX];
+
+#if defined(CPU_NATIVE)
+/* nanoseconds are used as cycles */
+static inline uint64_t _cycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+static inline void _cycles_init(void)
+{
+}
+
+uint64_t schedstat_cycles_to_us(uint64_t cycles)
+{
+    return cycles / NS_PER_US;
+}
+#elif defined(DWT_CTRL_CYCCNTENA_Msk)
+static uint32_t _cyccnt_last;
+static uint64_t _cyccnt_high;
+static ztimer_t _wrap_timer;
+static uint32_t _wrap_period_ms;
+
+/* must be called with interrupts disabled */
+static inline uint64_t _cycles(void)
+{
+    uint32_t now = DWT->CYCCNT;
+
+    if (now < _cyccnt_last) {
+        _cyccnt_high += 1ULL << 32;
+    }
+    _cyccnt_last = now;
+    return _cyccnt_high | now;
+}
+
+/* A wrap is only noticed if the counter is read at least once per wrap, and
+ * threads may run or the CPU may sleep for longer than that. The counter has
+ * no overflow interrupt, so it is read every half wrap period. */
+static void _wrap_cb(void *arg)
+{
+    (void)arg;
+    unsigned state = irq_disable();
+    _cycles();
+    irq_restore(state);
+    ztimer_set(ZTIMER_MSEC, &_wrap_timer, _wrap_period_ms);
+}
+
+static inline void _cycles_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    _wrap_period_ms = (1ULL << 31) / (coreclk() / MS_PER_SEC);
+    _wrap_timer.callback = _wrap_cb;
+    ztimer_set(ZTIMER_MSEC, &_wrap_timer, _wrap_period_ms);
+}
+
+uint64_t schedstat_cycles_to_us(uint64_t cycles)
+{
+    return cycles / (coreclk() / US_PER_SEC);
+}
+#else
+#error "schedstatistics_cycles: no cycle counter available for this CPU"
+#endif
+
+static void _account(uint64_t *runtime, uint32_t *max, uint32_t *hist,
+                     uint64_t cycles)
+{
+    uint64_t us = schedstat_cycles_to_us(cycles);
+    unsigned bucket = CONFIG_SCHEDSTATISTICS_HIST_NUMOF - 1;
+
+    if (us <= UINT32_MAX) {
+        bucket = us ? (bitarithm_msb(us) >> 1) + 1 : 0;
+    }
+    *runtime += cycles;
+    if (cycles > *max) {
+        *max = (cycles < UINT32_MAX) ? cycles : UINT32_MAX;
+    }
+    if (bucket >= CONFIG_SCHEDSTATISTICS_HIST_NUMOF) {
+        bucket = CONFIG_SCHEDSTATISTICS_HIST_NUMOF - 1;
+    }
+    hist[bucket]++;
+}
+
+static void _account_isr(int irq, uint64_t cycles)
+{
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_ISR_NUMOF; i++) {
+        schedstat_isr_t *stat = &sched_isrlist[i];
+
+        if (stat->irq == SCHEDSTAT_IRQ_NONE) {
+            stat->irq = irq;
+        }
+        if (stat->irq == irq) {
+            stat->count++;
+            _account(&stat->runtime_cycles, &stat->max_cycles, stat->hist,
+                     cycles);
+            return;
+        }
+    }
+}
+
+void schedstat_isr_enter(void)
+{
+    unsigned state = irq_disable();
+
+    if (_isr_depth < SCHEDSTAT_ISR_NESTING_MAX) {
+        _isr_start[_isr_depth] = _cycles();
+        _isr_nested[_isr_depth] = 0;
+    }
+    _isr_depth++;
+    irq_restore(state);
+}
+
+void schedstat_isr_exit(int irq)
+{
+    unsigned state = irq_disable();
+    unsigned depth = --_isr_depth;
+
+    if (depth < SCHEDSTAT_ISR_NESTING_MAX) {
+        uint64_t cycles = _cycles() - _isr_start[depth];
+
+        _account_isr(irq, cycles - _isr_nested[depth]);
+        /* the time of nested ISRs is not accounted to the interrupted ISR,
+         * the time of all ISRs is not accounted to the interrupted thread */
+        if (depth) {
+            _isr_nested[depth - 1] += cycles;
+        }
+        else {
+            _isr_cycles += cycles;
+        }
+    }
+    irq_restore(state);
+}
+
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
+{
+    uint64_t now = _cycles();
+
+    /* Update active thread stats */
+    if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
+        schedstat_t *active_stat = &sched_pidlist[active_thread];
+        uint64_t cycles = now - active_stat->laststart - _isr_cycles;
+
+        _account(&active_stat->runtime_cycles, &active_stat->max_cycles,
+                 active_stat->hist, cycles);
+    }
+    _isr_cycles = 0;
+
+    /* Update next_thread stats */
+    if (!IS_USED(MODULE_CORE_IDLE_THREAD) || next_thread != KERNEL_PID_UNDEF) {
+        schedstat_t *next_stat = &sched_pidlist[next_thread];
+        next_stat->laststart = now;
+        next_stat->schedules++;
+    }
+}
+#else
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = ztimer_now(ZTIMER_USEC);
@@ -49,13 +237,21 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         next_stat->schedules++;
     }
 }
+#endif
 
 void init_schedstatistics(void)
 {
     /* Init laststart for the thread starting schedstatistics since the callback
        wasn't registered when it was first scheduled */
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
+#ifdef MODULE_SCHEDSTATISTICS_CYCLES
+    unsigned state = irq_disable();
+    _cycles_init();
+    active_stat->laststart = _cycles();
+    irq_restore(state);
+#else
     active_stat->laststart = ztimer_now(ZTIMER_USEC);
+#endif
     active_stat->schedules = 1;
     sched_register_cb(sched_statistics_cb);
 }
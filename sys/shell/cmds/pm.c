@@ -20,6 +20,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -29,8 +30,10 @@
 
 #ifdef MODULE_PM_LAYERED
 #include "pm_layered.h"
-
 #endif /* MODULE_PM_LAYERED */
+#ifdef MODULE_PM_LAYERED_TICKLESS
+#include "pm_layered/tickless.h"
+#endif /* MODULE_PM_LAYERED_TICKLESS */
 
 static void _print_usage(void) {
     puts("Usage:");
@@ -40,6 +43,9 @@ static void _print_usage(void) {
     puts("\tpm block <mode>: manually block power mode");
     puts("\tpm unblock <mode>: manually unblock power mode");
 #endif /* MODULE_PM_LAYERED */
+#ifdef MODULE_PM_LAYERED_TICKLESS
+    puts("\tpm stats [reset]: display or reset the tickless idle statistics");
+#endif /* MODULE_PM_LAYERED_TICKLESS */
     puts("\tpm off: call pm_off()");
 }
 
@@ -140,6 +146,21 @@ static int cmd_show(char *arg)
 }
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_LAYERED_TICKLESS
+static int cmd_stats(void)
+{
+    pm_layered_tickless_stats_t stats;
+
+    pm_layered_tickless_get_stats(&stats);
+    for (unsigned i = 0; i < PM_NUM_MODES; i++) {
+        printf("mode %u entries: %" PRIu32 " residency: %" PRIu64 " us\n", i,
+               stats.entries[i], stats.residency_us[i]);
+    }
+    printf("Demoted by next timer: %" PRIu32 "\n", stats.demotions);
+    return 0;
+}
+#endif /* MODULE_PM_LAYERED_TICKLESS */
+
 static int cmd_off(char *arg)
 {
     (void)arg;
@@ -191,6 +212,21 @@ static int _pm_handler(int argc, char **argv)
     }
 #endif /* MODULE_PM_LAYERED */
 
+#ifdef MODULE_PM_LAYERED_TICKLESS
+    if (!strcmp(argv[1], "stats")) {
+        if ((argc == 3) && !strcmp(argv[2], "reset")) {
+            pm_layered_tickless_reset_stats();
+            return 0;
+        }
+        if (argc != 2) {
+            puts("usage: pm stats [reset]");
+            return 1;
+        }
+
+        return cmd_stats();
+    }
+#endif /* MODULE_PM_LAYERED_TICKLESS */
+
     if (!strcmp(argv[1], "off")) {
         return cmd_off(NULL);
     }
@@ -32,6 +32,9 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 #include "log.h"
 
 #define ENABLE_DEBUG 0
@@ -112,8 +115,40 @@ bool ztimer_release(ztimer_clock_t *clock)
 }
 #endif /* MODULE_ZTIMER_ONDEMAND */
 
+/* gets the time of the next timer relative to the last update of the clock */
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_next(clock, offset);
+    }
+#endif
+    if (!clock->list.next) {
+        return false;
+    }
+    *offset = clock->list.next->offset;
+    return true;
+}
+
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+static bool _is_empty(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_is_empty(clock->wheel);
+    }
+#endif
+    return !clock->list.next;
+}
+#endif
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_is_set(clock, &t->base);
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -156,6 +191,26 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
+bool ztimer_next_timeout(ztimer_clock_t *clock, uint32_t *ticks)
+{
+    unsigned state = irq_disable();
+    uint32_t offset;
+
+    if (!_next_offset(clock, &offset)) {
+        irq_restore(state);
+        return false;
+    }
+
+    /* the offset of the first timer is relative to the list offset, which
+     * is the time of the last update of the list */
+    uint32_t elapsed = ztimer_now(clock) - clock->list.offset;
+
+    *ticks = (offset > elapsed) ? (offset - elapsed) : 0;
+
+    irq_restore(state);
+    return true;
+}
+
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 {
     unsigned state = irq_disable();
@@ -221,12 +276,19 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
     /* First timer on the clock's linked list */
-    if (list->next == NULL &&
+    if (_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_block(clock->block_pm_mode);
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_wheel_add(clock, entry);
+        return;
+    }
+#endif
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -289,6 +351,13 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_wheel_advance(clock, now);
+        return now;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     DEBUG(
@@ -335,6 +404,13 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_wheel_del(clock, entry);
+        was_removed = true;
+    }
+    else
+#endif
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -360,7 +436,7 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
     /* The last timer just got removed from the clock's linked list */
-    if (clock->list.next == NULL &&
+    if (_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_unblock(clock->block_pm_mode);
     }
@@ -371,6 +447,19 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_base_t *entry = ztimer_wheel_pop(clock);
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+        if (entry && ztimer_wheel_is_empty(clock->wheel) &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#endif
+        return (ztimer_t *)entry;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -397,12 +486,13 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    uint32_t offset;
+    bool is_set = _next_offset(clock, &offset);
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (is_set) {
+            clock->ops->set(clock, _min_u32(offset, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -412,8 +502,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (is_set) {
+            clock->ops->set(clock, offset);
         }
         else {
             clock->ops->cancel(clock);
@@ -435,9 +525,10 @@ void ztimer_handler(ztimer_clock_t *clock)
     if (clock->max_value < UINT32_MAX) {
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
+        uint32_t offset;
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_next_offset(clock, &offset)) {
+            uint32_t target = clock->list.offset + offset;
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -461,29 +552,37 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        /* the target times are absolute, so there is no offset adding up
+         * when updating to the current time */
+        _ztimer_update_head_offset(clock);
+    }
+    else
+#endif
     if (clock->list.next) {
         clock->list.offset += clock->list.next->offset;
         clock->list.next->offset = 0;
+    }
 
-        ztimer_t *entry = _now_next(clock);
-        while (entry) {
-            DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
-                  (void *)entry, (void *)entry->base.next, clock->ops->now(
-                      clock));
-            entry->callback(entry->arg);
+    ztimer_t *entry = _now_next(clock);
+    while (entry) {
+        DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
+              (void *)entry, (void *)entry->base.next, clock->ops->now(
+                  clock));
+        entry->callback(entry->arg);
 #if MODULE_ZTIMER_ONDEMAND
-            no_clock_user_left = ztimer_release(clock);
-            if (no_clock_user_left) {
-                break;
-            }
+        no_clock_user_left = ztimer_release(clock);
+        if (no_clock_user_left) {
+            break;
+        }
 #endif
+        entry = _now_next(clock);
+        if (!entry) {
+            /* See if any more alarms expired during callback processing */
+            /* This reduces the number of implicit calls to clock->ops->now() */
+            _ztimer_update_head_offset(clock);
             entry = _now_next(clock);
-            if (!entry) {
-                /* See if any more alarms expired during callback processing */
-                /* This reduces the number of implicit calls to clock->ops->now() */
-                _ztimer_update_head_offset(clock);
-                entry = _now_next(clock);
-            }
         }
     }
 
@@ -506,6 +605,14 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        printf("wheel at %" PRIu32 ", due %p\n", clock->list.offset,
+               (void *)clock->wheel->due);
+        return;
+    }
+#endif
+
     do {
         printf("0x%08" PRIxPTR ":%" PRIu32 "(%" PRIu32 ")%s", (uintptr_t)entry,
                entry->offset, entry->offset +
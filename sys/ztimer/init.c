@@ -51,6 +51,7 @@
 #include "ztimer/periph_rtt.h"
 #include "ztimer/periph_rtc.h"
 #include "ztimer/config.h"
+#include "ztimer/wheel.h"
 
 /* both 'stdio_rtt' and 'stdio_semihosting' rely on ztimer for stdio output,
    so not output is possible before 'ztimer' has been initiated, silence all
@@ -381,6 +382,12 @@ void ztimer_init(void)
     }
     LOG_DEBUG("ztimer_init(): ZTIMER_USEC without conversion\n");
 #  endif
+#  if MODULE_ZTIMER_WHEEL
+    /* before any timer is set on it, e.g. by ZTIMER_MSEC */
+    static ztimer_wheel_t _wheel_usec;
+    LOG_DEBUG("ztimer_init(): ZTIMER_USEC using timer wheel\n");
+    ztimer_wheel_init(ZTIMER_USEC, &_wheel_usec);
+#  endif
 
     /* warm-up time if set and needed */
     if (IS_USED(MODULE_ZTIMER_AUTO_ADJUST) &&
@@ -433,6 +440,11 @@ void ztimer_init(void)
     ztimer_convert_frac_init(&_ztimer_convert_frac_msec, ZTIMER_MSEC_BASE,
                              FREQ_1KHZ, ZTIMER_MSEC_CONVERT_LOWER_FREQ);
 #  endif
+#  if MODULE_ZTIMER_WHEEL
+    static ztimer_wheel_t _wheel_msec;
+    LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using timer wheel\n");
+    ztimer_wheel_init(ZTIMER_MSEC, &_wheel_msec);
+#  endif
 #  ifdef CONFIG_ZTIMER_MSEC_ADJUST
     LOG_DEBUG("ztimer_init(): ZTIMER_MSEC setting adjust value to %i\n",
               CONFIG_ZTIMER_MSEC_ADJUST);
@@ -447,5 +459,10 @@ void ztimer_init(void)
     ztimer_convert_frac_init(&_ztimer_convert_frac_sec, ZTIMER_SEC_BASE,
                              FREQ_1HZ, ZTIMER_SEC_CONVERT_LOWER_FREQ);
 #  endif
+#  if MODULE_ZTIMER_WHEEL
+    static ztimer_wheel_t _wheel_sec;
+    LOG_DEBUG("ztimer_init(): ZTIMER_SEC using timer wheel\n");
+    ztimer_wheel_init(ZTIMER_SEC, &_wheel_sec);
+#  endif
 #endif
 }
@@ -160,6 +160,12 @@ void ztimer_mock_init(ztimer_mock_t *self, unsigned width)
         .super = { .ops = &ztimer_mock_ops, .max_value = max_value },
     };
 
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+    /* there is no hardware behind the mock that could stop in a low power
+     * mode */
+    self->super.block_pm_mode = ZTIMER_CLOCK_NO_REQUIRED_PM_MODE;
+#endif
+
 #if !MODULE_ZTIMER_ONDEMAND
     /* turn the timer on by default if ondemand feature is not used */
     self->running = 1;
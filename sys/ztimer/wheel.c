@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer timer wheel implementation
+ *
+ * The target time of a timer is stored as absolute time in its offset. The
+ * timers of each slot are kept in a doubly linked list (using a pointer to
+ * the previous next pointer), so they can be removed without knowing their
+ * slot. As timers don't need to be initialized before they are set, a check
+ * value is stored with the pointer to tell set timers from garbage without
+ * dereferencing it. New timers are pushed to the front of a slot, a slot is
+ * reversed when it is processed to keep the order in which the timers were
+ * set.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "container.h"
+#include "irq.h"
+#include "ztimer/wheel.h"
+
+#define BITS        CONFIG_ZTIMER_WHEEL_BITS
+#define LEVELS      CONFIG_ZTIMER_WHEEL_LEVELS
+#define SLOTS       ZTIMER_WHEEL_SLOTS
+#define SLOT_MASK   (SLOTS - 1)
+#define USED_MASK   (UINT_MAX >> (sizeof(unsigned) * CHAR_BIT - SLOTS))
+
+static_assert(SLOTS <= sizeof(unsigned) * CHAR_BIT,
+              "CONFIG_ZTIMER_WHEEL_BITS too large for the bitmap of used slots");
+static_assert(BITS * LEVELS <= 32,
+              "timer wheel covers more than 32 bit");
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel)
+{
+    unsigned state = irq_disable();
+
+    assert(!clock->list.next && (!clock->wheel ||
+                                 ztimer_wheel_is_empty(clock->wheel)));
+
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->due_tail = &wheel->due;
+    clock->wheel = wheel;
+
+    irq_restore(state);
+}
+
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel)
+{
+    if (wheel->due) {
+        return false;
+    }
+    for (unsigned level = 0; level < LEVELS; level++) {
+        if (wheel->used[level]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _set_pprev(ztimer_base_t *entry, ztimer_base_t **pprev)
+{
+    entry->pprev = pprev;
+    entry->check = (uintptr_t)pprev ^ (uintptr_t)entry;
+}
+
+/* true if pprev points to the head of a slot of the wheel */
+static bool _is_slot(const ztimer_wheel_t *wheel, ztimer_base_t *const *pprev)
+{
+    ztimer_base_t *const *first = &wheel->slots[0][0];
+
+    return (pprev >= first) && (pprev < first + LEVELS * SLOTS);
+}
+
+static bool _is_linked(const ztimer_base_t *entry)
+{
+    return entry->pprev &&
+           (entry->check == ((uintptr_t)entry->pprev ^ (uintptr_t)entry));
+}
+
+bool ztimer_wheel_is_set(const ztimer_clock_t *clock, const ztimer_base_t *entry)
+{
+    const ztimer_wheel_t *wheel = clock->wheel;
+
+    /* walk back to the head of the list the timer is in, a timer set on
+     * another clock ends at a head that is not part of this wheel */
+    while (_is_linked(entry)) {
+        if (_is_slot(wheel, entry->pprev) || (entry->pprev == &wheel->due)) {
+            return true;
+        }
+        entry = container_of(entry->pprev, ztimer_base_t, next);
+    }
+    return false;
+}
+
+static void _append_due(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    entry->next = NULL;
+    _set_pprev(entry, wheel->due_tail);
+    *wheel->due_tail = entry;
+    wheel->due_tail = &entry->next;
+}
+
+/* lowest level whose slots reach delta ticks into the future */
+static unsigned _level(uint32_t delta)
+{
+    unsigned level = 0;
+
+    while ((level < LEVELS - 1) && (delta >> ((level + 1) * BITS))) {
+        level++;
+    }
+    return level;
+}
+
+static void _insert(ztimer_wheel_t *wheel, ztimer_base_t *entry, uint32_t now)
+{
+    uint32_t delta = entry->offset - now;
+
+    if (delta == 0) {
+        _append_due(wheel, entry);
+        return;
+    }
+
+    unsigned level = _level(delta);
+    unsigned slot = (entry->offset >> (level * BITS)) & SLOT_MASK;
+    ztimer_base_t **head = &wheel->slots[level][slot];
+
+    entry->next = *head;
+    if (entry->next) {
+        _set_pprev(entry->next, &entry->next);
+    }
+    _set_pprev(entry, head);
+    *head = entry;
+    wheel->used[level] |= 1U << slot;
+}
+
+/* moves the timers of a slot to the lower levels, or the expired ones */
+static void _cascade(ztimer_wheel_t *wheel, unsigned level, unsigned slot,
+                     uint32_t now)
+{
+    ztimer_base_t *entry = wheel->slots[level][slot];
+    ztimer_base_t *reversed = NULL;
+
+    if (!entry) {
+        return;
+    }
+    wheel->slots[level][slot] = NULL;
+    wheel->used[level] &= ~(1U << slot);
+
+    while (entry) {
+        ztimer_base_t *next = entry->next;
+        entry->next = reversed;
+        reversed = entry;
+        entry = next;
+    }
+    while (reversed) {
+        ztimer_base_t *next = reversed->next;
+        _insert(wheel, reversed, now);
+        reversed = next;
+    }
+}
+
+/* time until the next used slot has to be processed */
+static bool _next(const ztimer_wheel_t *wheel, uint32_t now, uint32_t *offset)
+{
+    bool found = false;
+
+    for (unsigned level = 0; level < LEVELS; level++) {
+        unsigned used = wheel->used[level];
+
+        if (!used) {
+            continue;
+        }
+
+        /* the current slot of a level has been processed already, so search
+         * starting with the slot after it */
+        unsigned shift = level * BITS;
+        unsigned start = ((now >> shift) + 1) & SLOT_MASK;
+        if (start) {
+            used = ((used >> start) | (used << (SLOTS - start))) & USED_MASK;
+        }
+
+        uint32_t slot_time = ((now >> shift) + bitarithm_lsb(used) + 1) << shift;
+        uint32_t slot_offset = slot_time - now;
+
+        if (!found || (slot_offset < *offset)) {
+            *offset = slot_offset;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    entry->offset += clock->list.offset;
+    _insert(clock->wheel, entry, clock->list.offset);
+}
+
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+
+    *entry->pprev = entry->next;
+    if (entry->next) {
+        _set_pprev(entry->next, entry->pprev);
+    }
+    else if (wheel->due_tail == &entry->next) {
+        wheel->due_tail = entry->pprev;
+    }
+    else if (_is_slot(wheel, entry->pprev)) {
+        /* entry was the only timer of its slot */
+        unsigned idx = entry->pprev - &wheel->slots[0][0];
+        wheel->used[idx / SLOTS] &= ~(1U << (idx % SLOTS));
+    }
+
+    /* reset the pointers so _is_set() considers it unset */
+    entry->next = NULL;
+    entry->pprev = NULL;
+}
+
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint32_t time = clock->list.offset;
+    uint32_t left = now - time;
+    uint32_t offset;
+
+    while (_next(wheel, time, &offset) && (offset <= left)) {
+        time += offset;
+        left -= offset;
+        /* from the top, so timers cascaded to a slot due now are processed
+         * right away */
+        for (unsigned level = LEVELS; level-- > 0;) {
+            unsigned shift = level * BITS;
+
+            if (time & ((UINT32_C(1) << shift) - 1)) {
+                continue;
+            }
+            _cascade(wheel, level, (time >> shift) & SLOT_MASK, time);
+        }
+    }
+    clock->list.offset = now;
+}
+
+ztimer_base_t *ztimer_wheel_pop(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->wheel->due;
+
+    if (entry) {
+        ztimer_wheel_del(clock, entry);
+    }
+    return entry;
+}
+
+bool ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *offset)
+{
+    if (clock->wheel->due) {
+        *offset = 0;
+        return true;
+    }
+    return _next(clock->wheel, clock->list.offset, offset);
+}
@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       FIB lookup benchmark, linear scan vs. trie index
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "net/fib.h"
+#include "random.h"
+
+#ifndef BENCH_FIB_ROUTES_MAX
+#define BENCH_FIB_ROUTES_MAX    (1024U)
+#endif
+
+#ifndef BENCH_FIB_RUNS
+#define BENCH_FIB_RUNS          (10000U)
+#endif
+
+#define ADDR_SIZE               (16U)
+#define NEXT_HOPS_NUMOF         (16U)
+#define DSTS_NUMOF              (64U)
+
+static fib_entry_t _linear_entries[BENCH_FIB_ROUTES_MAX];
+static fib_table_t _linear = { .data.entries = _linear_entries,
+                               .table_type = FIB_TABLE_TYPE_SH,
+                               .size = BENCH_FIB_ROUTES_MAX };
+
+static fib_entry_t _trie_entries[BENCH_FIB_ROUTES_MAX];
+static fib_trie_node_t _trie_nodes[FIB_TRIE_NODES_NUMOF(BENCH_FIB_ROUTES_MAX)];
+static fib_table_t _trie = { .data.entries = _trie_entries,
+                             .table_type = FIB_TABLE_TYPE_SH,
+                             .size = BENCH_FIB_ROUTES_MAX,
+                             .trie.nodes = _trie_nodes };
+
+static uint8_t _routes[BENCH_FIB_ROUTES_MAX][ADDR_SIZE];
+static uint8_t _dsts[DSTS_NUMOF][ADDR_SIZE];
+
+static void _random_route(uint8_t *addr, uint32_t *flags)
+{
+    static const uint8_t lens[] = { 32, 48, 64, 128 };
+    unsigned len = lens[random_uint32_range(0, sizeof(lens))];
+
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0x20;
+    addr[1] = 0x01;
+    /* keep some structure in the address space, as real routing tables do */
+    random_bytes(&addr[2], (len >> 3) - 2);
+    addr[2] &= 0x0f;
+    *flags = (len < 128) ? ((uint32_t)len << FIB_FLAG_NET_PREFIX_SHIFT) : 0;
+}
+
+static void _add(fib_table_t *table, uint8_t *dst, uint32_t dst_flags,
+                 unsigned next_hop)
+{
+    uint8_t nh[ADDR_SIZE] = { 0xfe, 0x80 };
+
+    nh[ADDR_SIZE - 1] = next_hop;
+    fib_add_entry(table, 1, dst, ADDR_SIZE, dst_flags, nh, ADDR_SIZE, 0,
+                  (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+}
+
+static void _fill(unsigned numof)
+{
+    static const uint8_t default_route[ADDR_SIZE] = { 0 };
+
+    /* fib_deinit() also resets the shared universal address table */
+    fib_deinit(&_linear);
+    fib_deinit(&_trie);
+
+    _add(&_linear, (uint8_t *)default_route, 0, 0);
+    _add(&_trie, (uint8_t *)default_route, 0, 0);
+
+    for (unsigned i = 1; i < numof; i++) {
+        uint32_t flags;
+
+        _random_route(_routes[i], &flags);
+        _add(&_linear, _routes[i], flags, i % NEXT_HOPS_NUMOF);
+        _add(&_trie, _routes[i], flags, i % NEXT_HOPS_NUMOF);
+    }
+
+    /* destinations within the known routes, with random host bits */
+    for (unsigned i = 0; i < DSTS_NUMOF; i++) {
+        memcpy(_dsts[i], _routes[random_uint32_range(1, numof)], ADDR_SIZE);
+        random_bytes(&_dsts[i][12], 4);
+    }
+}
+
+static int _lookup(fib_table_t *table, unsigned i)
+{
+    uint8_t nh[ADDR_SIZE];
+    size_t nh_size = sizeof(nh);
+    kernel_pid_t iface_id;
+    uint32_t nh_flags;
+
+    if (fib_get_next_hop(table, &iface_id, nh, &nh_size, &nh_flags,
+                         _dsts[i % DSTS_NUMOF], ADDR_SIZE, 0) < 0) {
+        return -1;
+    }
+    return nh[ADDR_SIZE - 1];
+}
+
+static void _bench(unsigned numof)
+{
+    char name[32];
+
+    _fill(numof);
+
+    printf("Verifying %u routes: ", numof);
+    for (unsigned i = 0; i < DSTS_NUMOF; i++) {
+        if (_lookup(&_linear, i) != _lookup(&_trie, i)) {
+            printf("FAIL (destination %u)\n", i);
+            return;
+        }
+    }
+    puts("OK");
+
+    snprintf(name, sizeof(name), "linear, %u routes", numof);
+    BENCHMARK_FUNC(name, BENCH_FIB_RUNS, _lookup(&_linear, i));
+    snprintf(name, sizeof(name), "trie, %u routes", numof);
+    BENCHMARK_FUNC(name, BENCH_FIB_RUNS, _lookup(&_trie, i));
+}
+
+int main(void)
+{
+    puts("FIB lookup benchmark");
+
+    fib_init(&_linear);
+    fib_init(&_trie);
+
+    _bench(16);
+    _bench(128);
+    _bench(BENCH_FIB_ROUTES_MAX);
+
+    puts("done.");
+
+    return 0;
+}
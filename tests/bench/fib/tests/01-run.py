@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for _ in range(3):
+        child.expect(r"Verifying \d+ routes: OK\r\n")
+        child.expect(r"\s+linear, \d+ routes:\s+\d+us.*\r\n")
+        child.expect(r"\s+trie, \d+ routes:\s+\d+us.*\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the request rate of the gcoap server
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT     (1000U)
+#endif
+
+#define TEST_TIMEOUT_US (100U * US_PER_MS)
+
+/* payload lengths of the responses */
+static const unsigned _payload_len[] = { 0, 16, 64 };
+
+static unsigned _len;
+
+static ssize_t _bench_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    size_t resp_len = coap_opt_finish(pdu, _len ? COAP_OPT_FINISH_PAYLOAD
+                                                : COAP_OPT_FINISH_NONE);
+
+    if (pdu->payload_len < _len) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_INTERNAL_SERVER_ERROR);
+    }
+    memset(pdu->payload, 'x', _len);
+    return resp_len + _len;
+}
+
+static const coap_resource_t _resources[] = {
+    { "/bench", COAP_GET, _bench_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+/* NON GET request for /bench without token, the message ID is set per
+ * request */
+static uint8_t _req[] = {
+    0x50, COAP_METHOD_GET, 0x00, 0x00,
+    0xb5, 'b', 'e', 'n', 'c', 'h',
+};
+
+static uint8_t _rsp[128];
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = {
+        .family = AF_INET6,
+        .port = CONFIG_GCOAP_PORT,
+    };
+    sock_udp_t sock;
+    unsigned failed = 0;
+    uint16_t id = 0;
+
+    puts("gcoap benchmark");
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+
+    gcoap_register_listener(&_listener);
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("could not create sock");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_payload_len); i++) {
+        unsigned ok = 0;
+        uint32_t start, time_us;
+
+        _len = _payload_len[i];
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < TEST_REPEAT; n++) {
+            _req[2] = id >> 8;
+            _req[3] = id++;
+            if (sock_udp_send(&sock, _req, sizeof(_req), &remote) < 0) {
+                continue;
+            }
+            ssize_t res = sock_udp_recv(&sock, _rsp, sizeof(_rsp),
+                                        TEST_TIMEOUT_US, NULL);
+            if ((res > 0) && (_rsp[1] == COAP_CODE_CONTENT) &&
+                (memcmp(&_rsp[2], &_req[2], 2) == 0)) {
+                ok++;
+            }
+        }
+        time_us = ztimer_now(ZTIMER_USEC) - start;
+
+        if (ok != TEST_REPEAT) {
+            printf("only %u of %u requests succeeded\n", ok, TEST_REPEAT);
+            failed++;
+        }
+
+        printf("payload %2u: %u requests %7" PRIu32 " us, %6" PRIu32 " req/s\n",
+               _len, TEST_REPEAT, time_us,
+               (uint32_t)((uint64_t)TEST_REPEAT * US_PER_SEC / time_us));
+    }
+
+    sock_udp_close(&sock);
+
+    puts(failed ? "FAILED" : "done.");
+
+    return 0;
+}
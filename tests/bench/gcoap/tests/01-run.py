@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap benchmark\r\n")
+    for payload in (0, 16, 64):
+        child.expect(r"payload \s*{}: \d+ requests \s*\d+ us, \s*\d+ req/s\r\n"
+                     .format(payload))
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the request dispatch of gcoap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/gcoap.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT     (10000U)
+#endif
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+#define RES(g, r)   { "/dev" #g "/res" #r, COAP_GET | COAP_PUT, _handler, NULL }
+#define GROUP(g)    RES(g, 0), RES(g, 1), RES(g, 2), RES(g, 3), RES(g, 4), \
+                    RES(g, 5), RES(g, 6), RES(g, 7), RES(g, 8), RES(g, 9)
+
+/* 80 resources in 8 groups */
+static const coap_resource_t _resources[] = {
+    GROUP(0), GROUP(1), GROUP(2), GROUP(3),
+    GROUP(4), GROUP(5), GROUP(6), GROUP(7),
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static const struct {
+    const char *name;
+    const char *path;
+    unsigned method;
+    int expected;
+} _requests[] = {
+    { "first", "/dev0/res0", COAP_METHOD_GET, GCOAP_RESOURCE_FOUND },
+    { "last", "/dev7/res9", COAP_METHOD_GET, GCOAP_RESOURCE_FOUND },
+    { "not found", "/dev9/res0", COAP_METHOD_GET, GCOAP_RESOURCE_NO_PATH },
+    { "wrong method", "/dev7/res9", COAP_METHOD_POST, GCOAP_RESOURCE_WRONG_METHOD },
+};
+
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+int main(void)
+{
+    unsigned failed = 0;
+
+    puts("gcoap dispatch benchmark");
+
+    gcoap_register_listener(&_listener);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_requests); i++) {
+        const coap_resource_t *resource;
+        coap_pkt_t pdu;
+        uint32_t start, time_us;
+        ssize_t len;
+        int res = GCOAP_RESOURCE_ERROR;
+
+        gcoap_req_init(&pdu, _buf, sizeof(_buf), _requests[i].method,
+                       _requests[i].path);
+        len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+        if ((len < 0) || (coap_parse(&pdu, _buf, len) < 0)) {
+            printf("could not build request for %s\n", _requests[i].path);
+            failed++;
+            continue;
+        }
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < TEST_REPEAT; n++) {
+            res = _listener.request_matcher(&_listener, &resource, &pdu);
+        }
+        time_us = ztimer_now(ZTIMER_USEC) - start;
+
+        if (res != _requests[i].expected) {
+            printf("unexpected result %d for %s\n", res, _requests[i].path);
+            failed++;
+        }
+
+        printf("%-12s: %u dispatches %7" PRIu32 " us\n",
+               _requests[i].name, TEST_REPEAT, time_us);
+    }
+
+    puts(failed ? "FAILED" : "done.");
+
+    return 0;
+}
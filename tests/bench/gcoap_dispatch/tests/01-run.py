@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap dispatch benchmark\r\n")
+    for name in ("first", "last", "not found", "wrong method"):
+        child.expect(r"{}\s*: \d+ dispatches \s*\d+ us\r\n".format(name))
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for matching responses to open gcoap requests
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "net/gcoap.h"
+#include "net/gcoap/forward_proxy.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/util.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT     (10000U)
+#endif
+
+/* the requests are sent to this many servers */
+#define REMOTES_NUMOF   (16U)
+
+#define REQS_MAX        CONFIG_GCOAP_REQ_WAITING_MAX
+
+/* numbers of open requests to benchmark */
+static const unsigned _reqs_numof[] = { 8, 64, 256 };
+
+static sock_udp_ep_t _remotes[REMOTES_NUMOF];
+/* responses to the open requests */
+static coap_pkt_t _resps[REQS_MAX];
+static uint8_t _resp_bufs[REQS_MAX][sizeof(coap_udp_hdr_t) + GCOAP_TOKENLEN_MAX];
+static uint8_t _req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)memo;
+    (void)pdu;
+    (void)remote;
+}
+
+static const sock_udp_ep_t *_remote(unsigned req)
+{
+    return &_remotes[req % REMOTES_NUMOF];
+}
+
+/* sends a request and prepares a response to it */
+static int _open_request(unsigned req)
+{
+    coap_pkt_t pdu;
+
+    gcoap_req_init(&pdu, _req_buf, sizeof(_req_buf), COAP_METHOD_GET, "/bench");
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    if (gcoap_req_send(_req_buf, len, _remote(req), NULL, _resp_handler, NULL,
+                       GCOAP_SOCKET_TYPE_UDP) <= 0) {
+        return -1;
+    }
+
+    len = coap_build_udp_hdr(_resp_bufs[req], sizeof(_resp_bufs[req]), COAP_TYPE_NON,
+                             coap_get_token(&pdu), coap_get_token_len(&pdu),
+                             COAP_CODE_CONTENT, coap_get_id(&pdu));
+    coap_pkt_init(&_resps[req], _resp_bufs[req], sizeof(_resp_bufs[req]), len);
+    return 0;
+}
+
+static bool _matches(const gcoap_request_memo_t *memo, unsigned req)
+{
+    coap_udp_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+
+    return memo && sock_udp_ep_equal(&memo->remote_ep, _remote(req)) &&
+           (coap_hdr_get_token_len(hdr) == coap_get_token_len(&_resps[req])) &&
+           !memcmp(coap_hdr_get_token(hdr), coap_get_token(&_resps[req]),
+                   coap_get_token_len(&_resps[req]));
+}
+
+static unsigned _bench(unsigned numof)
+{
+    gcoap_request_memo_t *memo;
+    unsigned failed = 0;
+    uint32_t start, time_us;
+
+    for (unsigned i = 0; i < numof; i++) {
+        if (_open_request(i)) {
+            printf("could not send request %u\n", i);
+            return 1;
+        }
+    }
+    /* let the network stack process the sent requests */
+    ztimer_sleep(ZTIMER_USEC, 100 * US_PER_MS);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < TEST_REPEAT; n++) {
+        unsigned req = n % numof;
+
+        gcoap_forward_proxy_find_req_memo(&memo, &_resps[req], _remote(req));
+        if (!memo || !_matches(memo, req)) {
+            failed++;
+        }
+    }
+    time_us = ztimer_now(ZTIMER_USEC) - start;
+    printf("%3u open requests: %u matches %7" PRIu32 " us\n",
+           numof, TEST_REPEAT, time_us);
+
+    /* a response with an unknown token from a known server */
+    static uint8_t unknown_buf[sizeof(coap_udp_hdr_t) + GCOAP_TOKENLEN_MAX];
+    static const uint8_t unknown_token[GCOAP_TOKENLEN_MAX] = { 0 };
+    coap_pkt_t unknown;
+    ssize_t len = coap_build_udp_hdr(unknown_buf, sizeof(unknown_buf), COAP_TYPE_NON,
+                                     unknown_token, sizeof(unknown_token),
+                                     COAP_CODE_CONTENT, 0);
+    coap_pkt_init(&unknown, unknown_buf, sizeof(unknown_buf), len);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < TEST_REPEAT; n++) {
+        gcoap_forward_proxy_find_req_memo(&memo, &unknown, _remote(n));
+        if (memo) {
+            failed++;
+        }
+    }
+    time_us = ztimer_now(ZTIMER_USEC) - start;
+    printf("%3u open requests: %u misses  %7" PRIu32 " us\n",
+           numof, TEST_REPEAT, time_us);
+
+    for (unsigned i = 0; i < numof; i++) {
+        if (gcoap_obs_req_forget(_remote(i), coap_get_token(&_resps[i]),
+                                 coap_get_token_len(&_resps[i]))) {
+            failed++;
+        }
+    }
+
+    return failed;
+}
+
+int main(void)
+{
+    unsigned failed = 0;
+
+    puts("gcoap request memo benchmark");
+
+    for (unsigned i = 0; i < REMOTES_NUMOF; i++) {
+        _remotes[i] = (sock_udp_ep_t){
+            .family = AF_INET6,
+            .port = 10000 + i,
+        };
+        ipv6_addr_set_loopback((ipv6_addr_t *)&_remotes[i].addr.ipv6);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_reqs_numof); i++) {
+        if (_reqs_numof[i] <= REQS_MAX) {
+            failed += _bench(_reqs_numof[i]);
+        }
+    }
+
+    puts(failed ? "FAILED" : "done.");
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap request memo benchmark\r\n")
+    for numof in (8, 64, 256):
+        child.expect(r"\s*{} open requests: \d+ matches \s*\d+ us\r\n".format(numof))
+        child.expect(r"\s*{} open requests: \d+ misses \s*\d+ us\r\n".format(numof))
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for sending Observe notifications to many observers
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT     (100U)
+#endif
+
+#define OBSERVERS_MAX   CONFIG_GCOAP_OBS_REGISTRATIONS_MAX
+#define OBSERVER_PORT   (20000U)
+#define PAYLOAD_LEN     (64U)
+
+/* numbers of observers to benchmark */
+static const unsigned _observers_numof[] = { 1, 8, 32 };
+
+static ssize_t _value_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+}
+
+static const coap_resource_t _resources[] = {
+    { "/value", COAP_GET, _value_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+/* Registers an observer of /value from its own port. The socket is closed
+ * afterwards, so the notifications are dropped by the stack. */
+static int _register(unsigned i)
+{
+    sock_udp_t sock;
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    uint8_t token[2] = { i >> 8, i };
+    coap_pkt_t pdu;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    local.port = OBSERVER_PORT + i;
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        return -1;
+    }
+
+    ssize_t len = coap_build_udp_hdr(_buf, sizeof(_buf), COAP_TYPE_NON, token,
+                                     sizeof(token), COAP_METHOD_GET, i);
+    coap_pkt_init(&pdu, _buf, sizeof(_buf), len);
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, COAP_OBS_REGISTER);
+    coap_opt_add_string(&pdu, COAP_OPT_URI_PATH, "/value", '/');
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    if (sock_udp_send(&sock, _buf, len, &remote) < 0) {
+        sock_udp_close(&sock);
+        return -1;
+    }
+
+    len = sock_udp_recv(&sock, _buf, sizeof(_buf), 100 * US_PER_MS, NULL);
+    sock_udp_close(&sock);
+    if ((len <= 0) || (coap_parse(&pdu, _buf, len) < 0) || !coap_has_observe(&pdu)) {
+        return -1;
+    }
+    return 0;
+}
+
+/* builds a notification with a payload, returns its length */
+static ssize_t _build_notification(void)
+{
+    coap_pkt_t pdu;
+
+    if (gcoap_obs_init(&pdu, _buf, sizeof(_buf), &_resources[0]) != GCOAP_OBS_INIT_OK) {
+        return -1;
+    }
+    coap_opt_add_format(&pdu, COAP_FORMAT_TEXT);
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    memset(pdu.payload, 'x', PAYLOAD_LEN);
+    return len + PAYLOAD_LEN;
+}
+
+static unsigned _bench(unsigned numof)
+{
+    unsigned failed = 0;
+    uint32_t start, time_us;
+
+    /* one PDU built and sent per observer, as with gcoap_obs_send() */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < TEST_REPEAT; n++) {
+        for (unsigned i = 0; i < numof; i++) {
+            ssize_t len = _build_notification();
+            if ((len < 0) || !gcoap_obs_send(_buf, len, &_resources[0])) {
+                failed++;
+            }
+        }
+    }
+    time_us = ztimer_now(ZTIMER_USEC) - start;
+    printf("%2u observers: %u per observer %7" PRIu32 " us\n",
+           numof, TEST_REPEAT, time_us);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < TEST_REPEAT; n++) {
+        ssize_t len = _build_notification();
+        if ((len < 0) || (gcoap_obs_send_all(_buf, len, &_resources[0]) != numof)) {
+            failed++;
+        }
+    }
+    time_us = ztimer_now(ZTIMER_USEC) - start;
+    printf("%2u observers: %u fan-out      %7" PRIu32 " us\n",
+           numof, TEST_REPEAT, time_us);
+
+    return failed;
+}
+
+int main(void)
+{
+    unsigned failed = 0;
+    unsigned registered = 0;
+
+    puts("gcoap Observe fan-out benchmark");
+
+    gcoap_register_listener(&_listener);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_observers_numof); i++) {
+        unsigned numof = _observers_numof[i];
+
+        if (numof > OBSERVERS_MAX) {
+            continue;
+        }
+        for (; registered < numof; registered++) {
+            if (_register(registered)) {
+                printf("could not register observer %u\n", registered);
+                puts("FAILED");
+                return 0;
+            }
+        }
+        failed += _bench(numof);
+    }
+
+    puts(failed ? "FAILED" : "done.");
+
+    return 0;
+}
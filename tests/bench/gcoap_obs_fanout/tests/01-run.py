@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("gcoap Observe fan-out benchmark\r\n")
+    for numof in (1, 8, 32):
+        child.expect(r"\s*{} observers: \d+ per observer \s*\d+ us\r\n".format(numof))
+        child.expect(r"\s*{} observers: \d+ fan-out \s*\d+ us\r\n".format(numof))
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
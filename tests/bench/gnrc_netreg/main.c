@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the demultiplexing of GNRC netreg and the
+ *              ephemeral port allocation of UDP socks
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/gnrc/netreg.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT     (10000U)
+#endif
+
+#define TEST_SOCKS_MAX  (64U)
+
+static sock_udp_t _socks[TEST_SOCKS_MAX];
+static uint16_t _ports[TEST_SOCKS_MAX];
+
+static const unsigned _numof[] = { 1, 16, TEST_SOCKS_MAX };
+
+int main(void)
+{
+    const sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    unsigned failed = 0;
+
+    puts("gnrc_netreg benchmark");
+
+    for (unsigned i = 0, created = 0; i < ARRAY_SIZE(_numof); i++) {
+        unsigned numof = _numof[i];
+        unsigned found = 0;
+        uint32_t start, create_us, lookup_us;
+
+        /* add socks up to numof */
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = created; n < numof; n++) {
+            if (sock_udp_create(&_socks[n], &local, NULL, 0) < 0) {
+                printf("could not create sock %u\n", n);
+                failed++;
+            }
+        }
+        create_us = ztimer_now(ZTIMER_USEC) - start;
+
+        for (unsigned n = created; n < numof; n++) {
+            sock_udp_ep_t ep;
+
+            sock_udp_get_local(&_socks[n], &ep);
+            _ports[n] = ep.port;
+        }
+        created = numof;
+
+        gnrc_netreg_acquire_shared();
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < TEST_REPEAT; n++) {
+            if (gnrc_netreg_lookup(GNRC_NETTYPE_UDP, _ports[n % numof])) {
+                found++;
+            }
+        }
+        lookup_us = ztimer_now(ZTIMER_USEC) - start;
+        gnrc_netreg_release_shared();
+
+        if (found != TEST_REPEAT) {
+            printf("only %u of %u lookups succeeded\n", found, TEST_REPEAT);
+            failed++;
+        }
+
+        printf("%2u socks: create %6" PRIu32 " us, %u lookups %7" PRIu32 " us\n",
+               numof, create_us, TEST_REPEAT, lookup_us);
+    }
+
+    for (unsigned n = 0; n < TEST_SOCKS_MAX; n++) {
+        sock_udp_close(&_socks[n]);
+    }
+
+    puts(failed ? "FAILED" : "done.");
+
+    return 0;
+}
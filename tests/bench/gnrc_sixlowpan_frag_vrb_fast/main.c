@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the per-hop latency of forwarding 6LoWPAN
+ *              fragments with the virtual reassembly buffer
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "container.h"
+#include "mutex.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT         (100U)
+#endif
+
+#define DATAGRAM_SIZE       (1280U)
+#define FRAG_PAYLOAD_LEN    (64U)
+#define FRAME_PAYLOAD_LEN   (sizeof(sixlowpan_frag_n_t) + FRAG_PAYLOAD_LEN)
+#define SEND_TIMEOUT_US     (100U * US_PER_MS)
+
+#define IN_NETIF            (0U)
+#define OUT_NETIF           (1U)
+#define NETIF_NUMOF         (2U)
+
+static const uint8_t _addrs[NETIF_NUMOF][IEEE802154_LONG_ADDRESS_LEN] = {
+    { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0a },
+    { 0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x0b },
+};
+static const uint8_t _prev_hop[] = {
+    0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x01
+};
+static const uint8_t _next_hop[] = {
+    0x3e, 0xe6, 0xb5, 0x0f, 0x19, 0x22, 0xfd, 0x02
+};
+
+static netdev_test_t _devs[NETIF_NUMOF];
+static gnrc_netif_t _netifs[NETIF_NUMOF];
+static char _stacks[NETIF_NUMOF][THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _frame[IEEE802154_FRAME_LEN_MAX];
+static size_t _frame_len;
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+static uint32_t _sent_usec;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_LONG_ADDRESS_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    netdev_ieee802154_t *netdev_ieee802154 = container_of(netdev,
+                                                          netdev_ieee802154_t,
+                                                          netdev);
+    netdev_test_t *dev = container_of(netdev_ieee802154, netdev_test_t,
+                                      netdev);
+
+    expect(max_len >= IEEE802154_LONG_ADDRESS_LEN);
+    memcpy(value, _addrs[(uintptr_t)dev->state],
+           IEEE802154_LONG_ADDRESS_LEN);
+    return IEEE802154_LONG_ADDRESS_LEN;
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return (int)_frame_len;
+    }
+    if ((unsigned)len < _frame_len) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, _frame_len);
+    return (int)_frame_len;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    int res = 0;
+
+    (void)dev;
+    _sent_usec = ztimer_now(ZTIMER_USEC);
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        res += iolist->iol_len;
+    }
+    mutex_unlock(&_sent);
+    return res;
+}
+
+static void _init_netif(unsigned idx)
+{
+    netdev_test_t *dev = &_devs[idx];
+
+    netdev_test_setup(dev, (void *)(uintptr_t)idx);
+    netdev_test_set_get_cb(dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_recv_cb(dev, _recv);
+    netdev_test_set_isr_cb(dev, _isr);
+    netdev_test_set_send_cb(dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netifs[idx], _stacks[idx],
+                                        sizeof(_stacks[idx]), GNRC_NETIF_PRIO,
+                                        "vrb_fast_bench",
+                                        &dev->netdev.netdev) == 0);
+}
+
+static void _build_frame(uint16_t tag, uint16_t offset, uint8_t seq)
+{
+    le_uint16_t pan = byteorder_htols(CONFIG_IEEE802154_DEFAULT_PANID);
+    size_t mhr_len = ieee802154_set_frame_hdr(
+            _frame, _prev_hop, sizeof(_prev_hop),
+            _addrs[IN_NETIF], IEEE802154_LONG_ADDRESS_LEN, pan, pan,
+            IEEE802154_FCF_TYPE_DATA, seq);
+    sixlowpan_frag_n_t *frag = (sixlowpan_frag_n_t *)&_frame[mhr_len];
+
+    expect(mhr_len > 0);
+    frag->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    frag->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+    frag->tag = byteorder_htons(tag);
+    frag->offset = offset / 8;
+    memset(frag + 1, (uint8_t)offset, FRAG_PAYLOAD_LEN);
+    _frame_len = mhr_len + FRAME_PAYLOAD_LEN;
+}
+
+int main(void)
+{
+    uint32_t min = UINT32_MAX, max = 0, sum = 0;
+    unsigned forwarded = 0;
+    uint8_t seq = 0;
+
+    puts("6LoWPAN fragment forwarding benchmark");
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        _init_netif(i);
+    }
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        gnrc_sixlowpan_frag_rb_base_t base = {
+            .src_len = sizeof(_prev_hop),
+            .dst_len = IEEE802154_LONG_ADDRESS_LEN,
+            .tag = i,
+            .datagram_size = DATAGRAM_SIZE,
+            /* as if the first fragment was already forwarded */
+            .current_size = FRAG_PAYLOAD_LEN,
+            .arrival = xtimer_now_usec(),
+        };
+
+        memcpy(base.src, _prev_hop, sizeof(_prev_hop));
+        memcpy(base.dst, _addrs[IN_NETIF], IEEE802154_LONG_ADDRESS_LEN);
+        expect(gnrc_sixlowpan_frag_vrb_add(&base, &_netifs[OUT_NETIF],
+                                           _next_hop,
+                                           sizeof(_next_hop)) != NULL);
+        for (uint16_t offset = FRAG_PAYLOAD_LEN; offset < DATAGRAM_SIZE;
+             offset += FRAG_PAYLOAD_LEN) {
+            uint32_t start, diff;
+
+            _build_frame(i, offset, seq++);
+            start = ztimer_now(ZTIMER_USEC);
+            netdev_trigger_event_isr(&_devs[IN_NETIF].netdev.netdev);
+            if (ztimer_mutex_lock_timeout(ZTIMER_USEC, &_sent,
+                                          SEND_TIMEOUT_US) < 0) {
+                printf("fragment (tag: %u, offset: %u) was not forwarded\n",
+                       i, offset);
+                return 1;
+            }
+            diff = _sent_usec - start;
+            min = (diff < min) ? diff : min;
+            max = (diff > max) ? diff : max;
+            sum += diff;
+            forwarded++;
+        }
+    }
+    printf("forwarded %u fragments (%s): min %" PRIu32 " us, avg %" PRIu32
+           " us, max %" PRIu32 " us\n", forwarded,
+           IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST) ? "fast path"
+                                                        : "6LoWPAN thread",
+           min, sum / forwarded, max);
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("6LoWPAN fragment forwarding benchmark\r\n")
+    child.expect(r"forwarded \d+ fragments \((fast path|6LoWPAN thread)\): "
+                 r"min \d+ us, avg \d+ us, max \d+ us\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
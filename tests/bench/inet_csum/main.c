@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the Internet checksum
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT     (1000U)
+#endif
+
+#define TEST_BUF_SIZE   (1280U + 4U)
+
+static uint8_t _buf[TEST_BUF_SIZE] __attribute__((aligned(8)));
+
+static const uint16_t _sizes[] = { 40, 64, 256, 1280 };
+
+/* one 16-bit word per iteration, as inet_csum_slice() used to do */
+static uint16_t _csum_ref(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint32_t _run(uint16_t (*csum)(uint16_t, const uint8_t *, uint16_t),
+                     const uint8_t *buf, uint16_t len, uint16_t *res)
+{
+    /* volatile, so the compiler can't hoist the checksum out of the loop */
+    volatile uint16_t sum = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < TEST_REPEAT; i++) {
+        sum = csum(sum, buf, len);
+    }
+
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+    *res = sum;
+    return diff;
+}
+
+static uint32_t _kib_per_s(uint16_t len, uint32_t us)
+{
+    if (us == 0) {
+        us = 1;
+    }
+    return ((uint64_t)len * TEST_REPEAT * 1000000U / 1024U) / us;
+}
+
+int main(void)
+{
+    unsigned failed = 0;
+
+    puts("inet_csum benchmark");
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7 + (i >> 8);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        for (unsigned offset = 0; offset < 2; offset++) {
+            uint16_t len = _sizes[i];
+            uint16_t res, res_ref;
+            uint32_t us = _run(inet_csum, _buf + offset, len, &res);
+            uint32_t us_ref = _run(_csum_ref, _buf + offset, len, &res_ref);
+
+            printf("%4u bytes, offset %u: %7" PRIu32 " us (%7" PRIu32
+                   " KiB/s), byte-wise %7" PRIu32 " us (%7" PRIu32 " KiB/s)\n",
+                   len, offset, us, _kib_per_s(len, us),
+                   us_ref, _kib_per_s(len, us_ref));
+            if (res != res_ref) {
+                printf("checksum mismatch: 0x%04x != 0x%04x\n", res, res_ref);
+                failed++;
+            }
+        }
+    }
+
+    puts(failed ? "FAILED" : "done.");
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("inet_csum benchmark\r\n")
+    for _ in range(8):
+        child.expect(r"\s*\d+ bytes, offset \d: \s*\d+ us \(\s*\d+ KiB/s\), "
+                     r"byte-wise \s*\d+ us \(\s*\d+ KiB/s\)\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -8,7 +8,8 @@
  * @{
  *
  * @file
- * @brief       Measure messages send per second
+ * @brief       Measure messages send per second, one by one and in
+ *              batches
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
@@ -17,7 +18,9 @@
 
 #include <stdint.h>
 #include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include "container.h"
 #include "macros/units.h"
 #include "thread.h"
 #include "clk.h"
@@ -29,7 +32,13 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#ifndef TEST_BATCH_SIZE
+#define TEST_BATCH_SIZE     (8U)
+#endif
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[TEST_BATCH_SIZE];
+static volatile bool _batch;
 
 static void _timer_callback(void *_flag)
 {
@@ -41,26 +50,23 @@ static void *_second_thread(void *arg)
 {
     (void)arg;
 
+    msg_init_queue(_queue, ARRAY_SIZE(_queue));
+
     while (1) {
-        msg_t test;
-        msg_receive(&test);
+        msg_t test[TEST_BATCH_SIZE];
+        if (_batch) {
+            msg_receive_batch(test, ARRAY_SIZE(test));
+        }
+        else {
+            msg_receive(test);
+        }
     }
 
     return NULL;
 }
 
-int main(void)
+static uint32_t _run(kernel_pid_t other, bool batch)
 {
-    puts("main starting");
-
-    kernel_pid_t other = thread_create(_stack,
-                                       sizeof(_stack),
-                                       (THREAD_PRIORITY_MAIN - 1),
-                                       0,
-                                       _second_thread,
-                                       NULL,
-                                       "second_thread");
-
     atomic_flag flag = ATOMIC_FLAG_INIT;
     uint32_t n = 0;
 
@@ -69,19 +75,49 @@ int main(void)
         .arg = &flag,
     };
 
+    _batch = batch;
     atomic_flag_test_and_set(&flag);
     xtimer_set(&timer, TEST_DURATION_US);
 
     while (atomic_flag_test_and_set(&flag)) {
-        msg_t test;
-        msg_send(&test, other);
-        n++;
+        msg_t test[TEST_BATCH_SIZE];
+        if (batch) {
+            n += msg_send_batch(test, ARRAY_SIZE(test), other);
+        }
+        else {
+            msg_send(test, other);
+            n++;
+        }
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
+    return n;
+}
+
+static void _print(uint32_t n)
+{
+    printf(" \"result\" : %"PRIu32, n);
     printf(", \"ticks\" : %"PRIu32,
            (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
     puts(" }");
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    kernel_pid_t other = thread_create(_stack,
+                                       sizeof(_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       0,
+                                       _second_thread,
+                                       NULL,
+                                       "second_thread");
+
+    printf("{");
+    _print(_run(other, false));
+
+    printf("{ \"batch\" : %u,", TEST_BATCH_SIZE);
+    _print(_run(other, true));
 
     return 0;
 }
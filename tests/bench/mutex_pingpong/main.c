@@ -27,8 +27,13 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef TEST_WAITERS_MAX
+#define TEST_WAITERS_MAX    (16U)
+#endif
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _waiter_stacks[TEST_WAITERS_MAX - 1][THREAD_STACKSIZE_SMALL];
 static mutex_t _mutex = MUTEX_INIT;
 
 static void _timer_callback(void*arg)
@@ -49,6 +54,31 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static uint32_t _run(void)
+{
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    uint32_t n = 0;
+
+    _flag = 0;
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        mutex_unlock(&_mutex);
+        n++;
+    }
+
+    return n;
+}
+
+static void _print(uint32_t n)
+{
+    printf(" \"result\" : %"PRIu32, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -65,21 +95,23 @@ int main(void)
     mutex_lock(&_mutex);
     thread_yield_higher();
 
-    xtimer_t timer;
-    timer.callback = _timer_callback;
-
-    uint32_t n = 0;
-
-    xtimer_set(&timer, TEST_DURATION);
-    while(!_flag) {
-        mutex_unlock(&_mutex);
-        n++;
+    printf("{");
+    _print(_run());
+
+    /* every unlock hands the mutex to the first waiter, which then queues up
+     * behind all the other waiters again */
+    unsigned waiters = 1;
+    for (unsigned numof = 4; numof <= TEST_WAITERS_MAX; numof *= 4) {
+        while (waiters < numof) {
+            thread_create(_waiter_stacks[waiters - 1],
+                          sizeof(_waiter_stacks[waiters - 1]),
+                          THREAD_PRIORITY_MAIN - 1, 0,
+                          _second_thread, NULL, "waiter");
+            waiters++;
+        }
+        printf("{ \"waiters\" : %u,", waiters);
+        _print(_run());
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
-
     return 0;
 }
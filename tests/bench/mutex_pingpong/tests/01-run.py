@@ -13,6 +13,7 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r"{ \"waiters\" : 4, \"result\" : \d+(, \"ticks\" : \d+)? }")
 
 
 if __name__ == "__main__":
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the nanocoap cache
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "net/nanocoap/cache.h"
+#include "ztimer.h"
+
+#ifndef TEST_REPEAT
+#define TEST_REPEAT     (10000U)
+#endif
+
+/* number of different requests of the workload */
+#define PATHS_NUMOF     (4 * CONFIG_NANOCOAP_CACHE_ENTRIES)
+
+static uint8_t _keys[PATHS_NUMOF][CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+static uint8_t _resp_buf[CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE];
+static coap_pkt_t _resp;
+static uint32_t _seed = 1;
+
+static uint32_t _rand(void)
+{
+    /* deterministic, so all strategies see the same workload */
+    _seed = _seed * 1103515245 + 12345;
+    return _seed >> 8;
+}
+
+/* sizes between 16 bytes and the maximum, not related to popularity */
+static size_t _resp_len(unsigned path)
+{
+    return 16 + (path * 37) % (CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE - 16);
+}
+
+static void _init_keys(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    char path[16];
+
+    for (unsigned i = 0; i < PATHS_NUMOF; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        sha256(path, strlen(path), digest);
+        memcpy(_keys[i], digest, sizeof(_keys[i]));
+    }
+
+    uint8_t token[2] = { 0xDA, 0xEC };
+    size_t len = coap_build_udp_hdr(_resp_buf, sizeof(_resp_buf), COAP_TYPE_NON,
+                                    token, sizeof(token), COAP_CODE_205, 0xABCD);
+    coap_pkt_init(&_resp, _resp_buf, sizeof(_resp_buf), len);
+    coap_opt_finish(&_resp, COAP_OPT_FINISH_NONE);
+}
+
+static nanocoap_cache_entry_t *_add(unsigned path)
+{
+    return nanocoap_cache_add_by_key(_keys[path], COAP_METHOD_GET, &_resp,
+                                     _resp_len(path));
+}
+
+static uint32_t _bench_lookup(unsigned first, bool expected)
+{
+    unsigned failed = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned n = 0; n < TEST_REPEAT; n++) {
+        unsigned path = first + n % CONFIG_NANOCOAP_CACHE_ENTRIES;
+        if (!nanocoap_cache_key_lookup(_keys[path]) == expected) {
+            failed++;
+        }
+    }
+    uint32_t time_us = ztimer_now(ZTIMER_USEC) - start;
+
+    return failed ? UINT32_MAX : time_us;
+}
+
+int main(void)
+{
+    nanocoap_cache_stats_t stats;
+    unsigned failed = 0;
+    uint32_t time_us;
+
+    puts("nanocoap cache benchmark");
+
+    _init_keys();
+    nanocoap_cache_init();
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        if (!_add(i)) {
+            failed++;
+        }
+    }
+
+    time_us = _bench_lookup(0, true);
+    failed += time_us == UINT32_MAX;
+    printf("%-8s: %u lookups %7" PRIu32 " us\n", "hit", TEST_REPEAT, time_us);
+    time_us = _bench_lookup(CONFIG_NANOCOAP_CACHE_ENTRIES, false);
+    failed += time_us == UINT32_MAX;
+    printf("%-8s: %u lookups %7" PRIu32 " us\n", "miss", TEST_REPEAT, time_us);
+
+    /* requests skewed towards the lower paths, adding the response on a
+     * miss like a proxy does */
+    nanocoap_cache_init();
+    time_us = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < TEST_REPEAT; n++) {
+        uint32_t r = _rand() % PATHS_NUMOF;
+        unsigned path = (r * r) / PATHS_NUMOF;
+
+        if (!nanocoap_cache_key_lookup(_keys[path]) && !_add(path)) {
+            failed++;
+        }
+    }
+    time_us = ztimer_now(ZTIMER_USEC) - time_us;
+    printf("%-8s: %u requests %7" PRIu32 " us\n", "workload", TEST_REPEAT, time_us);
+
+    nanocoap_cache_get_stats(&stats);
+    printf("hits: %" PRIu32 " misses: %" PRIu32 " evictions: %" PRIu32 "\n",
+           stats.hits, stats.misses, stats.evictions);
+    if (stats.hits + stats.misses != TEST_REPEAT) {
+        failed++;
+    }
+
+    puts(failed ? "FAILED" : "done.");
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("nanocoap cache benchmark\r\n")
+    for name in ("hit", "miss"):
+        child.expect(r"{}\s*: \d+ lookups \s*\d+ us\r\n".format(name))
+    child.expect(r"workload: \d+ requests \s*\d+ us\r\n")
+    child.expect(r"hits: \d+ misses: \d+ evictions: \d+\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
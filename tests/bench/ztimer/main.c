@@ -17,6 +17,7 @@
 
 #include <stdio.h>
 
+#include "container.h"
 #include "test_utils/expect.h"
 
 #include "msg.h"
@@ -45,6 +46,9 @@
 
 static ztimer_t _timers[NUMOF_TIMERS];
 
+/* numbers of active timers to show how set() / remove() scale */
+static const unsigned _scale[] = { 10, 100, 1000 };
+
 /* This variable is set by any timer that actually triggers.  As the test is
  * only testing set/remove/now operations, timers are not supposed to trigger.
  * Thus, after every test there's an 'expect(!_triggers)'
@@ -270,6 +274,41 @@ int main(void)
     _print_result("remove() many decreasing", NUMOF_TIMERS, diff);
     expect(!_triggers);
 
+    /*
+     * test removing / setting the middle timer REPEAT times with an
+     * increasing number of active timers
+     *
+     */
+    for (unsigned i = 0; i < ARRAY_SIZE(_scale); i++) {
+        unsigned numof = _scale[i];
+        char desc[32];
+
+        if (numof > NUMOF_TIMERS) {
+            break;
+        }
+
+        _base = BASE - (ztimer_now(ZTIMER_USEC) - start);
+        for (n = 0; n < numof; n++) {
+            _timer_set(n);
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        for (n = 0; n < REPEAT; n++) {
+            _timer_remove(numof / 2);
+            _timer_set(numof / 2);
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        snprintf(desc, sizeof(desc), "remove() + set() of %u", numof);
+        _print_result(desc, REPEAT, diff);
+        expect(!_triggers);
+
+        for (n = 0; n < numof; n++) {
+            _timer_remove(n);
+        }
+    }
+
     /*
      * test ztimer_now()
      *
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for batched message delivery
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "container.h"
+#include "msg.h"
+#include "thread.h"
+
+#define RCV_QUEUE_SIZE      (4U)
+#define MSGS_NUMOF          (RCV_QUEUE_SIZE + 2)
+
+static char _rcv_stacks[2][THREAD_STACKSIZE_DEFAULT];
+static msg_t _rcv_queues[2][RCV_QUEUE_SIZE];
+static char _snd_stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _main_pid;
+
+static void _expect(bool cond, const char *what)
+{
+    if (!cond) {
+        printf("FAILED: %s\n", what);
+        exit(1);
+    }
+}
+
+static void *_rcv(void *arg)
+{
+    msg_t *queue = arg;
+
+    msg_init_queue(queue, RCV_QUEUE_SIZE);
+    while (1) {
+        msg_t msgs[MSGS_NUMOF];
+        unsigned numof = msg_receive_batch(msgs, ARRAY_SIZE(msgs));
+
+        printf("%s: got %u:", thread_get_name(thread_get_active()), numof);
+        for (unsigned i = 0; i < numof; i++) {
+            _expect(msgs[i].sender_pid == _main_pid, "sender PID");
+            printf(" %u", (unsigned)msgs[i].content.value);
+        }
+        puts("");
+    }
+
+    return NULL;
+}
+
+static void *_snd(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < MSGS_NUMOF; i++) {
+        msg_t msg = { .type = 0, .content.value = i };
+        msg_send(&msg, _main_pid);
+    }
+
+    return NULL;
+}
+
+static void _test_send_batch(kernel_pid_t rcv)
+{
+    msg_t msgs[MSGS_NUMOF];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        msgs[i].type = 0;
+        msgs[i].content.value = i;
+    }
+    /* one message is copied directly, the remaining ones are queued until
+     * the queue is full */
+    _expect(msg_send_batch(msgs, ARRAY_SIZE(msgs), rcv) == RCV_QUEUE_SIZE + 1,
+            "msg_send_batch() stops at full queue");
+    _expect(msg_send_batch(msgs, ARRAY_SIZE(msgs), KERNEL_PID_UNDEF) == -1,
+            "msg_send_batch() to invalid PID");
+}
+
+static void _test_send_multi(kernel_pid_t *rcvs)
+{
+    kernel_pid_t pids[] = { rcvs[0], KERNEL_PID_UNDEF, rcvs[1] };
+    msg_t msg = { .type = 0, .content.value = 42 };
+
+    _expect(msg_send_multi(&msg, pids, ARRAY_SIZE(pids)) == 2,
+            "msg_send_multi() skips invalid PID");
+}
+
+static void _test_receive_batch(void)
+{
+    msg_t queue[RCV_QUEUE_SIZE];
+    msg_t msgs[MSGS_NUMOF + 1];
+    msg_t late = { .type = 0, .content.value = MSGS_NUMOF };
+    unsigned numof;
+    int late_queued;
+
+    msg_init_queue(queue, ARRAY_SIZE(queue));
+    /* the sender fills the queue and blocks on the next message */
+    thread_create(_snd_stack, sizeof(_snd_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  _snd, NULL, "snd");
+    /* the blocked sender takes the freed slots, a later message must not
+     * overtake it */
+    numof = msg_receive_batch(msgs, 2);
+    printf("main: got %u\n", numof);
+    late_queued = msg_send_to_self(&late);
+    while (numof < MSGS_NUMOF + late_queued) {
+        unsigned res = msg_receive_batch(&msgs[numof], MSGS_NUMOF + late_queued - numof);
+        printf("main: got %u\n", res);
+        numof += res;
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        _expect(msgs[i].content.value == i, "messages in order");
+    }
+}
+
+int main(void)
+{
+    kernel_pid_t rcvs[2];
+
+    _main_pid = thread_getpid();
+    for (unsigned i = 0; i < ARRAY_SIZE(rcvs); i++) {
+        rcvs[i] = thread_create(_rcv_stacks[i], sizeof(_rcv_stacks[i]),
+                                THREAD_PRIORITY_MAIN - 1, 0, _rcv,
+                                _rcv_queues[i], i ? "rcv2" : "rcv1");
+    }
+
+    _test_send_batch(rcvs[0]);
+    _test_send_multi(rcvs);
+    _test_receive_batch();
+
+    puts("Test successful.");
+
+    return 0;
+}
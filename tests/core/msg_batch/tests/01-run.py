@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("rcv1: got 5: 0 1 2 3 4")
+    child.expect_exact("rcv1: got 1: 42")
+    child.expect_exact("rcv2: got 1: 42")
+    child.expect_exact("main: got 2")
+    child.expect_exact("main: got 4")
+    child.expect_exact("Test successful.")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
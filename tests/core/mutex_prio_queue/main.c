@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the priority ordered mutex wait queue
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "mutex.h"
+#include "thread.h"
+
+#define PRIO_LOW        (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_MID        (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_HIGH       (THREAD_PRIORITY_MAIN - 3)
+
+static const uint8_t _prios[] = {
+    PRIO_LOW, PRIO_HIGH, PRIO_LOW, PRIO_MID, PRIO_HIGH, PRIO_LOW, PRIO_MID,
+    /* queued after the cancellations */
+    PRIO_MID, PRIO_LOW, PRIO_HIGH,
+};
+
+/* cancel the first of a priority, the last of a priority, and one in between
+ * the first and last of a priority */
+static const uint8_t _cancel[] = { 3, 5, 4 };
+#define QUEUED_BEFORE_CANCEL    (7U)
+
+static const uint8_t _expected[] = { 3, 5, 4, 1, 9, 6, 7, 0, 2, 8 };
+
+static char _stacks[ARRAY_SIZE(_prios)][THREAD_STACKSIZE_SMALL];
+static char _owner_stack[THREAD_STACKSIZE_SMALL];
+static mutex_cancel_t _mcs[ARRAY_SIZE(_prios)];
+static mutex_t _mutex = MUTEX_INIT;
+static uint8_t _order[ARRAY_SIZE(_prios)];
+static unsigned _order_numof;
+
+static void *_waiter(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    _mcs[idx] = mutex_cancel_init(&_mutex);
+    int res = mutex_lock_cancelable(&_mcs[idx]);
+    _order[_order_numof++] = idx;
+    if (res == 0) {
+        mutex_unlock(&_mutex);
+    }
+
+    return NULL;
+}
+
+/* The mutex is held by a separate thread rather than by main, so that main
+ * does not inherit the priority of the waiters when
+ * core_mutex_priority_inheritance is used. Otherwise the waiters created
+ * later on would not preempt main to queue up right away. */
+static void *_owner(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&_mutex);
+    thread_sleep();
+    mutex_unlock(&_mutex);
+
+    return NULL;
+}
+
+static void _create(unsigned idx)
+{
+    /* the waiter has a higher priority and blocks on the mutex right away */
+    thread_create(_stacks[idx], sizeof(_stacks[idx]), _prios[idx], 0,
+                  _waiter, (void *)(uintptr_t)idx, "waiter");
+}
+
+int main(void)
+{
+    puts("Test for the priority ordered mutex wait queue");
+
+    kernel_pid_t owner = thread_create(_owner_stack, sizeof(_owner_stack),
+                                       PRIO_LOW, 0, _owner, NULL, "owner");
+    for (unsigned i = 0; i < QUEUED_BEFORE_CANCEL; i++) {
+        _create(i);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_cancel); i++) {
+        mutex_cancel(&_mcs[_cancel[i]]);
+    }
+    for (unsigned i = QUEUED_BEFORE_CANCEL; i < ARRAY_SIZE(_prios); i++) {
+        _create(i);
+    }
+    thread_wakeup(owner);
+
+    printf("order:");
+    for (unsigned i = 0; i < _order_numof; i++) {
+        printf(" %u", (unsigned)_order[i]);
+    }
+    puts("");
+
+    if ((_order_numof == ARRAY_SIZE(_expected)) &&
+        (memcmp(_order, _expected, sizeof(_expected)) == 0)) {
+        puts("TEST PASSED");
+    }
+    else {
+        puts("TEST FAILED");
+    }
+
+    return 0;
+}
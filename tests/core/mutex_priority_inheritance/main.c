@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the priority an owner of a mutex
+ *              inherits and falls back to
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+
+#define PRIO_LOW        (THREAD_PRIORITY_MAIN - 1)
+#define PRIO_MID        (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_HIGH       (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_HIGHEST    (THREAD_PRIORITY_MAIN - 4)
+
+static char _stacks[4][THREAD_STACKSIZE_SMALL];
+static mutex_t _mutex1 = MUTEX_INIT;
+static mutex_t _mutex2 = MUTEX_INIT;
+static uint8_t _prio_end;
+static bool _failed;
+
+static void _expect(bool cond, const char *what)
+{
+    if (!cond) {
+        printf("FAILED: %s\n", what);
+        _failed = true;
+    }
+}
+
+static uint8_t _prio(kernel_pid_t pid)
+{
+    return thread_get(pid)->priority;
+}
+
+/* All threads have a higher priority than main. Each of them runs right away
+ * when created or woken up, until it sleeps, blocks or exits. */
+static kernel_pid_t _create(unsigned idx, uint8_t prio,
+                            thread_task_func_t func, void *arg)
+{
+    return thread_create(_stacks[idx], sizeof(_stacks[idx]), prio, 0,
+                         func, arg, "test");
+}
+
+static void *_lock_unlock(void *arg)
+{
+    mutex_lock(arg);
+    mutex_unlock(arg);
+
+    return NULL;
+}
+
+static void *_lock_sleep_unlock(void *arg)
+{
+    mutex_lock(arg);
+    thread_sleep();
+    mutex_unlock(arg);
+
+    return NULL;
+}
+
+static void *_nested(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&_mutex1);
+    thread_sleep();
+    /* locked while boosted by the waiter for _mutex1 */
+    mutex_lock(&_mutex2);
+    thread_sleep();
+    mutex_unlock(&_mutex1);
+    mutex_unlock(&_mutex2);
+    _prio_end = thread_get_active()->priority;
+
+    return NULL;
+}
+
+static void *_lock_unlock_and_sleep(void *arg)
+{
+    mutex_lock(arg);
+    thread_sleep();
+    mutex_unlock_and_sleep(arg);
+
+    return NULL;
+}
+
+static void _test_nested(void)
+{
+    kernel_pid_t owner = _create(0, PRIO_LOW, _nested, NULL);
+    _create(1, PRIO_HIGH, _lock_unlock, &_mutex1);
+    thread_wakeup(owner);
+    _create(2, PRIO_HIGHEST, _lock_unlock, &_mutex2);
+    thread_wakeup(owner);
+
+    _expect(_prio_end == PRIO_LOW, "priority after unlocking nested mutexes");
+}
+
+static void _test_handover(void)
+{
+    kernel_pid_t owner = _create(0, PRIO_LOW, _lock_sleep_unlock, &_mutex1);
+    kernel_pid_t next = _create(1, PRIO_HIGH, _lock_sleep_unlock, &_mutex1);
+    _create(2, PRIO_MID, _lock_unlock, &_mutex1);
+    /* hands the mutex over to next, which sleeps while holding it */
+    thread_wakeup(owner);
+    _create(3, PRIO_HIGHEST, _lock_unlock, &_mutex1);
+
+    _expect(_prio(next) == PRIO_HIGHEST, "priority inherited by the new owner");
+    thread_wakeup(next);
+}
+
+static void _test_unlock_and_sleep(void)
+{
+    kernel_pid_t owner = _create(0, PRIO_LOW, _lock_unlock_and_sleep, &_mutex1);
+    kernel_pid_t next = _create(1, PRIO_HIGH, _lock_sleep_unlock, &_mutex1);
+    _expect(_prio(owner) == PRIO_HIGH, "priority inherited by the owner");
+    thread_wakeup(owner);
+
+    _expect(_prio(owner) == PRIO_LOW,
+            "priority after mutex_unlock_and_sleep()");
+    _create(2, PRIO_HIGHEST, _lock_unlock, &_mutex1);
+    _expect(_prio(next) == PRIO_HIGHEST,
+            "priority inherited by the new owner after mutex_unlock_and_sleep()");
+    thread_wakeup(next);
+    thread_wakeup(owner);
+}
+
+int main(void)
+{
+    puts("Test for mutex priority inheritance");
+
+    _test_nested();
+    _test_handover();
+    _test_unlock_and_sleep();
+
+    puts(_failed ? "TEST FAILED" : "TEST PASSED");
+
+    return 0;
+}
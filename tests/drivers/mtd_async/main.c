@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "macros/math.h"
+#include "macros/utils.h"
+#include "event.h"
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mtd_emulated.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define SECTOR_COUNT        16
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+
+/* SPI NOR flash like access times */
+#define READ_US             50
+#define WRITE_US            500
+#define ERASE_US            10000
+
+#define REQ_NUMOF           8
+#define CHUNK_SIZE          (SECTOR_SIZE / REQ_NUMOF)
+
+/* chunks in non-adjacent buffers that fit into a single merged read */
+#define CHUNKS_MERGED       MAX(1, MIN(REQ_NUMOF, CONFIG_MTD_ASYNC_MERGE_SIZE / CHUNK_SIZE))
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_dev_t *_mtd = &mtd_emulated_dev0.base;
+static mtd_async_dev_t _dev;
+static mtd_async_req_t _reqs[REQ_NUMOF + 2];
+static event_queue_t _evq;
+
+/* order in which the requests completed */
+static unsigned _order[ARRAY_SIZE(_reqs)];
+static unsigned _completed;
+
+/* completions of requests without an event queue, and their threads */
+static event_t _direct_events[ARRAY_SIZE(_reqs)];
+static kernel_pid_t _direct_pids[ARRAY_SIZE(_reqs)];
+
+static uint8_t _buffer[SECTOR_SIZE];
+/* one chunk per request, with gaps in between */
+static uint8_t _chunks[REQ_NUMOF][CHUNK_SIZE + 8];
+
+static void _done(mtd_async_req_t *req)
+{
+    _order[_completed++] = req - _reqs;
+}
+
+static void _direct_event_handler(event_t *ev)
+{
+    _order[_completed++] = ev - _direct_events;
+}
+
+/* runs on the thread completing the request, which passes it on to _wait() */
+static void _done_direct(mtd_async_req_t *req)
+{
+    unsigned idx = req - _reqs;
+
+    _direct_pids[idx] = thread_getpid();
+    event_post(&_evq, &_direct_events[idx]);
+}
+
+static void _wait(unsigned count)
+{
+    while (_completed < count) {
+        event_t *ev = event_wait(&_evq);
+
+        ev->handler(ev);
+    }
+}
+
+static void _test_mem(const uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void test_mtd_async_read_write(void)
+{
+    memset(_buffer, 0x5a, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_dev, &_reqs[0], 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_dev, &_reqs[1], _buffer, 0, SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_dev, &_reqs[2], _chunks[0], 0, CHUNK_SIZE));
+    _wait(3);
+
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(i, _order[i]);
+        TEST_ASSERT_EQUAL_INT(0, _reqs[i].res);
+    }
+    _test_mem(_chunks[0], CHUNK_SIZE, 0x5a);
+}
+
+static void test_mtd_async_merge(void)
+{
+    uint32_t merged = _dev.merged;
+
+    for (unsigned i = 0; i < REQ_NUMOF; i++) {
+        memset(&_buffer[i * CHUNK_SIZE], i, CHUNK_SIZE);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_mtd, _buffer, SECTOR_SIZE, SECTOR_SIZE));
+
+    /* the reads queue up while the worker is busy with the write */
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_dev, &_reqs[REQ_NUMOF], _buffer,
+                                             2 * SECTOR_SIZE, SECTOR_SIZE));
+    for (unsigned i = 0; i < REQ_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_dev, &_reqs[i], _chunks[i],
+                                                SECTOR_SIZE + i * CHUNK_SIZE, CHUNK_SIZE));
+    }
+    _wait(REQ_NUMOF + 1);
+
+    TEST_ASSERT_EQUAL_INT(REQ_NUMOF - DIV_ROUND_UP(REQ_NUMOF, CHUNKS_MERGED),
+                          _dev.merged - merged);
+    for (unsigned i = 0; i < REQ_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _reqs[i].res);
+        _test_mem(_chunks[i], CHUNK_SIZE, i);
+    }
+
+    /* reads into adjacent buffers are merged as well */
+    memset(_buffer, 0, sizeof(_buffer));
+    merged = _dev.merged;
+    _completed = 0;
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_dev, &_reqs[REQ_NUMOF], _chunks[0],
+                                             3 * SECTOR_SIZE, CHUNK_SIZE));
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_dev, &_reqs[i], &_buffer[i * SECTOR_SIZE / 2],
+                                                SECTOR_SIZE + i * SECTOR_SIZE / 2,
+                                                SECTOR_SIZE / 2));
+    }
+    _wait(3);
+
+    TEST_ASSERT_EQUAL_INT(1, _dev.merged - merged);
+    for (unsigned i = 0; i < REQ_NUMOF; i++) {
+        _test_mem(&_buffer[i * CHUNK_SIZE], CHUNK_SIZE, i);
+    }
+}
+
+static void test_mtd_async_erase_overlap(void)
+{
+    memset(_buffer, 0xa5, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_mtd, _buffer, 9 * SECTOR_SIZE, SECTOR_SIZE));
+
+    /* a long erase, followed by a read and a write of other sectors and a
+     * read of a sector being erased */
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_dev, &_reqs[0], 8, 8));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_dev, &_reqs[1], _chunks[0], 0, CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write(&_dev, &_reqs[2], _buffer,
+                                             4 * SECTOR_SIZE, CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_dev, &_reqs[3], _chunks[1],
+                                            9 * SECTOR_SIZE, CHUNK_SIZE));
+    _wait(4);
+
+    /* only the unrelated read overtakes the erase */
+    TEST_ASSERT_EQUAL_INT(1, _order[0]);
+    TEST_ASSERT_EQUAL_INT(0, _order[1]);
+    TEST_ASSERT_EQUAL_INT(2, _order[2]);
+    TEST_ASSERT_EQUAL_INT(3, _order[3]);
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _reqs[i].res);
+    }
+    _test_mem(_chunks[1], CHUNK_SIZE, 0xff);
+}
+
+static void test_mtd_async_read_during_erase(void)
+{
+    /* the erase of the first sector is running when the read is submitted */
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_dev, &_reqs[0], 8, 8));
+    ztimer_sleep(ZTIMER_USEC, ERASE_US / 2);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_dev, &_reqs[1], _chunks[0], 0, CHUNK_SIZE));
+    _wait(1);
+    uint32_t read_us = ztimer_now(ZTIMER_USEC) - start;
+    _wait(2);
+
+    /* the read finishes before the erase ends */
+    TEST_ASSERT_EQUAL_INT(1, _order[0]);
+    TEST_ASSERT_EQUAL_INT(0, _order[1]);
+    TEST_ASSERT_EQUAL_INT(0, _reqs[0].res);
+    TEST_ASSERT_EQUAL_INT(0, _reqs[1].res);
+    if (IS_USED(MODULE_MTD_ASYNC_SUSPEND)) {
+        /* without waiting for the erase of the sector */
+        TEST_ASSERT(read_us < ERASE_US / 4);
+    }
+}
+
+static void test_mtd_async_no_queue(void)
+{
+    for (unsigned i = 0; i < 2; i++) {
+        mtd_async_req_init(&_reqs[i], NULL, _done_direct, NULL);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_dev, &_reqs[0], 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read(&_dev, &_reqs[1], _chunks[0],
+                                            SECTOR_SIZE, CHUNK_SIZE));
+    _wait(2);
+
+    /* both callbacks ran on the worker thread */
+    TEST_ASSERT(_direct_pids[1] != thread_getpid());
+    TEST_ASSERT_EQUAL_INT(_direct_pids[1], _direct_pids[0]);
+    TEST_ASSERT_EQUAL_INT(0, _reqs[0].res);
+    _test_mem(_chunks[0], CHUNK_SIZE, 0xff);
+}
+
+static void test_mtd_async_overflow(void)
+{
+    const uint32_t size = SECTOR_COUNT * SECTOR_SIZE;
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_async_read(&_dev, &_reqs[0], _buffer,
+                                                     size - 1, 2));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_async_write(&_dev, &_reqs[0], _buffer,
+                                                      UINT32_MAX, 2));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_async_erase_sector(&_dev, &_reqs[0],
+                                                             SECTOR_COUNT - 1, 2));
+}
+
+static void set_up(void)
+{
+    _completed = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(_reqs); i++) {
+        mtd_async_req_init(&_reqs[i], &_evq, _done, NULL);
+        _direct_events[i].handler = _direct_event_handler;
+    }
+    mtd_erase_sector(_mtd, 0, SECTOR_COUNT);
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_read_write),
+        new_TestFixture(test_mtd_async_merge),
+        new_TestFixture(test_mtd_async_erase_overlap),
+        new_TestFixture(test_mtd_async_read_during_erase),
+        new_TestFixture(test_mtd_async_no_queue),
+        new_TestFixture(test_mtd_async_overflow),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    event_queue_init(&_evq);
+    mtd_init(_mtd);
+    mtd_emulated_dev0.latency = (mtd_emulated_latency_t) {
+        .read_us = READ_US,
+        .write_us = WRITE_US,
+        .erase_us = ERASE_US,
+    };
+    mtd_async_init(&_dev, _mtd);
+
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
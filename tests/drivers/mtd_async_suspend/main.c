@@ -0,0 +1 @@
+../mtd_async/main.c
\ No newline at end of file
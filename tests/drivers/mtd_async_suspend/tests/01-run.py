@@ -0,0 +1 @@
+../../mtd_async/tests/01-run.py
\ No newline at end of file
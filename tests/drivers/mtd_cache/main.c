@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+
+#define SECTOR_COUNT        16
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+
+/* small unaligned records, as written by a logger */
+#define RECORD_SIZE         24
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_cache_t _cache = {
+    .mtd.driver = &mtd_cache_driver,
+    .parent = &mtd_emulated_dev0.base,
+};
+
+static mtd_dev_t *_dev = &_cache.mtd;
+static mtd_dev_t *_parent = &mtd_emulated_dev0.base;
+
+/* the driver of the parent, for a parent that doesn't need erasing */
+static mtd_desc_t _direct_write_driver;
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static void _test_mem(const uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void _write_sector(mtd_dev_t *dev, uint32_t sector, uint8_t val)
+{
+    memset(_buffer, val, SECTOR_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(dev, _buffer, sector * PAGE_PER_SECTOR,
+                                            0, SECTOR_SIZE));
+}
+
+static void _check_sector(mtd_dev_t *dev, uint32_t sector, uint8_t val)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, _buffer, sector * SECTOR_SIZE, SECTOR_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE, val);
+}
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(_dev));
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+}
+
+static void test_mtd_cache_coalesce(void)
+{
+    mtd_cache_stats_t stats;
+    unsigned records = SECTOR_SIZE / RECORD_SIZE;
+
+    /* records cross page boundaries, but all end up in sector 1 */
+    for (unsigned i = 0; i < records; i++) {
+        memset(_buffer, i, RECORD_SIZE);
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, PAGE_PER_SECTOR,
+                                                i * RECORD_SIZE, RECORD_SIZE));
+    }
+
+    /* nothing reached the parent yet, but reads see the new data */
+    _check_sector(_parent, 1, 0xff);
+    for (unsigned i = 0; i < records; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE + i * RECORD_SIZE,
+                                          RECORD_SIZE));
+        _test_mem(_buffer, RECORD_SIZE, i);
+    }
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.erases);
+
+    /* a single erase for all records */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases);
+    TEST_ASSERT_EQUAL_INT(records - 1, stats.erases_saved);
+
+    for (unsigned i = 0; i < records; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_parent, _buffer, SECTOR_SIZE + i * RECORD_SIZE,
+                                          RECORD_SIZE));
+        _test_mem(_buffer, RECORD_SIZE, i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_parent, _buffer, SECTOR_SIZE + records * RECORD_SIZE,
+                                      SECTOR_SIZE - records * RECORD_SIZE));
+    _test_mem(_buffer, SECTOR_SIZE - records * RECORD_SIZE, 0xff);
+
+    /* nothing left to write back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases);
+}
+
+static void test_mtd_cache_evict(void)
+{
+    mtd_cache_stats_t stats;
+
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        _write_sector(_dev, i, 0xa0 + i);
+    }
+    /* make sector 0 the most recently used one */
+    _write_sector(_dev, 0, 0xa0);
+
+    /* evicts sector 1, or sector 0 if there is no room for another one */
+    _write_sector(_dev, CONFIG_MTD_CACHE_SECTORS, 0xb0);
+
+    const uint32_t evicted = (CONFIG_MTD_CACHE_SECTORS > 1) ? 1 : 0;
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases);
+    _check_sector(_parent, evicted, 0xa0 + evicted);
+    _check_sector(_parent, CONFIG_MTD_CACHE_SECTORS, 0xff);
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_SECTORS; i++) {
+        _check_sector(_dev, i, 0xa0 + i);
+    }
+    _check_sector(_dev, CONFIG_MTD_CACHE_SECTORS, 0xb0);
+}
+
+static void test_mtd_cache_erase(void)
+{
+    mtd_cache_stats_t stats;
+
+    _write_sector(_parent, 2, 0x55);
+    _write_sector(_dev, 2, 0xaa);
+    _check_sector(_dev, 2, 0xaa);
+
+    /* the pending write is dropped, not written back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 2, 1));
+    _check_sector(_dev, 2, 0xff);
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases_saved);
+    _check_sector(_parent, 2, 0xff);
+}
+
+static void test_mtd_cache_power(void)
+{
+    _write_sector(_dev, 3, 0x33);
+    _check_sector(_parent, 3, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_DOWN));
+    _check_sector(_parent, 3, 0x33);
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_UP));
+}
+
+static void test_mtd_cache_direct_write(void)
+{
+    mtd_cache_stats_t stats;
+
+    _direct_write_driver = _mtd_emulated_driver;
+    _direct_write_driver.flags |= MTD_DRIVER_FLAG_DIRECT_WRITE;
+    _parent->driver = &_direct_write_driver;
+
+    /* coalesced writes save no erases if the parent doesn't erase */
+    _write_sector(_dev, 4, 0x44);
+    _write_sector(_dev, 4, 0x45);
+    _write_sector(_dev, 5, 0x55);
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 5, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    _check_sector(_parent, 4, 0x45);
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.erases);
+    TEST_ASSERT_EQUAL_INT(0, stats.erases_saved);
+}
+
+static void set_up(void)
+{
+    /* start every test with an empty cache and an erased device */
+    memset(_cache.lines, 0, sizeof(_cache.lines));
+    memset(&_cache.stats, 0, sizeof(_cache.stats));
+    memset(mtd_emulated_dev0.memory, 0xff, mtd_emulated_dev0.size);
+    _parent->driver = &_mtd_emulated_driver;
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_coalesce),
+        new_TestFixture(test_mtd_cache_evict),
+        new_TestFixture(test_mtd_cache_erase),
+        new_TestFixture(test_mtd_cache_power),
+        new_TestFixture(test_mtd_cache_direct_write),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,368 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the size class backend of the GNRC packet buffer
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+
+#include "pktbuf_sizeclass.h"
+
+#define HDR_LEN         (40U)   /* size of an IPv6 header */
+#define FRAME_LEN       (102U)
+#define PAYLOAD_LEN     (1000U)
+#define CHURN_ROUNDS    (1000U)
+#define CHURN_PKTS      (16U)
+
+static unsigned _used(unsigned cls)
+{
+    gnrc_pktbuf_sizeclass_stats_t stats;
+
+    gnrc_pktbuf_sizeclass_get_stats(cls, &stats);
+    return stats.used;
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+}
+
+static void test_pktbuf_sizeclass_init(void)
+{
+    gnrc_pktbuf_sizeclass_stats_t stats;
+
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SIZECLASS_NUMOF; cls++) {
+        gnrc_pktbuf_sizeclass_get_stats(cls, &stats);
+        TEST_ASSERT_EQUAL_INT(0, stats.used);
+        TEST_ASSERT_EQUAL_INT(0, stats.used_max);
+        TEST_ASSERT_EQUAL_INT(0, stats.requested);
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_sizeclass_get_fails());
+}
+
+static void test_pktbuf_sizeclass_add__classes(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_LEN,
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add(pkt, NULL, FRAME_LEN, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add(pkt, NULL, HDR_LEN, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(3, _used(GNRC_PKTBUF_SIZECLASS_SNIP));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_HDR));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_FRAME));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_MTU));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_sizeclass_add__too_big(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL,
+                                     CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE + 1,
+                                     GNRC_NETTYPE_UNDEF));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass_add__fallback(void)
+{
+    gnrc_pktsnip_t *pkt = NULL, *tmp;
+    gnrc_pktbuf_sizeclass_stats_t stats;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, NULL, HDR_LEN, GNRC_NETTYPE_UNDEF);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _used(GNRC_PKTBUF_SIZECLASS_FRAME));
+    /* header class is exhausted, so the next header takes a frame block */
+    tmp = gnrc_pktbuf_add(pkt, NULL, HDR_LEN, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(tmp);
+    pkt = tmp;
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_FRAME));
+    gnrc_pktbuf_sizeclass_get_stats(GNRC_PKTBUF_SIZECLASS_HDR, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.fallbacks);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_NUMOF, stats.used);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass_add__memfull(void)
+{
+    gnrc_pktsnip_t *pkt = NULL, *tmp;
+    gnrc_pktbuf_sizeclass_stats_t stats;
+
+    while ((tmp = gnrc_pktbuf_add(pkt, NULL, PAYLOAD_LEN, GNRC_NETTYPE_UNDEF))) {
+        pkt = tmp;
+    }
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_pktbuf_sizeclass_get_fails());
+    gnrc_pktbuf_sizeclass_get_stats(GNRC_PKTBUF_SIZECLASS_MTU, &stats);
+    TEST_ASSERT_EQUAL_INT(stats.numof, stats.used);
+    /* the snip descriptor of the failed allocation was released again */
+    TEST_ASSERT_EQUAL_INT(stats.numof, _used(GNRC_PKTBUF_SIZECLASS_SNIP));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass_stats__high_water(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    gnrc_pktbuf_sizeclass_stats_t stats;
+
+    for (unsigned i = 0; i < 3; i++) {
+        pkt = gnrc_pktbuf_add(pkt, NULL, FRAME_LEN, GNRC_NETTYPE_UNDEF);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    gnrc_pktbuf_sizeclass_get_stats(GNRC_PKTBUF_SIZECLASS_FRAME, &stats);
+    TEST_ASSERT_EQUAL_INT(3, stats.used);
+    TEST_ASSERT_EQUAL_INT(3, stats.used_max);
+    TEST_ASSERT_EQUAL_INT(3 * FRAME_LEN, stats.requested);
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_sizeclass_get_stats(GNRC_PKTBUF_SIZECLASS_FRAME, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.used);
+    TEST_ASSERT_EQUAL_INT(3, stats.used_max);
+    TEST_ASSERT_EQUAL_INT(3, stats.allocs);
+    TEST_ASSERT_EQUAL_INT(0, stats.requested);
+}
+
+static void test_pktbuf_sizeclass_mark__in_place(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_LEN,
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr;
+    uint8_t *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, HDR_LEN, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(hdr == pkt->next);
+    TEST_ASSERT(data == hdr->data);
+    TEST_ASSERT(data + HDR_LEN == pkt->data);
+    TEST_ASSERT_EQUAL_INT(PAYLOAD_LEN - HDR_LEN, pkt->size);
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_MTU));
+    /* the block must stay allocated while the payload still uses it */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_MTU));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_sizeclass_mark__unaligned(void)
+{
+    uint8_t payload[HDR_LEN];
+    gnrc_pktsnip_t *pkt, *hdr;
+    uint8_t *data;
+
+    for (unsigned i = 0; i < sizeof(payload); i++) {
+        payload[i] = i;
+    }
+    pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, 1, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    /* the rest moved to its own, aligned block */
+    TEST_ASSERT(data == hdr->data);
+    TEST_ASSERT(data + 1 != pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)pkt->data % 8);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(pkt->data, &payload[1], sizeof(payload) - 1));
+    TEST_ASSERT_EQUAL_INT(2, _used(GNRC_PKTBUF_SIZECLASS_HDR));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_HDR));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static unsigned _lent_returned;
+
+static void _lent_release(void *arg)
+{
+    (void)arg;
+    _lent_returned++;
+}
+
+static void test_pktbuf_sizeclass_mark__lent(void)
+{
+    static uint8_t frame[FRAME_LEN];
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    _lent_returned = 0;
+    pkt = gnrc_pktbuf_add_lent(NULL, frame, sizeof(frame), GNRC_NETTYPE_UNDEF,
+                               _lent_release, NULL);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(frame == pkt->data);
+    /* only the snips are taken from the packet buffer */
+    TEST_ASSERT_EQUAL_INT(0, _used(GNRC_PKTBUF_SIZECLASS_FRAME));
+    hdr = gnrc_pktbuf_mark(pkt, HDR_LEN, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(frame == hdr->data);
+    TEST_ASSERT(frame + HDR_LEN == pkt->data);
+    TEST_ASSERT_EQUAL_INT(2, _used(GNRC_PKTBUF_SIZECLASS_SNIP));
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(0, _lent_returned);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, _lent_returned);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_sizeclass_realloc_data__in_place(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, HDR_LEN,
+                                          GNRC_NETTYPE_UNDEF);
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 8));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt,
+                                                      CONFIG_GNRC_PKTBUF_SIZECLASS_HDR_SIZE));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SIZECLASS_HDR));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass_realloc_data__shared(void)
+{
+    uint8_t payload[HDR_LEN];
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    for (unsigned i = 0; i < sizeof(payload); i++) {
+        payload[i] = i;
+    }
+    pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    /* the rest of the block belongs to pkt, so hdr has to move */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, HDR_LEN));
+    TEST_ASSERT(((uint8_t *)hdr->data + 8) != pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(hdr->data, payload, 8));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(pkt->data, &payload[8], sizeof(payload) - 8));
+    TEST_ASSERT_EQUAL_INT(2, _used(GNRC_PKTBUF_SIZECLASS_HDR));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass_realloc_data__memfull(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, HDR_LEN,
+                                          GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(ENOMEM, gnrc_pktbuf_realloc_data(pkt,
+                                                           CONFIG_GNRC_PKTBUF_SIZECLASS_MTU_SIZE + 1));
+    TEST_ASSERT_EQUAL_INT(HDR_LEN, pkt->size);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass_churn(void)
+{
+    static const uint16_t sizes[] = { 0, 8, HDR_LEN, FRAME_LEN, PAYLOAD_LEN };
+    gnrc_pktsnip_t *pkts[CHURN_PKTS] = { NULL };
+
+    random_init(0x5eed);
+    for (unsigned round = 0; round < CHURN_ROUNDS; round++) {
+        unsigned i = random_uint32_range(0, CHURN_PKTS);
+
+        if (pkts[i] == NULL) {
+            unsigned size = sizes[random_uint32_range(0, ARRAY_SIZE(sizes))];
+            pkts[i] = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+        }
+        else if (pkts[i]->size > 1) {
+            gnrc_pktsnip_t *hdr = gnrc_pktbuf_mark(pkts[i],
+                                                   pkts[i]->size / 2,
+                                                   GNRC_NETTYPE_TEST);
+            if (hdr == NULL) {
+                gnrc_pktbuf_release(pkts[i]);
+                pkts[i] = NULL;
+            }
+            else if (random_uint32_range(0, 2)) {
+                pkts[i] = gnrc_pktbuf_remove_snip(pkts[i], hdr);
+            }
+            else if (gnrc_pktbuf_merge(pkts[i]) != 0) {
+                gnrc_pktbuf_release(pkts[i]);
+                pkts[i] = NULL;
+            }
+        }
+        else {
+            gnrc_pktbuf_release(pkts[i]);
+            pkts[i] = NULL;
+        }
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+    }
+    for (unsigned i = 0; i < CHURN_PKTS; i++) {
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static Test *tests_gnrc_pktbuf_sizeclass(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_sizeclass_init),
+        new_TestFixture(test_pktbuf_sizeclass_add__classes),
+        new_TestFixture(test_pktbuf_sizeclass_add__too_big),
+        new_TestFixture(test_pktbuf_sizeclass_add__fallback),
+        new_TestFixture(test_pktbuf_sizeclass_add__memfull),
+        new_TestFixture(test_pktbuf_sizeclass_stats__high_water),
+        new_TestFixture(test_pktbuf_sizeclass_mark__in_place),
+        new_TestFixture(test_pktbuf_sizeclass_mark__unaligned),
+        new_TestFixture(test_pktbuf_sizeclass_mark__lent),
+        new_TestFixture(test_pktbuf_sizeclass_realloc_data__in_place),
+        new_TestFixture(test_pktbuf_sizeclass_realloc_data__shared),
+        new_TestFixture(test_pktbuf_sizeclass_realloc_data__memfull),
+        new_TestFixture(test_pktbuf_sizeclass_churn),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_sizeclass());
+    TESTS_END();
+
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+
+    return 0;
+}
@@ -17,8 +17,11 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "sched.h"
 #include "shell.h"
 #include "msg.h"
 #include "net/ipv6/addr.h"
@@ -31,9 +34,23 @@
 #include "net/gnrc/netif/ieee802154.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pktdump.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/gnrc/udp.h"
+#include "net/l2util.h"
 #include "net/netdev_test.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS                (1000U)
+#endif
+#define BENCH_BATCH                 (4U)
+#define BENCH_BATCH_DELAY_US        (1000U)
+#define BENCH_PAYLOAD_LEN           (16U)
+#define BENCH_CTX_ID                (1U)
 
 #define IEEE802154_MAX_FRAG_SIZE    (102)
 #define IEEE802154_LOCAL_EUI64     { \
@@ -47,6 +64,9 @@ static gnrc_netif_t _netif;
 static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
 static netdev_test_t _ieee802154_dev;
 static const uint8_t _ieee802154_local_eui64[] = IEEE802154_LOCAL_EUI64;
+static const uint8_t _ieee802154_remote_eui64[] = IEEE802154_REMOTE_EUI64;
+static uint8_t _sent_frame[IEEE802154_MAX_FRAG_SIZE];
+static size_t _sent_frame_len;
 
 static int _get_netdev_device_type(netdev_t *netdev, void *value, size_t max_len)
 {
@@ -92,6 +112,26 @@ static int _get_netdev_addr_long(netdev_t *netdev, void *value, size_t max_len)
     return sizeof(_ieee802154_local_eui64);
 }
 
+static int _netdev_send(netdev_t *netdev, const iolist_t *iolist)
+{
+    int res = 0;
+
+    (void)netdev;
+    /* only keep the 6LoWPAN frame, the MAC header carries a sequence number */
+    _sent_frame_len = 0;
+    for (const iolist_t *ptr = iolist->iol_next; ptr != NULL;
+         ptr = ptr->iol_next) {
+        if ((_sent_frame_len + ptr->iol_len) <= sizeof(_sent_frame)) {
+            memcpy(&_sent_frame[_sent_frame_len], ptr->iol_base, ptr->iol_len);
+            _sent_frame_len += ptr->iol_len;
+        }
+    }
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        res += iolist->iol_len;
+    }
+    return res;
+}
+
 static void _init_interface(void)
 {
     netdev_test_setup(&_ieee802154_dev, NULL);
@@ -105,6 +145,7 @@ static void _init_interface(void)
                            _get_netdev_src_len);
     netdev_test_set_get_cb(&_ieee802154_dev, NETOPT_ADDRESS_LONG,
                            _get_netdev_addr_long);
+    netdev_test_set_send_cb(&_ieee802154_dev, _netdev_send);
     gnrc_netif_ieee802154_create(&_netif,
             _netif_stack, THREAD_STACKSIZE_DEFAULT, GNRC_NETIF_PRIO,
             "dummy_netif", &_ieee802154_dev.netdev.netdev);
@@ -230,11 +271,124 @@ static void _send_packet(void)
     gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN, GNRC_NETREG_DEMUX_CTX_ALL, pkt2);
 }
 
+static gnrc_pktsnip_t *_build_flow_pkt(const ipv6_addr_t *src,
+                                       const ipv6_addr_t *dst)
+{
+    static const uint8_t payload[BENCH_PAYLOAD_LEN] = { 0 };
+    gnrc_pktsnip_t *pkt, *netif;
+
+    pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload), GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, 61616, 61616);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, src, dst);
+    expect(pkt != NULL);
+    ((ipv6_hdr_t *)pkt->data)->nh = PROTNUM_UDP;
+    ((ipv6_hdr_t *)pkt->data)->hl = 64;
+    netif = gnrc_netif_hdr_build(NULL, 0, _ieee802154_remote_eui64,
+                                 sizeof(_ieee802154_remote_eui64));
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return gnrc_pkt_prepend(pkt, netif);
+}
+
+static void _bench_flow(const char *name, const ipv6_addr_t *src,
+                        const ipv6_addr_t *dst)
+{
+    uint8_t frame[IEEE802154_MAX_FRAG_SIZE];
+    size_t frame_len;
+    uint32_t start, encode_us, decode_us;
+
+    /* the encoding of a flow must not depend on whether it was sent before */
+    gnrc_sixlowpan_iphc_send(_build_flow_pkt(src, dst), NULL, 0);
+    frame_len = _sent_frame_len;
+    memcpy(frame, _sent_frame, frame_len);
+    gnrc_sixlowpan_iphc_send(_build_flow_pkt(src, dst), NULL, 0);
+    if ((frame_len == 0) || (frame_len != _sent_frame_len) ||
+        (memcmp(frame, _sent_frame, frame_len) != 0)) {
+        printf("error: encoding of %s flow differs\n", name);
+    }
+
+    /* run with a higher priority than the network stack, so only the time
+     * to (de-)compress and queue the packets is taken. The stack handles the
+     * queued packets after each batch */
+    sched_change_priority(thread_get_active(), GNRC_NETIF_PRIO - 1);
+    encode_us = 0;
+    decode_us = 0;
+    for (unsigned i = 0; i < BENCH_ROUNDS; i += BENCH_BATCH) {
+        gnrc_pktsnip_t *pkts[BENCH_BATCH];
+
+        for (unsigned j = 0; j < BENCH_BATCH; j++) {
+            pkts[j] = _build_flow_pkt(src, dst);
+        }
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < BENCH_BATCH; j++) {
+            gnrc_sixlowpan_iphc_send(pkts[j], NULL, 0);
+        }
+        encode_us += ztimer_now(ZTIMER_USEC) - start;
+        ztimer_sleep(ZTIMER_USEC, BENCH_BATCH_DELAY_US);
+
+        for (unsigned j = 0; j < BENCH_BATCH; j++) {
+            pkts[j] = gnrc_netif_hdr_build(
+                    _ieee802154_remote_eui64, sizeof(_ieee802154_remote_eui64),
+                    _ieee802154_local_eui64, sizeof(_ieee802154_local_eui64)
+                );
+            expect(pkts[j] != NULL);
+            gnrc_netif_hdr_set_netif(pkts[j]->data, &_netif);
+            pkts[j] = gnrc_pktbuf_add(pkts[j], frame, frame_len,
+                                      GNRC_NETTYPE_SIXLOWPAN);
+            expect(pkts[j] != NULL);
+        }
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < BENCH_BATCH; j++) {
+            gnrc_sixlowpan_iphc_recv(pkts[j], NULL, 0);
+        }
+        decode_us += ztimer_now(ZTIMER_USEC) - start;
+        ztimer_sleep(ZTIMER_USEC, BENCH_BATCH_DELAY_US);
+    }
+    sched_change_priority(thread_get_active(), THREAD_PRIORITY_MAIN);
+
+    printf("bench: %s: %u packets encoded in %" PRIu32 " us, "
+           "decoded in %" PRIu32 " us\n",
+           name, BENCH_ROUNDS, encode_us, decode_us);
+}
+
+static void _run_benchmark(void)
+{
+    ipv6_addr_t src = IPV6_ADDR_UNSPECIFIED, dst = IPV6_ADDR_UNSPECIFIED;
+    ipv6_addr_t prefix = IPV6_ADDR_UNSPECIFIED;
+    eui64_t iid;
+
+    /* fd01::/64 */
+    prefix.u8[0] = 0xfd;
+    prefix.u8[1] = 0x01;
+    expect(gnrc_sixlowpan_ctx_update(BENCH_CTX_ID, &prefix, 64, UINT16_MAX,
+                                     true) != NULL);
+
+    expect(gnrc_netif_ipv6_get_iid(&_netif, &iid) == sizeof(iid));
+    src.u64[1] = iid.uint64;
+    expect(l2util_ipv6_iid_from_addr(NETDEV_TYPE_IEEE802154,
+                                     _ieee802154_remote_eui64,
+                                     sizeof(_ieee802154_remote_eui64),
+                                     &iid) == sizeof(iid));
+    dst.u64[1] = iid.uint64;
+
+    ipv6_addr_set_link_local_prefix(&src);
+    ipv6_addr_set_link_local_prefix(&dst);
+    _bench_flow("link-local", &src, &dst);
+    ipv6_addr_init_prefix(&src, &prefix, 64);
+    ipv6_addr_init_prefix(&dst, &prefix, 64);
+    _bench_flow("context", &src, &dst);
+
+    gnrc_sixlowpan_ctx_remove(BENCH_CTX_ID);
+}
+
 int main(void)
 {
     puts("RIOT network stack example application");
 
     _init_interface();
+    _run_benchmark();
     _send_packet();
 
     return 0;
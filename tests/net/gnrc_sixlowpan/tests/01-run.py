@@ -12,6 +12,13 @@ from testrunner import run
 
 
 def testfunc(child):
+    # IPHC benchmark
+    for flow in ("link-local", "context"):
+        res = child.expect([r"error: [^\r\n]+",
+                            r"bench: {}: \d+ packets encoded in \d+ us, "
+                            r"decoded in \d+ us".format(flow)])
+        assert res == 1, child.match.group(0)
+
     # 1st 6LoWPAN fragment
     child.expect_exact("PKTDUMP: data received:")
     child.expect_exact("~~ SNIP  0 - size:  74 byte, type: NETTYPE_SIXLOWPAN (1)")
@@ -15,6 +15,10 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "container.h"
 #include "embUnit.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netreg.h"
@@ -31,6 +35,7 @@
 #define TEST_PAGE               (0)
 #define TEST_RECEIVE_TIMEOUT    (100U)
 #define TEST_GC_TIMEOUT         (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US + TEST_RECEIVE_TIMEOUT)
+#define TEST_BENCH_ROUNDS       (1000U)
 
 /* test date taken from an experimental run (uncompressed ICMPv6 echo reply with
  * 300 byte payload)*/
@@ -232,10 +237,23 @@ static void _test_entry(const gnrc_sixlowpan_frag_rb_t *entry,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_BITMAP)
+    /* the fragments of TEST_DATAGRAM are tracked in 8-octet units */
+    TEST_ASSERT_NULL(entry->super.ints);
+    TEST_ASSERT_EQUAL_INT(1, bf_popcnt(entry->starts,
+                                       GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS));
+    TEST_ASSERT(bf_isset(entry->starts, exp_int_start / 8));
+    TEST_ASSERT_EQUAL_INT((exp_int_end / 8) - (exp_int_start / 8) + 1,
+                          bf_popcnt(entry->units,
+                                    GNRC_SIXLOWPAN_FRAG_RB_BITMAP_UNITS));
+    TEST_ASSERT(bf_isset(entry->units, exp_int_start / 8));
+    TEST_ASSERT(bf_isset(entry->units, exp_int_end / 8));
+#else
     TEST_ASSERT_NOT_NULL(entry->super.ints);
     TEST_ASSERT_NULL(entry->super.ints->next);
     TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints->start);
     TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints->end);
+#endif
 }
 
 static void _check_pktbuf(const gnrc_sixlowpan_frag_rb_t *entry)
@@ -661,10 +679,83 @@ static void run_unittests(void)
     TESTS_END();
 }
 
+static int _bench_add(uint8_t *fragment, size_t fragment_size,
+                      size_t offset, uint16_t tag)
+{
+    gnrc_pktsnip_t *pkt;
+    gnrc_sixlowpan_frag_rb_t *entry;
+
+    _set_fragment_tag(fragment, tag);
+    if ((pkt = gnrc_pktbuf_add(NULL, fragment, fragment_size,
+                               GNRC_NETTYPE_SIXLOWPAN)) == NULL) {
+        return -1;
+    }
+    if ((entry = gnrc_sixlowpan_frag_rb_add(&_test_netif_hdr.hdr, pkt, offset,
+                                            TEST_PAGE)) == NULL) {
+        return -1;
+    }
+    /* without receivers, the complete datagram is released */
+    return gnrc_sixlowpan_frag_rb_dispatch_when_complete(entry,
+                                                         &_test_netif_hdr.hdr);
+}
+
+/* reassembles CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE datagrams of distinct
+ * senders at once, with their fragments interleaved */
+static void run_benchmark(void)
+{
+    static const struct {
+        uint8_t *data;
+        size_t size;
+        size_t offset;
+    } frags[] = {
+        { _fragment1, sizeof(_fragment1), TEST_FRAGMENT1_OFFSET },
+        { _fragment2, sizeof(_fragment2), TEST_FRAGMENT2_OFFSET },
+        { _fragment3, sizeof(_fragment3), TEST_FRAGMENT3_OFFSET },
+        { _fragment4, sizeof(_fragment4), TEST_FRAGMENT4_OFFSET },
+    };
+    uint8_t *src = gnrc_netif_hdr_get_src_addr(&_test_netif_hdr.hdr);
+    unsigned completed = 0;
+    uint32_t start;
+
+    _set_up();
+    start = xtimer_now_usec();
+    for (unsigned round = 0; round < TEST_BENCH_ROUNDS; round++) {
+        for (unsigned f = 0; f < ARRAY_SIZE(frags); f++) {
+            for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+                int res;
+
+                src[sizeof(_test_netif_hdr_src) - 1] = i;
+                res = _bench_add(frags[f].data, frags[f].size, frags[f].offset,
+                                 TEST_TAG + round + i);
+                if (res < 0) {
+                    printf("bench: adding fragment %u of datagram %u failed\n",
+                           f + 1, i);
+                    return;
+                }
+                completed += res;
+            }
+        }
+    }
+    uint32_t duration = xtimer_now_usec() - start;
+
+    if (completed != (TEST_BENCH_ROUNDS * CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)) {
+        printf("bench: only %u datagrams completed\n", completed);
+        return;
+    }
+    if ((_first_non_empty_rbuf() != NULL) || !gnrc_pktbuf_is_empty()) {
+        puts("bench: reassembly buffer or packet buffer not empty");
+        return;
+    }
+    printf("bench: %u datagrams (%u concurrent) reassembled in %" PRIu32
+           " us\n", completed, (unsigned)CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE,
+           duration);
+}
+
 int main(void)
 {
     /* netreg requires queue, but queue size one should be enough for us */
     msg_init_queue(&_msg_queue, 1U);
     run_unittests();
+    run_benchmark();
     return 0;
 }
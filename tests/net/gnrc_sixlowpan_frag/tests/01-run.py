@@ -7,8 +7,14 @@
 # directory for more details.
 
 import sys
-from testrunner import run_check_unittests
+from testrunner import run, check_unittests
+
+
+def testfunc(child):
+    check_unittests(child)
+    child.expect(r"bench: (\d+) datagrams \((\d+) concurrent\) reassembled "
+                 r"in (\d+) us", timeout=60)
 
 
 if __name__ == "__main__":
-    sys.exit(run_check_unittests())
+    sys.exit(run(testfunc))
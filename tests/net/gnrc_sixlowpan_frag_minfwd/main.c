@@ -1434,6 +1434,144 @@ static void test_sixlo_recv__nth_frag__overlap(void)
         ));
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+static void test_vrb_fast_forward__nth_frag(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    gnrc_pktsnip_t *frag;
+    size_t mhr_len;
+
+    TEST_ASSERT_NOT_NULL(
+            (frag = _create_recv_frag(_test_nth_frag, sizeof(_test_nth_frag)))
+        );
+    TEST_ASSERT_NOT_NULL(
+            (vrbe = gnrc_sixlowpan_frag_vrb_add(&_vrbe_base, _mock_netif,
+                                                _rem_l2, sizeof(_rem_l2)))
+        );
+    vrbe->super.arrival = xtimer_now_usec();
+    netdev_ieee802154_t *netdev_ieee802154 = container_of(_mock_netif->dev,
+                                                          netdev_ieee802154_t,
+                                                          netdev);
+    netdev_test_t *netdev_test = container_of(netdev_ieee802154, netdev_test_t,
+                                              netdev);
+    netdev_test_set_send_cb(netdev_test,
+                            _mock_netdev_send);
+    TEST_ASSERT(gnrc_sixlowpan_frag_vrb_fast_forward(frag));
+    TEST_ASSERT((mhr_len = _wait_for_packet(sizeof(_test_nth_frag))));
+    /* reassembly buffer remains empty */
+    TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    _check_vrbe_values(vrbe, mhr_len, NTH_FRAGMENT);
+    TEST_ASSERT_EQUAL_INT(TEST_NTH_FRAG_SIZE, vrbe->super.current_size);
+    TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
+    TEST_ASSERT_MESSAGE(
+            memcmp(&_test_nth_frag[TEST_NTH_FRAG_PAYLOAD_POS],
+                   &_target_buf[mhr_len + sizeof(sixlowpan_frag_n_t)],
+                   TEST_NTH_FRAG_SIZE) == 0,
+            "unexpected forwarded packet payload"
+        );
+    /* VRB entry should not have been removed */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(_vrbe_base.src,
+                                                     _vrbe_base.src_len,
+                                                     _vrbe_base.tag));
+}
+
+static void test_vrb_fast_forward__nth_frag__datagram_complete(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    gnrc_pktsnip_t *frag;
+
+    TEST_ASSERT_NOT_NULL(
+            (frag = _create_recv_frag(_test_nth_frag, sizeof(_test_nth_frag)))
+        );
+    TEST_ASSERT_NOT_NULL(
+            (vrbe = gnrc_sixlowpan_frag_vrb_add(&_vrbe_base, _mock_netif,
+                                                _rem_l2, sizeof(_rem_l2)))
+        );
+    /* simulate current_size only missing the created fragment */
+    vrbe->super.current_size = _vrbe_base.datagram_size - TEST_NTH_FRAG_SIZE;
+    vrbe->super.arrival = xtimer_now_usec();
+    netdev_ieee802154_t *netdev_ieee802154 = container_of(_mock_netif->dev,
+                                                          netdev_ieee802154_t,
+                                                          netdev);
+    netdev_test_t *netdev_test = container_of(netdev_ieee802154, netdev_test_t,
+                                              netdev);
+    netdev_test_set_send_cb(netdev_test,
+                            _mock_netdev_send);
+    TEST_ASSERT(gnrc_sixlowpan_frag_vrb_fast_forward(frag));
+    TEST_ASSERT(_wait_for_packet(sizeof(_test_nth_frag)));
+    /* VRB entry should have been removed */
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(
+            _vrbe_base.src, _vrbe_base.src_len, _vrbe_base.tag
+        ));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(!(_target_buf[0] & IEEE802154_FCF_FRAME_PEND));
+}
+
+static void test_vrb_fast_forward__nth_frag__no_vrbe(void)
+{
+    gnrc_pktsnip_t *frag;
+
+    TEST_ASSERT_NOT_NULL(
+            (frag = _create_recv_frag(_test_nth_frag, sizeof(_test_nth_frag)))
+        );
+    /* left to the 6LoWPAN thread */
+    TEST_ASSERT(!gnrc_sixlowpan_frag_vrb_fast_forward(frag));
+    TEST_ASSERT_NOT_NULL(frag->next);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_NETIF, frag->next->type);
+    TEST_ASSERT_MESSAGE(memcmp(_test_nth_frag, frag->data,
+                               sizeof(_test_nth_frag)) == 0,
+                        "fragment was modified");
+    gnrc_pktbuf_release(frag);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_vrb_fast_forward__nth_frag__duplicate(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    gnrc_pktsnip_t *frag;
+    uint16_t exp_current_size;
+
+    TEST_ASSERT_NOT_NULL(
+            (vrbe = gnrc_sixlowpan_frag_vrb_add(&_vrbe_base, _mock_netif,
+                                                _rem_l2, sizeof(_rem_l2)))
+        );
+    vrbe->super.arrival = xtimer_now_usec();
+    netdev_ieee802154_t *netdev_ieee802154 = container_of(_mock_netif->dev,
+                                                          netdev_ieee802154_t,
+                                                          netdev);
+    netdev_test_t *netdev_test = container_of(netdev_ieee802154, netdev_test_t,
+                                              netdev);
+    netdev_test_set_send_cb(netdev_test,
+                            _mock_netdev_send);
+    TEST_ASSERT_NOT_NULL(
+            (frag = _create_recv_frag(_test_nth_frag, sizeof(_test_nth_frag)))
+        );
+    TEST_ASSERT(gnrc_sixlowpan_frag_vrb_fast_forward(frag));
+    TEST_ASSERT(_wait_for_packet(sizeof(_test_nth_frag)));
+    exp_current_size = vrbe->super.current_size;
+
+    /* generate and receive duplicate */
+    TEST_ASSERT_NOT_NULL(
+            (frag = _create_recv_frag(_test_nth_frag, sizeof(_test_nth_frag)))
+        );
+    TEST_ASSERT(gnrc_sixlowpan_frag_vrb_fast_forward(frag));
+    _target_buf_len = 0;
+    /* should time out */
+    TEST_ASSERT_EQUAL_INT(0, _wait_for_packet(sizeof(_test_nth_frag)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    /* VRB entry should not have been removed */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_get(_vrbe_base.src,
+                                                     _vrbe_base.src_len,
+                                                     _vrbe_base.tag));
+    TEST_ASSERT_EQUAL_INT(exp_current_size, vrbe->super.current_size);
+}
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST */
+
 static void test_sixlo_send(void)
 {
     gnrc_pktsnip_t *pkt;
@@ -1504,6 +1642,12 @@ static Test *tests_gnrc_sixlowpan_frag_minfwd_integration(void)
         new_TestFixture(test_sixlo_recv__nth_frag__no_vrbe),
         new_TestFixture(test_sixlo_recv__nth_frag__duplicate),
         new_TestFixture(test_sixlo_recv__nth_frag__overlap),
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_VRB_FAST)
+        new_TestFixture(test_vrb_fast_forward__nth_frag),
+        new_TestFixture(test_vrb_fast_forward__nth_frag__datagram_complete),
+        new_TestFixture(test_vrb_fast_forward__nth_frag__no_vrbe),
+        new_TestFixture(test_vrb_fast_forward__nth_frag__duplicate),
+#endif
         new_TestFixture(test_sixlo_send),
     };
 
@@ -0,0 +1 @@
+../gnrc_sixlowpan_frag_minfwd/mockup_netif.c
\ No newline at end of file
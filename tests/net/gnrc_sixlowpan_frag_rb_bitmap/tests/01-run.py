@@ -0,0 +1 @@
+../../gnrc_sixlowpan_frag/tests/01-run.py
\ No newline at end of file
@@ -0,0 +1 @@
+../gnrc_sixlowpan_frag/main.c
\ No newline at end of file
@@ -0,0 +1 @@
+../gnrc_sixlowpan/main.c
\ No newline at end of file
@@ -0,0 +1,362 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Connection rate and concurrency benchmark for event driven
+ *              GNRC TCP socks
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "event.h"
+#include "net/af.h"
+#include "net/sock/async/event.h"
+#include "net/sock/tcp.h"
+#include "net/sock/util.h"
+#include "shell.h"
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE (8)
+#define BUFFER_SIZE     (512)
+#define RECV_TIMEOUT_MS (5000U)
+#define RETRY_DELAY_MS  (1U)
+
+/* Server: a single thread serves all connections from its event queue */
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _server_evq;
+static sock_tcp_queue_t _server_queue;
+static sock_tcp_t _server_socks[CONNS];
+static size_t _server_bytes;
+
+/* Data of a connection that was read but not yet written back */
+typedef struct {
+    size_t echoed;
+    size_t len;
+    size_t pos;
+    uint8_t buf[BUFFER_SIZE];
+} _server_conn_t;
+
+static _server_conn_t _server_conns[CONNS];
+
+/* Blocking server for comparison: each thread listens for one connection at a time */
+static char _blocking_stacks[SERVER_THREADS][THREAD_STACKSIZE_DEFAULT];
+static sock_tcp_queue_t _blocking_queues[SERVER_THREADS];
+static sock_tcp_t _blocking_socks[SERVER_THREADS];
+static size_t _blocking_bytes;
+static uint8_t _blocking_bufs[SERVER_THREADS][BUFFER_SIZE];
+
+/* Client: each thread runs connections one after another */
+typedef struct {
+    sock_tcp_ep_t remote;
+    unsigned count;
+    unsigned done_count;
+    size_t bytes;
+    mutex_t done;
+    int res;
+    uint8_t buf[BUFFER_SIZE];
+} _client_t;
+
+static char _client_stacks[CONNS][THREAD_STACKSIZE_DEFAULT];
+static _client_t _clients[CONNS];
+static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
+
+static int _write_all(sock_tcp_t *sock, const uint8_t *buf, size_t len)
+{
+    for (size_t sent = 0; sent < len;) {
+        ssize_t ret = sock_tcp_write(sock, &buf[sent], len - sent);
+
+        if (ret < 0) {
+            return ret;
+        }
+        sent += ret;
+    }
+    return 0;
+}
+
+/* Writes back what is left of the last read, the event handler never blocks */
+static int _server_flush(sock_tcp_t *sock, _server_conn_t *conn)
+{
+    while (conn->pos < conn->len) {
+        ssize_t ret = sock_tcp_write(sock, &conn->buf[conn->pos], conn->len - conn->pos);
+
+        if (ret < 0) {
+            return ret;
+        }
+        conn->pos += ret;
+    }
+    return 0;
+}
+
+static void _server_conn_handler(sock_tcp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    _server_conn_t *conn = arg;
+
+    if (flags & (SOCK_ASYNC_MSG_RECV | SOCK_ASYNC_MSG_SENT)) {
+        ssize_t res;
+
+        /* Only read more once the last read was written back. On -EAGAIN,
+         * SOCK_ASYNC_MSG_SENT or SOCK_ASYNC_MSG_RECV calls the handler again */
+        while (((res = _server_flush(sock, conn)) == 0) &&
+               ((res = sock_tcp_read(sock, conn->buf, sizeof(conn->buf), 0)) > 0)) {
+            conn->len = res;
+            conn->pos = 0;
+            conn->echoed += res;
+        }
+        if (res != -EAGAIN) {
+            flags |= SOCK_ASYNC_CONN_FIN;
+        }
+    }
+    /* The server closes first, so TIME_WAIT is handled by the TCP eventloop */
+    if ((flags & SOCK_ASYNC_CONN_FIN) ||
+        ((conn->echoed >= _server_bytes) && (conn->pos == conn->len))) {
+        sock_tcp_disconnect(sock);
+    }
+}
+
+static void _server_queue_handler(sock_tcp_queue_t *queue, sock_async_flags_t flags,
+                                  void *arg)
+{
+    sock_tcp_t *sock;
+
+    (void)arg;
+    if (!(flags & SOCK_ASYNC_CONN_RECV)) {
+        return;
+    }
+    while (sock_tcp_accept(queue, &sock, 0) == 0) {
+        _server_conn_t *conn = &_server_conns[sock - _server_socks];
+
+        conn->echoed = 0;
+        conn->len = 0;
+        conn->pos = 0;
+        sock_tcp_event_init(sock, &_server_evq, _server_conn_handler, conn);
+        /* Data may have arrived before the handler was set */
+        _server_conn_handler(sock, SOCK_ASYNC_MSG_RECV, conn);
+    }
+}
+
+static void *_server_thread(void *arg)
+{
+    (void)arg;
+    event_queue_init(&_server_evq);
+    event_loop(&_server_evq);
+    return NULL;
+}
+
+static void *_blocking_thread(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+    uint8_t *buf = _blocking_bufs[idx];
+    sock_tcp_t *sock;
+
+    while (sock_tcp_accept(&_blocking_queues[idx], &sock, SOCK_NO_TIMEOUT) == 0) {
+        for (size_t echoed = 0; echoed < _blocking_bytes;) {
+            ssize_t res = sock_tcp_read(sock, buf, BUFFER_SIZE, RECV_TIMEOUT_MS);
+
+            if ((res <= 0) || (_write_all(sock, buf, res) < 0)) {
+                break;
+            }
+            echoed += res;
+        }
+        sock_tcp_disconnect(sock);
+    }
+    return NULL;
+}
+
+static int _blocking_server_cmd(char **argv)
+{
+    sock_tcp_ep_t local = SOCK_IPV6_EP_ANY;
+    int res;
+
+    if (_blocking_bytes > 0) {
+        printf("%s: already running\n", argv[0]);
+        return 1;
+    }
+    local.port = atoi(argv[1]);
+    _blocking_bytes = atol(argv[2]);
+
+    for (unsigned i = 0; i < SERVER_THREADS; i++) {
+        /* A queue per thread, a blocking accept only waits for the TCBs that
+         * were listening when it was called */
+        res = sock_tcp_listen(&_blocking_queues[i], &local, &_blocking_socks[i], 1, 0);
+        if (res < 0) {
+            printf("%s: listen failed (%d)\n", argv[0], res);
+            return 1;
+        }
+        thread_create(_blocking_stacks[i], sizeof(_blocking_stacks[i]),
+                      THREAD_PRIORITY_MAIN - 1, 0, _blocking_thread, (void *)(uintptr_t)i,
+                      "tcp_server");
+    }
+    printf("%s: listening with %u threads\n", argv[0], SERVER_THREADS);
+    return 0;
+}
+
+static int _server_cmd(int argc, char **argv)
+{
+    sock_tcp_ep_t local = SOCK_IPV6_EP_ANY;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <port> <bytes> [blocking]\n", argv[0]);
+        return 1;
+    }
+    if ((argc > 3) && (strcmp(argv[3], "blocking") == 0)) {
+        return _blocking_server_cmd(argv);
+    }
+    if (_server_bytes > 0) {
+        printf("%s: already running\n", argv[0]);
+        return 1;
+    }
+    local.port = atoi(argv[1]);
+    _server_bytes = atol(argv[2]);
+
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  _server_thread, NULL, "tcp_server");
+    res = sock_tcp_listen(&_server_queue, &local, _server_socks, CONNS, 0);
+    if (res < 0) {
+        printf("%s: listen failed (%d)\n", argv[0], res);
+        return 1;
+    }
+    sock_tcp_queue_event_init(&_server_queue, &_server_evq, _server_queue_handler, NULL);
+    printf("%s: listening with %u connections\n", argv[0], CONNS);
+    return 0;
+}
+
+/* Echoes client->bytes in chunks and waits for the server to close the connection */
+static int _client_conn(_client_t *client)
+{
+    sock_tcp_t sock;
+    size_t done = 0;
+    ssize_t ret;
+    int res;
+
+    /* All server TCBs may be in TIME_WAIT, retry until one is listening again */
+    while ((res = sock_tcp_connect(&sock, &client->remote, 0, 0)) == -ECONNREFUSED) {
+        ztimer_sleep(ZTIMER_MSEC, RETRY_DELAY_MS);
+    }
+    if (res < 0) {
+        return res;
+    }
+    while ((res == 0) && (done < client->bytes)) {
+        size_t len = client->bytes - done;
+        size_t pos = 0;
+
+        len = (len < sizeof(client->buf)) ? len : sizeof(client->buf);
+        while ((res == 0) && (pos < len)) {
+            ret = sock_tcp_write(&sock, &client->buf[pos], len - pos);
+            res = (ret < 0) ? ret : 0;
+            pos += (ret > 0) ? ret : 0;
+        }
+        for (pos = 0; (res == 0) && (pos < len); pos += ret) {
+            ret = sock_tcp_read(&sock, &client->buf[pos], len - pos, RECV_TIMEOUT_MS);
+            res = (ret > 0) ? 0 : ((ret < 0) ? ret : -ECONNRESET);
+        }
+        done += len;
+    }
+    if (res == 0) {
+        ret = sock_tcp_read(&sock, client->buf, sizeof(client->buf), RECV_TIMEOUT_MS);
+        res = (ret == 0) ? 0 : ((ret < 0) ? ret : -EBADMSG);
+    }
+    sock_tcp_disconnect(&sock);
+    return res;
+}
+
+static void *_client_thread(void *arg)
+{
+    _client_t *client = arg;
+
+    client->res = 0;
+    for (client->done_count = 0; client->done_count < client->count; client->done_count++) {
+        client->res = _client_conn(client);
+        if (client->res < 0) {
+            break;
+        }
+    }
+    mutex_unlock(&client->done);
+    return NULL;
+}
+
+static int _client_cmd(int argc, char **argv)
+{
+    sock_tcp_ep_t remote;
+    unsigned threads, count;
+    uint32_t start, diff;
+    uint64_t conns = 0, bytes;
+    int res = 0;
+
+    if (argc < 5) {
+        printf("usage: %s <[addr%%netif]:port> <threads> <count> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (sock_tcp_str2ep(&remote, argv[1]) < 0) {
+        printf("%s: invalid endpoint\n", argv[0]);
+        return 1;
+    }
+    threads = atoi(argv[2]);
+    count = atoi(argv[3]);
+    if ((threads == 0) || (threads > CONNS)) {
+        printf("%s: threads must be 1..%u\n", argv[0], CONNS);
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_MSEC);
+    for (unsigned i = 0; i < threads; i++) {
+        _clients[i].remote = remote;
+        _clients[i].count = count;
+        _clients[i].bytes = atol(argv[4]);
+        mutex_init(&_clients[i].done);
+        mutex_lock(&_clients[i].done);
+        thread_create(_client_stacks[i], sizeof(_client_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      0, _client_thread, &_clients[i], "tcp_client");
+    }
+    for (unsigned i = 0; i < threads; i++) {
+        mutex_lock(&_clients[i].done);
+        conns += _clients[i].done_count;
+        if (_clients[i].res < 0) {
+            printf("%s: thread %u failed (%d)\n", argv[0], i, _clients[i].res);
+            res = 1;
+        }
+    }
+    diff = ztimer_now(ZTIMER_MSEC) - start;
+    diff = (diff > 0) ? diff : 1;
+
+    bytes = conns * _clients[0].bytes;
+    printf("%s: %" PRIu32 " connections in %" PRIu32 " ms (%" PRIu32 " conn/s, %"
+           PRIu32 " byte/s)\n", argv[0], (uint32_t)conns, diff,
+           (uint32_t)((conns * MS_PER_SEC) / diff), (uint32_t)((bytes * MS_PER_SEC) / diff));
+    return res;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "tcp_server", "echo <bytes> on each connection to <port>, then close it, from one "
+                    "event queue or [blocking] threads", _server_cmd },
+    { "tcp_client", "run <count> connections on each of <threads>", _client_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* Set up message queue */
+    msg_init_queue(main_msg_queue, MAIN_QUEUE_SIZE);
+
+    puts("RIOT GNRC sock TCP async benchmark application");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
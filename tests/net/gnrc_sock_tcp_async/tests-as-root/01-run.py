@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import sys
+
+from testrunner import run
+from testrunner.spawn import setup_child, teardown_child
+
+# Second node, connected to the first one via the bridge created by tapsetup
+CLIENT_TAP = os.environ.get('CLIENT_TAP', 'tap1')
+PORT = 4242
+BYTES = int(os.environ.get('BYTES', 1024))
+COUNT = int(os.environ.get('COUNT', 100))
+THREADS = int(os.environ.get('THREADS', 4))
+TIMEOUT = 120
+
+
+def get_ll_addr(child):
+    child.sendline('ifconfig')
+    child.expect(r'(fe80:[0-9a-f:]+)\s')
+    return child.match.group(1)
+
+
+def get_iface(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    return child.match.group(1)
+
+
+def run_client(client, remote, threads, count, server='event'):
+    client.sendline('tcp_client {} {} {} {}'.format(remote, threads, count, BYTES))
+    client.expect(r'tcp_client: {} connections in (\d+) ms \((\d+) conn/s, (\d+) byte/s\)'
+                  .format(threads * count), timeout=TIMEOUT)
+    conn_rate, throughput = client.match.group(2), client.match.group(3)
+    client.expect_exact('>')
+    print('\n{} server, {} thread(s): {} conn/s, {} byte/s'
+          .format(server, threads, conn_rate, throughput))
+
+
+def testfunc(server):
+    env = os.environ.copy()
+    env['PORT'] = CLIENT_TAP
+    env['TAP'] = CLIENT_TAP
+    client = setup_child(TIMEOUT, env=env)
+    try:
+        addr = get_ll_addr(server)
+        iface = get_iface(client)
+        remote = '[{}%{}]:{}'.format(addr, iface, PORT)
+        blocking_remote = '[{}%{}]:{}'.format(addr, iface, PORT + 1)
+
+        server.sendline('tcp_server {} {}'.format(PORT, BYTES))
+        server.expect(r'tcp_server: listening with \d+ connections')
+        server.sendline('tcp_server {} {} blocking'.format(PORT + 1, BYTES))
+        server.expect(r'tcp_server: listening with \d+ threads')
+
+        # Resolve link layer addresses before measuring
+        run_client(client, remote, 1, 1)
+
+        # Connection rate of a single client, then throughput of concurrent clients,
+        # served from one event queue and by one blocking thread per connection
+        for server_type, server_remote in (('event', remote), ('blocking', blocking_remote)):
+            run_client(client, server_remote, 1, COUNT, server_type)
+            run_client(client, server_remote, THREADS, COUNT, server_type)
+    finally:
+        teardown_child(client)
+
+
+if __name__ == '__main__':
+    sys.exit(run(testfunc, timeout=TIMEOUT))
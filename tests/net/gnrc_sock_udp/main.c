@@ -19,7 +19,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "msg.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -682,6 +685,81 @@ static void test_sock_udp_sendv__socketed(void)
     expect(_check_net());
 }
 
+#ifdef MODULE_SOCK_UDP_ZERO_COPY
+static void test_sock_udp_send_buf__alloc(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    void *ctx = NULL;
+    char *data;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    /* only part of the buffer is sent */
+    data = sock_udp_buf_alloc(sizeof("ABCDEFGH"), &ctx);
+    expect(data != NULL);
+    expect(ctx != NULL);
+    memcpy(data, "ABCD", sizeof("ABCD"));
+    expect(sizeof("ABCD") == sock_udp_send_buf_aux(&_sock, ctx, sizeof("ABCD"),
+                                                   &remote, NULL));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    /* buffer is consumed on error */
+    data = sock_udp_buf_alloc(sizeof("ABCD"), &ctx);
+    expect(data != NULL);
+    expect(-ENOTCONN == sock_udp_send_buf_aux(&_sock, ctx, sizeof("ABCD"),
+                                              NULL, NULL));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_buf__claimed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    void *data = NULL, *ctx = NULL;
+    char *buf;
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&dst_addr, &src_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD") - 1,
+                          _TEST_NETIF));
+    expect(sizeof("ABCD") - 1 == sock_udp_recv_buf(&_sock, &data, &ctx,
+                                                   SOCK_NO_TIMEOUT, NULL));
+    /* the send checks received the packet as well, so it is shared */
+    msg_t msg;
+    expect(msg_try_receive(&msg) > 0);
+    gnrc_pktbuf_release(msg.content.ptr);
+    /* reply is built behind the request in the same buffer */
+    buf = sock_udp_buf_claim(&ctx, sizeof("ABCDEFGH"));
+    expect(buf != NULL);
+    expect(memcmp(buf, "ABCD", sizeof("ABCD") - 1) == 0);
+    memcpy(&buf[sizeof("ABCD") - 1], "EFGH", sizeof("EFGH"));
+    expect(sizeof("ABCDEFGH") == sock_udp_send_buf_aux(&_sock, ctx,
+                                                       sizeof("ABCDEFGH"),
+                                                       NULL, NULL));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCDEFGH", sizeof("ABCDEFGH"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+#endif
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -863,6 +941,10 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_sendv__socketed());
+#ifdef MODULE_SOCK_UDP_ZERO_COPY
+    CALL(test_sock_udp_send_buf__alloc());
+    CALL(test_sock_udp_send_buf__claimed());
+#endif
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
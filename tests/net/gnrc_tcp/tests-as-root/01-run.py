@@ -234,11 +234,13 @@ def test_gnrc_tcp_recv_behavior_on_closed_connection(child):
             host_srv.close()
 
             # Read half amount of data with huge timeout.
-            # Expectency: direct with verified test data. Timeout doesn't matter
+            # Expectency: direct with verified test data. Timeout doesn't matter.
+            # With gnrc_tcp_recv_buf, the unread half stays in the packet buffer
             half_data_len = int(len(data) / 2)
             huge_timeout_ms = 1000000000
             no_timeout_ms = 0
-            riot_cli.receive(timeout_ms=huge_timeout_ms, sent_payload=data[:half_data_len])
+            riot_cli.receive(timeout_ms=huge_timeout_ms, sent_payload=data[:half_data_len],
+                             pktbuf_empty=False)
 
             # Read half amount of data without timeout.
             # Expectency: direct return with verified test data
@@ -156,7 +156,7 @@ class _RiotTcpNode:
         # Verify that packet buffer is empty
         self._verify_pktbuf_empty()
 
-    def receive(self, timeout_ms, sent_payload):
+    def receive(self, timeout_ms, sent_payload, pktbuf_empty=True):
         total_bytes = len(sent_payload)
 
         # Verify that internal Buffer can hold the test data
@@ -169,8 +169,9 @@ class _RiotTcpNode:
         # Readout internal buffer content of RIOT Note
         assert self._read_data_from_internal_buffer(total_bytes) == sent_payload
 
-        # Verify that packet buffer is empty
-        self._verify_pktbuf_empty()
+        # Verify that packet buffer is empty, unless received data is left unread
+        if pktbuf_empty:
+            self._verify_pktbuf_empty()
 
     def close(self):
         self.child.sendline('gnrc_tcp_close')
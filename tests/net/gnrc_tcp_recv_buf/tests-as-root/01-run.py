@@ -0,0 +1 @@
+../../gnrc_tcp/tests-as-root/01-run.py
\ No newline at end of file
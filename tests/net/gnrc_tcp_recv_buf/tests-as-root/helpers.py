@@ -0,0 +1 @@
+../../gnrc_tcp/tests-as-root/helpers.py
\ No newline at end of file
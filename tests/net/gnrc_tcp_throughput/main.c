@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Bulk transfer throughput test for GNRC TCP
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "msg.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE (8)
+#define BUFFER_SIZE     (2048)
+#define RECV_TIMEOUT_MS (5000U)
+
+static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t tcb;
+static gnrc_tcp_tcb_queue_t queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t buffer[BUFFER_SIZE];
+
+/* Byte at stream offset @p pos, the prime modulus detects reordered chunks */
+static inline uint8_t _pattern(size_t pos)
+{
+    return pos % 251;
+}
+
+/* Checks @p len received bytes starting at stream offset @p pos */
+static bool _verify(const uint8_t *data, size_t len, size_t pos)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] != _pattern(pos + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if IS_USED(MODULE_GNRC_TCP_RECV_BUF)
+/* Receives all data that is available at once, without copying it */
+static ssize_t _recv(gnrc_tcp_tcb_t *conn, size_t pos)
+{
+    void *data, *ctx = NULL;
+    ssize_t ret, rcvd = 0;
+    bool valid = true;
+
+    while ((ret = gnrc_tcp_recv_buf(conn, &data, &ctx, RECV_TIMEOUT_MS)) > 0) {
+        valid = valid && _verify(data, ret, pos + rcvd);
+        rcvd += ret;
+    }
+    if (!valid) {
+        return -EBADMSG;
+    }
+    return (rcvd > 0) ? rcvd : ret;
+}
+#else
+static ssize_t _recv(gnrc_tcp_tcb_t *conn, size_t pos)
+{
+    ssize_t ret = gnrc_tcp_recv(conn, buffer, sizeof(buffer), RECV_TIMEOUT_MS);
+
+    if ((ret > 0) && !_verify(buffer, ret, pos)) {
+        return -EBADMSG;
+    }
+    return ret;
+}
+#endif
+
+static int _client_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    size_t total, sent = 0;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("%s: invalid endpoint\n", argv[0]);
+        return 1;
+    }
+    total = atol(argv[2]);
+
+    gnrc_tcp_tcb_init(&tcb);
+    res = gnrc_tcp_open(&tcb, &remote, 0);
+    if (res < 0) {
+        printf("%s: open failed (%d)\n", argv[0], res);
+        return 1;
+    }
+
+    while (sent < total) {
+        size_t offset = sent % BUFFER_SIZE;
+        size_t len = BUFFER_SIZE - offset;
+        ssize_t ret;
+
+        len = (len < total - sent) ? len : total - sent;
+        for (size_t i = 0; i < len; i++) {
+            buffer[offset + i] = _pattern(sent + i);
+        }
+        ret = gnrc_tcp_send(&tcb, &buffer[offset], len, 0);
+        if (ret < 0) {
+            printf("%s: send failed after %" PRIuSIZE " bytes (%d)\n", argv[0],
+                   sent, (int)ret);
+            gnrc_tcp_abort(&tcb);
+            return 1;
+        }
+        sent += ret;
+    }
+    gnrc_tcp_close(&tcb);
+
+    printf("%s: sent %" PRIuSIZE " bytes (%u segments in flight)\n", argv[0],
+           sent, CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE);
+    return 0;
+}
+
+static int _server_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *conn = NULL;
+    size_t total, rcvd = 0;
+    uint32_t start, diff;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, atoi(argv[1]), 0);
+    total = atol(argv[2]);
+
+    gnrc_tcp_tcb_init(&tcb);
+    res = gnrc_tcp_listen(&queue, &tcb, 1, &local);
+    if (res < 0) {
+        printf("%s: listen failed (%d)\n", argv[0], res);
+        return 1;
+    }
+    printf("%s: listening\n", argv[0]);
+
+    res = gnrc_tcp_accept(&queue, &conn, GNRC_TCP_NO_TIMEOUT);
+    if (res < 0) {
+        printf("%s: accept failed (%d)\n", argv[0], res);
+        gnrc_tcp_stop_listen(&queue);
+        return 1;
+    }
+
+    /* The peer starts sending as soon as the connection is established */
+    start = ztimer_now(ZTIMER_MSEC);
+    while (rcvd < total) {
+        ssize_t ret = _recv(conn, rcvd);
+
+        if (ret == -EBADMSG) {
+            printf("%s: corrupted data after offset %" PRIuSIZE "\n", argv[0], rcvd);
+            gnrc_tcp_abort(conn);
+            gnrc_tcp_stop_listen(&queue);
+            return 1;
+        }
+        if (ret <= 0) {
+            printf("%s: recv failed after %" PRIuSIZE " bytes (%d)\n", argv[0],
+                   rcvd, (int)ret);
+            break;
+        }
+        rcvd += ret;
+    }
+    diff = ztimer_now(ZTIMER_MSEC) - start;
+    diff = (diff > 0) ? diff : 1;
+    gnrc_tcp_close(conn);
+    gnrc_tcp_stop_listen(&queue);
+
+    printf("%s: received %" PRIuSIZE " bytes in %" PRIu32 " ms (%" PRIu32 " byte/s)\n",
+           argv[0], rcvd, diff, (uint32_t)(((uint64_t)rcvd * MS_PER_SEC) / diff));
+    return (rcvd == total) ? 0 : 1;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "tcp_client", "connect to a server and send <bytes>", _client_cmd },
+    { "tcp_server", "accept a connection and receive <bytes>", _server_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    /* Set up message queue */
+    msg_init_queue(main_msg_queue, MAIN_QUEUE_SIZE);
+
+    puts("RIOT GNRC_TCP throughput test application");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import sys
+
+from testrunner import run
+from testrunner.spawn import setup_child, teardown_child
+
+# Second node, connected to the first one via the bridge created by tapsetup
+CLIENT_TAP = os.environ.get('CLIENT_TAP', 'tap1')
+PORT = 4242
+BYTES = int(os.environ.get('BYTES', 256 * 1024))
+TIMEOUT = 60
+
+
+def get_ll_addr(child):
+    child.sendline('ifconfig')
+    child.expect(r'(fe80:[0-9a-f:]+)\s')
+    return child.match.group(1)
+
+
+def get_iface(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    return child.match.group(1)
+
+
+def testfunc(server):
+    env = os.environ.copy()
+    env['PORT'] = CLIENT_TAP
+    env['TAP'] = CLIENT_TAP
+    client = setup_child(TIMEOUT, env=env)
+    try:
+        addr = get_ll_addr(server)
+        iface = get_iface(client)
+
+        server.sendline('tcp_server {} {}'.format(PORT, BYTES))
+        server.expect_exact('tcp_server: listening')
+
+        client.sendline('tcp_client [{}%{}]:{} {}'.format(addr, iface, PORT, BYTES))
+        server.expect(r'tcp_server: received {} bytes in (\d+) ms \((\d+) byte/s\)'
+                      .format(BYTES), timeout=TIMEOUT)
+        throughput = server.match.group(2)
+        client.expect(r'tcp_client: sent {} bytes \((\d+) segments in flight\)'
+                      .format(BYTES), timeout=TIMEOUT)
+        print('\nthroughput: {} byte/s with {} segments in flight'.format(
+            throughput, client.match.group(1)))
+    finally:
+        teardown_child(client)
+
+
+if __name__ == '__main__':
+    sys.exit(run(testfunc, timeout=TIMEOUT))
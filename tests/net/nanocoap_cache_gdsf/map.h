@@ -0,0 +1 @@
+../../unittests/map.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../unittests/main.c
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for receive buffers lent by netdev_tap
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "netdev_tap.h"
+#include "netdev_tap_params.h"
+#include "shell.h"
+#include "thread.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static netdev_tap_t _tap;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+/* the tap driver, with recv_lend() wrapped to count the lent buffers */
+static const netdev_driver_t *_tap_driver;
+static netdev_driver_t _driver;
+static void (*_tap_release)(netdev_rx_buf_t *buf);
+static unsigned _lent;
+static unsigned _returned;
+
+static void _release(netdev_rx_buf_t *buf)
+{
+    _returned++;
+    _tap_release(buf);
+}
+
+static int _recv_lend(netdev_t *dev, netdev_rx_buf_t **buf, void *info)
+{
+    int res = _tap_driver->recv_lend(dev, buf, info);
+
+    if (res > 0) {
+        _lent++;
+        _tap_release = (*buf)->release;
+        (*buf)->release = _release;
+    }
+    return res;
+}
+
+static int _rx_lend_cmd(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    printf("rx_lend: lent %u, returned %u\n", _lent, _returned);
+    return 0;
+}
+
+SHELL_COMMAND(rx_lend, "Print number of lent and returned receive buffers", _rx_lend_cmd);
+
+int main(void)
+{
+    netdev_tap_setup(&_tap, &netdev_tap_params[0], 0);
+    _tap_driver = _tap.netdev.driver;
+    _driver = *_tap_driver;
+    _driver.recv_lend = _recv_lend;
+    _tap.netdev.driver = &_driver;
+    gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                               GNRC_NETIF_PRIO, "tap", &_tap.netdev);
+
+    /* the shell's ping needs a message queue */
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
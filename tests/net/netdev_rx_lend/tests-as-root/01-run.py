@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import os
+import re
+import sys
+
+from testrunner import run
+
+COUNT = 20
+# a minimal frame, a frame split over several snips and a full frame
+SIZES = (0, 100, 1400)
+
+
+def get_host_ll_addr():
+    # use the bridge if the tap device is part of one
+    tap = os.environ.get('TAP', 'tap0')
+    result = os.popen('bridge link show dev {}'.format(tap)).read()
+    bridge = re.search('master (.*) state', result)
+    iface = bridge.group(1).strip() if bridge else tap
+    result = os.popen('ip addr show dev {} scope link'.format(iface)).read()
+    return re.search('inet6 (.*)/64', result).group(1).strip()
+
+
+def rx_lend(child):
+    child.sendline('rx_lend')
+    child.expect(r'rx_lend: lent (\d+), returned (\d+)')
+    return int(child.match.group(1)), int(child.match.group(2))
+
+
+def pktbuf_empty(child):
+    child.sendline('pktbuf')
+    child.expect(r'packet buffer: first byte: (?P<first_byte>0x[0-9a-fA-F]+), '
+                 r'last byte: 0x[0-9a-fA-F]+ \(size: (?P<size>\d+)\)')
+    first_byte = child.match.group('first_byte')
+    size = child.match.group('size')
+    child.expect(r'~ unused: {} \(next: (\(nil\)|0), size: {}\) ~'.format(first_byte, size))
+
+
+def testfunc(child):
+    addr = get_host_ll_addr()
+
+    for size in SIZES:
+        lent, returned = rx_lend(child)
+        child.sendline('ping -c {} -i 10 -s {} {}'.format(COUNT, size, addr))
+        child.expect(r'{} packets transmitted, (\d+) packets received'.format(COUNT),
+                     timeout=30)
+        received = int(child.match.group(1))
+        assert received > 0
+        # replies were received in lent buffers, and all of them were returned
+        lent_now, returned_now = rx_lend(child)
+        assert lent_now - lent >= received
+        assert lent_now == returned_now
+        pktbuf_empty(child)
+        print('{} byte: {} of {} replies received in lent buffers'
+              .format(size, received, COUNT))
+
+    # back to back replies, which may exceed the buffers of the driver
+    child.sendline('ping -c {} -i 0 -s 1400 {}'.format(COUNT, addr))
+    child.expect(r'{} packets transmitted, \d+ packets received'.format(COUNT), timeout=30)
+    lent, returned = rx_lend(child)
+    assert lent == returned
+    pktbuf_empty(child)
+
+
+if __name__ == '__main__':
+    sys.exit(run(testfunc, timeout=10))
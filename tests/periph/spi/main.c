@@ -96,7 +96,7 @@ static void _sched_statistics_trigger(void)
 static uint32_t _sched_us(void)
 {
     _sched_statistics_trigger();
-    return sched_pidlist[thread_getpid()].runtime_us;
+    return schedstat_runtime_us(&sched_pidlist[thread_getpid()]);
 }
 
 static uint32_t _ztimer_diff_usec(uint32_t stop, uint32_t start)
@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the tickless idle power mode selection
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "periph/pm.h"
+#include "pm_layered/tickless.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+/* see PM_EXIT_LATENCY_US in the Makefile */
+#define SLEEP_US        (20000U)
+
+static ztimer_mock_t _mock;
+static pm_layered_tickless_clock_t _mock_clock = {
+    .clock = &_mock.super,
+    .us_per_tick = 1000,
+};
+static unsigned _failed;
+static unsigned _fired;
+
+static void _cb(void *arg)
+{
+    (void)arg;
+    _fired++;
+}
+
+static void _expect(unsigned mode, unsigned expected, const char *what)
+{
+    unsigned res = pm_layered_tickless_mode(mode);
+
+    printf("%s: mode %u\n", what, res);
+    if (res != expected) {
+        printf("FAILED: expected mode %u\n", expected);
+        _failed++;
+    }
+}
+
+int main(void)
+{
+    ztimer_t mock_far = { .callback = _cb };
+    ztimer_t mock_near = { .callback = _cb };
+    ztimer_t usec = { .callback = _cb };
+    pm_layered_tickless_stats_t stats;
+
+    puts("Test for the tickless idle power mode selection");
+
+    ztimer_mock_init(&_mock, 32);
+    pm_layered_tickless_add_clock(&_mock_clock);
+
+    _expect(0, 0, "no timer");
+
+    ztimer_set(&_mock.super, &mock_far, 10);
+    _expect(0, 0, "timer in 10 ms");
+
+    ztimer_set(&_mock.super, &mock_near, 1);
+    _expect(0, 1, "timer in 1 ms");
+    _expect(2, 2, "timer in 1 ms, modes 0 and 1 blocked");
+
+    ztimer_set(ZTIMER_USEC, &usec, 100);
+    _expect(0, 2, "timer in 100 us");
+    ztimer_remove(ZTIMER_USEC, &usec);
+
+    ztimer_mock_advance(&_mock, 1);
+    _expect(0, 0, "timer in 9 ms");
+
+    ztimer_mock_advance(&_mock, 9);
+    _expect(0, 0, "timers expired");
+
+    pm_layered_tickless_get_stats(&stats);
+    printf("demotions: %" PRIu32 "\n", stats.demotions);
+    if (stats.demotions != 2) {
+        puts("FAILED: expected 2 demotions");
+        _failed++;
+    }
+
+    /* sleep in the deepest mode until a real timer wakes the CPU up */
+    pm_layered_tickless_reset_stats();
+    pm_unblock(0);
+    pm_unblock(1);
+    ztimer_set(ZTIMER_USEC, &usec, SLEEP_US);
+    pm_set_lowest();
+
+    pm_layered_tickless_get_stats(&stats);
+    printf("mode 0 entries: %" PRIu32 " residency: %" PRIu64 " us\n",
+           stats.entries[0], stats.residency_us[0]);
+    if ((_fired != 3) || (stats.entries[0] != 1) ||
+        (stats.residency_us[0] < SLEEP_US / 2)) {
+        puts("FAILED: did not sleep in mode 0 until the timer fired");
+        _failed++;
+    }
+
+    if (_failed) {
+        puts("Test failed.");
+    }
+    else {
+        puts("Test successful.");
+    }
+
+    return 0;
+}
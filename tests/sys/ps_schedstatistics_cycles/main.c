@@ -0,0 +1 @@
+../ps_schedstatistics/main.c
\ No newline at end of file
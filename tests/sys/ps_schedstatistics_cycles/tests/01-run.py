@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+NB_THREADS = 5
+FIRST_THREAD_PID = 3
+# main sleeps for a second before starting the threads, the idle thread runs
+# during that time
+IDLE_MIN_USEC = 900000
+
+
+def _check_startup(child):
+    for i in range(NB_THREADS):
+        child.expect_exact('Creating thread #{}, next={}'
+                           .format(i, (i + 1) % NB_THREADS))
+
+
+def _expect_thread(child, pid, name):
+    child.expect(r'\t  {} \| {}\s+\|[^\n]*\| +(\d+) +\| +(\d+) +\| +(\d+) *\r?\n'
+                 .format(pid, name))
+    return [int(group) for group in child.match.groups()]
+
+
+def _check_ps(child):
+    child.sendline('ps')
+    child.expect(r'\| runtime  \| switches  \| runtime_usec \| max_usec')
+
+    _, _, idle_max_usec = _expect_thread(child, 1, 'idle')
+    assert idle_max_usec >= IDLE_MIN_USEC, \
+        'idle ran {} us at most'.format(idle_max_usec)
+
+    switches = {}
+    for pid in range(FIRST_THREAD_PID, FIRST_THREAD_PID + NB_THREADS):
+        switches[pid], _, _ = _expect_thread(child, pid, 'thread')
+
+    # at least the timer interrupt was served
+    child.expect(r'\t irq \| count      \| runtime  \| runtime_usec \| max_usec')
+    child.expect(r'\t +\d+ \| +[1-9]\d* \|')
+
+    # the threads only ran further since their line was printed, so each has
+    # at least as many runs in the histogram as it had switches then
+    child.expect_exact('Run lengths')
+    for pid, num in switches.items():
+        child.expect(r'\t  pid +{} \|((?: +\d+)+)\r?\n'.format(pid))
+        runs = sum(int(count) for count in child.match.group(1).split())
+        assert runs >= num, \
+            'pid {}: {} runs for {} switches'.format(pid, runs, num)
+    child.expect_exact('>')
+
+
+def testfunc(child):
+    _check_startup(child)
+    _check_ps(child)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
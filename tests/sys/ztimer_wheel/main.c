@@ -0,0 +1,287 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ztimer timer wheel
+ *
+ * The wheel is tested in its own application, so the unittests of ztimer
+ * keep testing the sorted list of timers.
+ *
+ * @}
+ */
+
+#include "container.h"
+#include "embUnit.h"
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+typedef struct {
+    ztimer_clock_t *clock;
+    uint32_t fired_at;
+    unsigned fired;
+    unsigned order;
+} _timer_arg_t;
+
+static ztimer_mock_t _mock;
+static ztimer_wheel_t _wheel;
+static unsigned _order;
+
+static void _cb(void *arg)
+{
+    _timer_arg_t *t = arg;
+
+    t->fired_at = ztimer_now(t->clock);
+    t->fired++;
+    t->order = _order++;
+}
+
+static void _setup(unsigned bits)
+{
+    ztimer_mock_init(&_mock, bits);
+    ztimer_wheel_init(&_mock.super, &_wheel);
+    _order = 0;
+}
+
+/* targets on every level and beyond the range of the wheel */
+static const uint32_t _targets[] = {
+    1, 15, 16, 17, 255, 256, 300, 4096, 70000, 0xffffff, 0x1000000,
+    0x1000005, 0x3456789,
+};
+
+#define TARGETS_NUMOF   ARRAY_SIZE(_targets)
+
+static void _test_targets(unsigned bits, uint32_t start)
+{
+    ztimer_clock_t *z = &_mock.super;
+    ztimer_t timers[TARGETS_NUMOF];
+    _timer_arg_t args[TARGETS_NUMOF];
+
+    _setup(bits);
+    ztimer_mock_jump(&_mock, start);
+
+    /* set in reverse order */
+    for (unsigned i = TARGETS_NUMOF; i-- > 0;) {
+        args[i] = (_timer_arg_t){ .clock = z };
+        timers[i] = (ztimer_t){ .callback = _cb, .arg = &args[i] };
+        ztimer_set(z, &timers[i], _targets[i]);
+        TEST_ASSERT(ztimer_is_set(z, &timers[i]));
+    }
+
+    for (unsigned i = 0; i < TARGETS_NUMOF; i++) {
+        uint32_t now = ztimer_now(z) - start;
+
+        /* nothing must trigger early */
+        ztimer_mock_advance(&_mock, _targets[i] - now - 1);
+        TEST_ASSERT_EQUAL_INT(0, args[i].fired);
+        TEST_ASSERT(ztimer_is_set(z, &timers[i]));
+
+        ztimer_mock_advance(&_mock, 1);
+        TEST_ASSERT_EQUAL_INT(1, args[i].fired);
+        TEST_ASSERT_EQUAL_INT(start + _targets[i], args[i].fired_at);
+        TEST_ASSERT_EQUAL_INT(i, args[i].order);
+        TEST_ASSERT(!ztimer_is_set(z, &timers[i]));
+    }
+
+    TEST_ASSERT(ztimer_wheel_is_empty(&_wheel));
+}
+
+/**
+ * @brief   Testing that timers on all levels trigger exactly on time
+ */
+static void test_ztimer_wheel_set(void)
+{
+    _test_targets(32, 0);
+}
+
+/**
+ * @brief   Testing the wheel with a time not aligned to any slot and wrapping
+ *          around
+ */
+static void test_ztimer_wheel_set_wrap(void)
+{
+    _test_targets(32, 0xfe123457);
+}
+
+/**
+ * @brief   Testing the wheel on a clock extended from 16 bits
+ */
+static void test_ztimer_wheel_set16(void)
+{
+    _test_targets(16, 0);
+}
+
+/**
+ * @brief   Testing removing timers from all places in the wheel
+ */
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_clock_t *z = &_mock.super;
+    ztimer_t timers[6];
+    _timer_arg_t args[6];
+
+    _setup(32);
+
+    /* 0-2 share a slot, 3 is alone in its slot, 4 and 5 expire together */
+    static const uint32_t targets[] = { 100, 100, 100, 5000, 7, 7 };
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        args[i] = (_timer_arg_t){ .clock = z };
+        timers[i] = (ztimer_t){ .callback = _cb, .arg = &args[i] };
+        ztimer_set(z, &timers[i], targets[i]);
+    }
+
+    /* middle, last and only timer of a slot */
+    TEST_ASSERT(ztimer_remove(z, &timers[1]));
+    TEST_ASSERT(ztimer_remove(z, &timers[2]));
+    TEST_ASSERT(ztimer_remove(z, &timers[3]));
+    TEST_ASSERT(!ztimer_remove(z, &timers[3]));
+    TEST_ASSERT(!ztimer_is_set(z, &timers[3]));
+
+    /* let 4 and 5 expire without handling them, then remove one */
+    _mock.now += 10;
+    ztimer_remove(z, &timers[5]);
+    TEST_ASSERT_EQUAL_INT(0, _mock.target);
+    ztimer_mock_fire(&_mock);
+    TEST_ASSERT_EQUAL_INT(1, args[4].fired);
+    TEST_ASSERT_EQUAL_INT(0, args[5].fired);
+
+    ztimer_mock_advance(&_mock, 10000);
+    TEST_ASSERT_EQUAL_INT(1, args[0].fired);
+    TEST_ASSERT_EQUAL_INT(100, args[0].fired_at);
+    TEST_ASSERT_EQUAL_INT(0, args[1].fired);
+    TEST_ASSERT_EQUAL_INT(0, args[2].fired);
+    TEST_ASSERT_EQUAL_INT(0, args[3].fired);
+    TEST_ASSERT(ztimer_wheel_is_empty(&_wheel));
+    TEST_ASSERT_EQUAL_INT(0, _mock.armed);
+}
+
+/**
+ * @brief   Testing that timers set to the same time trigger in the order they
+ *          were set, also after being re-set
+ */
+static void test_ztimer_wheel_order(void)
+{
+    ztimer_clock_t *z = &_mock.super;
+    ztimer_t timers[4];
+    _timer_arg_t args[4];
+
+    _setup(32);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        args[i] = (_timer_arg_t){ .clock = z };
+        timers[i] = (ztimer_t){ .callback = _cb, .arg = &args[i] };
+        ztimer_set(z, &timers[i], 1000);
+    }
+    /* moves timer 1 to the end */
+    ztimer_set(z, &timers[1], 1000);
+
+    ztimer_mock_advance(&_mock, 1000);
+    TEST_ASSERT_EQUAL_INT(0, args[0].order);
+    TEST_ASSERT_EQUAL_INT(3, args[1].order);
+    TEST_ASSERT_EQUAL_INT(1, args[2].order);
+    TEST_ASSERT_EQUAL_INT(2, args[3].order);
+}
+
+/**
+ * @brief   Testing the next timeout of a clock using a wheel
+ */
+static void test_ztimer_wheel_next_timeout(void)
+{
+    ztimer_clock_t *z = &_mock.super;
+    ztimer_t timer = { .callback = _cb };
+    _timer_arg_t arg = { .clock = z };
+    uint32_t ticks;
+
+    _setup(32);
+    timer.arg = &arg;
+
+    TEST_ASSERT(!ztimer_next_timeout(z, &ticks));
+
+    /* on level 0, the next timeout is the timer */
+    ztimer_set(z, &timer, 10);
+    TEST_ASSERT(ztimer_next_timeout(z, &ticks));
+    TEST_ASSERT_EQUAL_INT(10, ticks);
+
+    /* on a higher level, it is the time the timer is moved down */
+    ztimer_set(z, &timer, 1000);
+    TEST_ASSERT(ztimer_next_timeout(z, &ticks));
+    TEST_ASSERT(ticks > 0 && ticks <= 1000);
+    TEST_ASSERT_EQUAL_INT(ticks, _mock.target);
+
+    ztimer_remove(z, &timer);
+    TEST_ASSERT(!ztimer_next_timeout(z, &ticks));
+}
+
+/**
+ * @brief   Testing that a timer is only set on the clock it was set on
+ */
+static void test_ztimer_wheel_is_set_other_clock(void)
+{
+    ztimer_clock_t *z = &_mock.super;
+    ztimer_mock_t other_mock;
+    ztimer_wheel_t other_wheel;
+    ztimer_clock_t *other = &other_mock.super;
+    ztimer_t timers[4];
+    _timer_arg_t args[4];
+
+    _setup(32);
+    ztimer_mock_init(&other_mock, 32);
+    ztimer_wheel_init(other, &other_wheel);
+
+    /* 0 and 1 share a slot, so 0 is not at the head of it */
+    static const uint32_t targets[] = { 100, 100, 7, 5000 };
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        args[i] = (_timer_arg_t){ .clock = z };
+        timers[i] = (ztimer_t){ .callback = _cb, .arg = &args[i] };
+        ztimer_set(z, &timers[i], targets[i]);
+    }
+    /* let 2 expire without handling it */
+    _mock.now += 10;
+    ztimer_remove(z, &timers[3]);
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT(ztimer_is_set(z, &timers[i]));
+        TEST_ASSERT(!ztimer_is_set(other, &timers[i]));
+        TEST_ASSERT(!ztimer_remove(other, &timers[i]));
+    }
+
+    ztimer_mock_fire(&_mock);
+    TEST_ASSERT_EQUAL_INT(1, args[2].fired);
+    ztimer_mock_advance(&_mock, 100);
+    TEST_ASSERT_EQUAL_INT(1, args[0].fired);
+    TEST_ASSERT_EQUAL_INT(1, args[1].fired);
+    TEST_ASSERT(ztimer_wheel_is_empty(&_wheel));
+    TEST_ASSERT(ztimer_wheel_is_empty(&other_wheel));
+}
+
+static Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_set),
+        new_TestFixture(test_ztimer_wheel_set_wrap),
+        new_TestFixture(test_ztimer_wheel_set16),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_order),
+        new_TestFixture(test_ztimer_wheel_next_timeout),
+        new_TestFixture(test_ztimer_wheel_is_set_other_clock),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_ztimer_wheel_tests());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 RIOT contributors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+
+from testrunner import run_check_unittests
+
+if __name__ == "__main__":
+    sys.exit(run_check_unittests())
@@ -0,0 +1,239 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "tests-fib_trie.h"
+
+#include "net/fib.h"
+#include "xtimer.h"
+
+#define TEST_FIB_TABLE_SIZE     (20)
+#define TEST_ADDR_SIZE          (16)
+#define TEST_RANDOM_ROUNDS      (2000)
+
+static fib_entry_t _entries[TEST_FIB_TABLE_SIZE];
+static fib_trie_node_t _nodes[FIB_TRIE_NODES_NUMOF(TEST_FIB_TABLE_SIZE)];
+static fib_table_t test_fib_table = { .data.entries = _entries,
+                                      .table_type = FIB_TABLE_TYPE_SH,
+                                      .size = TEST_FIB_TABLE_SIZE,
+                                      .mtx_access = MUTEX_INIT,
+                                      .notify_rp_pos = 0,
+                                      .trie.nodes = _nodes };
+
+/* reference routes for the differential test */
+static struct {
+    uint8_t addr[TEST_ADDR_SIZE];
+    unsigned len;
+    bool used;
+} _routes[TEST_FIB_TABLE_SIZE];
+
+static uint32_t _prng_state;
+
+static uint32_t _prng(void)
+{
+    _prng_state ^= _prng_state << 13;
+    _prng_state ^= _prng_state >> 17;
+    _prng_state ^= _prng_state << 5;
+    return _prng_state;
+}
+
+static void set_up(void)
+{
+    fib_init(&test_fib_table);
+}
+
+static void tear_down(void)
+{
+    fib_deinit(&test_fib_table);
+}
+
+static void _add(const uint8_t *addr, unsigned prefix_len, uint8_t nh,
+                 uint32_t lifetime)
+{
+    uint8_t next_hop[TEST_ADDR_SIZE] = { 0xfe, 0x80 };
+
+    next_hop[TEST_ADDR_SIZE - 1] = nh;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, (uint8_t *)addr,
+                                           TEST_ADDR_SIZE,
+                                           prefix_len << FIB_FLAG_NET_PREFIX_SHIFT,
+                                           next_hop, TEST_ADDR_SIZE, 0,
+                                           lifetime));
+}
+
+/* returns the last byte of the next hop, or -1 if there is none */
+static int _lookup(const uint8_t *dst)
+{
+    uint8_t next_hop[TEST_ADDR_SIZE];
+    size_t next_hop_size = sizeof(next_hop);
+    kernel_pid_t iface_id;
+    uint32_t next_hop_flags;
+
+    int res = fib_get_next_hop(&test_fib_table, &iface_id, next_hop,
+                               &next_hop_size, &next_hop_flags,
+                               (uint8_t *)dst, TEST_ADDR_SIZE, 0);
+    if (res < 0) {
+        return -1;
+    }
+    return next_hop[TEST_ADDR_SIZE - 1];
+}
+
+static void test_fib_trie_longest_prefix_match(void)
+{
+    static const uint8_t def[TEST_ADDR_SIZE] = { 0 };
+    static const uint8_t p32[TEST_ADDR_SIZE] = { 0x20, 0x01, 0x0d, 0xb8 };
+    static const uint8_t p48[TEST_ADDR_SIZE] = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01 };
+    static const uint8_t p49[TEST_ADDR_SIZE] = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01,
+                                                 0x80 };
+    static const uint8_t host[TEST_ADDR_SIZE] = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01,
+                                                  0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 };
+    uint8_t dst[TEST_ADDR_SIZE] = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01,
+                                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02 };
+
+    TEST_ASSERT_EQUAL_INT(-1, _lookup(dst));
+    _add(p32, 32, 32, (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+    _add(host, 128, 128, (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+    _add(p48, 48, 48, (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+    _add(p49, 49, 49, (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+    _add(def, 0, 1, (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+
+    TEST_ASSERT_EQUAL_INT(48, _lookup(dst));
+    TEST_ASSERT_EQUAL_INT(128, _lookup(host));
+    dst[6] = 0x80;
+    TEST_ASSERT_EQUAL_INT(49, _lookup(dst));
+    dst[5] = 0x02;
+    TEST_ASSERT_EQUAL_INT(32, _lookup(dst));
+    dst[0] = 0xfd;
+    TEST_ASSERT_EQUAL_INT(1, _lookup(dst));
+
+    /* removing an entry in the middle of the trie keeps the others */
+    fib_remove_entry(&test_fib_table, (uint8_t *)p48, TEST_ADDR_SIZE);
+    memcpy(dst, host, sizeof(dst));
+    dst[15] = 0x02;
+    TEST_ASSERT_EQUAL_INT(32, _lookup(dst));
+    TEST_ASSERT_EQUAL_INT(128, _lookup(host));
+    fib_remove_entry(&test_fib_table, (uint8_t *)def, TEST_ADDR_SIZE);
+    dst[0] = 0xfd;
+    TEST_ASSERT_EQUAL_INT(-1, _lookup(dst));
+}
+
+static bool _prefix_equal(const uint8_t *a, const uint8_t *b, unsigned len)
+{
+    for (unsigned bit = 0; bit < len; bit++) {
+        uint8_t mask = 0x80 >> (bit & 7);
+        if ((a[bit >> 3] ^ b[bit >> 3]) & mask) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int _reference_lookup(const uint8_t *dst)
+{
+    int best = -1;
+    unsigned best_len = 0;
+
+    for (unsigned i = 0; i < TEST_FIB_TABLE_SIZE; i++) {
+        unsigned len = _routes[i].len;
+
+        if (!_routes[i].used) {
+            continue;
+        }
+        if (memcmp(_routes[i].addr, dst, TEST_ADDR_SIZE) == 0) {
+            return i;
+        }
+        if (_prefix_equal(_routes[i].addr, dst, len) &&
+            ((best < 0) || (len > best_len))) {
+            best = i;
+            best_len = len;
+        }
+    }
+    return best;
+}
+
+static void _random_addr(uint8_t *addr)
+{
+    /* keep the addresses close together to get deep tries */
+    memset(addr, 0, TEST_ADDR_SIZE);
+    addr[0] = 0x20;
+    addr[1] = _prng() & 0x3;
+    addr[2] = _prng() & 0xf0;
+    addr[TEST_ADDR_SIZE - 1] = (_prng() & 0x1) + 1;
+}
+
+static void test_fib_trie_differential(void)
+{
+    _prng_state = 0x2f6b3a91;
+    memset(_routes, 0, sizeof(_routes));
+
+    for (unsigned round = 0; round < TEST_RANDOM_ROUNDS; round++) {
+        unsigned i = _prng() % TEST_FIB_TABLE_SIZE;
+        uint8_t dst[TEST_ADDR_SIZE];
+
+        if (_routes[i].used) {
+            fib_remove_entry(&test_fib_table, _routes[i].addr, TEST_ADDR_SIZE);
+            _routes[i].used = false;
+        }
+        else {
+            static const unsigned lens[] = { 8, 12, 16, 17, 20, 24, 128 };
+            bool dup = false;
+
+            _random_addr(_routes[i].addr);
+            _routes[i].len = lens[_prng() % ARRAY_SIZE(lens)];
+            /* routes for the same prefix are ambiguous, skip those */
+            for (unsigned j = 0; j < TEST_FIB_TABLE_SIZE; j++) {
+                if (_routes[j].used &&
+                    (!memcmp(_routes[j].addr, _routes[i].addr, TEST_ADDR_SIZE) ||
+                     ((_routes[j].len == _routes[i].len) &&
+                      _prefix_equal(_routes[j].addr, _routes[i].addr,
+                                    _routes[i].len)))) {
+                    dup = true;
+                }
+            }
+            if (!dup) {
+                _add(_routes[i].addr, _routes[i].len, i, 100000);
+                _routes[i].used = true;
+            }
+        }
+
+        _random_addr(dst);
+        TEST_ASSERT_EQUAL_INT(_reference_lookup(dst), _lookup(dst));
+    }
+}
+
+static void test_fib_trie_lifetime_sweep(void)
+{
+    static const uint8_t p16[TEST_ADDR_SIZE] = { 0x20, 0x01 };
+    static const uint8_t p32[TEST_ADDR_SIZE] = { 0x20, 0x01, 0x0d, 0xb8 };
+    uint8_t dst[TEST_ADDR_SIZE] = { 0x20, 0x01, 0x0d, 0xb8, 0x01 };
+
+    _add(p16, 16, 16, 100000);
+    _add(p32, 32, 32, 10);
+    TEST_ASSERT_EQUAL_INT(32, _lookup(dst));
+    xtimer_msleep(20);
+    TEST_ASSERT_EQUAL_INT(16, _lookup(dst));
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+}
+
+Test *tests_fib_trie_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_fib_trie_longest_prefix_match),
+        new_TestFixture(test_fib_trie_differential),
+        new_TestFixture(test_fib_trie_lifetime_sweep),
+    };
+
+    EMB_UNIT_TESTCALLER(fib_trie_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&fib_trie_tests;
+}
+
+void tests_fib_trie(void)
+{
+    TESTS_RUN(tests_fib_trie_tests());
+}
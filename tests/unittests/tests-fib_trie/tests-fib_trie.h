@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: 2026 RIOT contributors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``fib_trie`` module
+ */
+
+#include "embUnit/embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_fib_trie(void);
+
+/**
+ * @brief   Generates tests for the FIB trie
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_fib_trie_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -389,6 +389,97 @@ static void test_gcoap__server_get_resource_list(void)
     TEST_ASSERT_EQUAL_STRING(resource_list_str, res);
 }
 
+static const coap_resource_t resources_dispatch[] = {
+    { .path = "/act/switch", .methods = (COAP_GET | COAP_POST) },
+    { .path = "/act/switch", .methods = (COAP_PUT) },
+    { .path = "/act/", .methods = (COAP_GET | COAP_MATCH_SUBTREE) },
+    { .path = "/sensor", .methods = (COAP_GET | COAP_MATCH_SUBTREE) },
+    { .path = "/sensor/temp", .methods = (COAP_GET | COAP_PUT) },
+    { .path = "/x/y/z", .methods = (COAP_DELETE) },
+};
+
+static gcoap_listener_t listener_dispatch = {
+    .resources     = resources_dispatch,
+    .resources_len = ARRAY_SIZE(resources_dispatch),
+};
+
+/* returns the index of the matching resource or the negative matcher result */
+static int _dispatch(unsigned method, const char *path, bool single_option)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    const coap_resource_t *resource;
+    coap_pkt_t pdu;
+    ssize_t len;
+    int res;
+
+    gcoap_req_init(&pdu, buf, sizeof(buf), method, single_option ? NULL : path);
+    if (single_option) {
+        coap_opt_add_opaque(&pdu, COAP_OPT_URI_PATH, path + 1, strlen(path + 1));
+    }
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT(len > 0);
+    TEST_ASSERT(coap_parse(&pdu, buf, len) >= 0);
+
+    res = listener_dispatch.request_matcher(&listener_dispatch, &resource, &pdu);
+    if (res != GCOAP_RESOURCE_FOUND) {
+        return -res;
+    }
+    return resource - resources_dispatch;
+}
+
+/*
+ * Test matching requests to resources, as done by the resource dispatch trie
+ * with module gcoap_dispatch_trie
+ */
+static void test_gcoap__server_dispatch(void)
+{
+    char long_path[CONFIG_NANOCOAP_URI_MAX + 1] = "/act/";
+
+    gcoap_register_listener(&listener_dispatch);
+
+    /* exact match, first resource with the method */
+    TEST_ASSERT_EQUAL_INT(0, _dispatch(COAP_METHOD_GET, "/act/switch", false));
+    TEST_ASSERT_EQUAL_INT(0, _dispatch(COAP_METHOD_POST, "/act/switch", false));
+    TEST_ASSERT_EQUAL_INT(1, _dispatch(COAP_METHOD_PUT, "/act/switch", false));
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_WRONG_METHOD,
+                          _dispatch(COAP_METHOD_DELETE, "/act/switch", false));
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_WRONG_METHOD,
+                          _dispatch(COAP_METHOD_GET, "/x/y/z", false));
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_NO_PATH,
+                          _dispatch(COAP_METHOD_DELETE, "/x/y", false));
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_NO_PATH,
+                          _dispatch(COAP_METHOD_DELETE, "/x/y/z/a", false));
+
+    /* subtree ending with a '/' */
+    TEST_ASSERT_EQUAL_INT(2, _dispatch(COAP_METHOD_GET, "/act/other", false));
+    TEST_ASSERT_EQUAL_INT(2, _dispatch(COAP_METHOD_GET, "/act/", false));
+    TEST_ASSERT_EQUAL_INT(2, _dispatch(COAP_METHOD_GET, "/act/switch/on", false));
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_NO_PATH,
+                          _dispatch(COAP_METHOD_GET, "/act", false));
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_WRONG_METHOD,
+                          _dispatch(COAP_METHOD_PUT, "/act/other", false));
+
+    /* subtree ending within a segment, before an exact resource */
+    TEST_ASSERT_EQUAL_INT(3, _dispatch(COAP_METHOD_GET, "/sensor", false));
+    TEST_ASSERT_EQUAL_INT(3, _dispatch(COAP_METHOD_GET, "/sensors/a", false));
+    TEST_ASSERT_EQUAL_INT(3, _dispatch(COAP_METHOD_GET, "/sensor/temp", false));
+    TEST_ASSERT_EQUAL_INT(4, _dispatch(COAP_METHOD_PUT, "/sensor/temp", false));
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_NO_PATH,
+                          _dispatch(COAP_METHOD_GET, "/sens", false));
+
+    /* no Uri-Path, a '/' within a segment and a path longer than
+     * CONFIG_NANOCOAP_URI_MAX are matched like the path string */
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_NO_PATH,
+                          _dispatch(COAP_METHOD_GET, "/", false));
+    TEST_ASSERT_EQUAL_INT(0, _dispatch(COAP_METHOD_GET, "/act/switch", true));
+    memset(&long_path[5], 'a', sizeof(long_path) - 6);
+    long_path[sizeof(long_path) - 1] = '\0';
+    TEST_ASSERT_EQUAL_INT(-GCOAP_RESOURCE_NO_PATH,
+                          _dispatch(COAP_METHOD_GET, long_path, false));
+    long_path[CONFIG_NANOCOAP_URI_MAX - 1] = '\0';
+    TEST_ASSERT_EQUAL_INT(2, _dispatch(COAP_METHOD_GET, long_path, false));
+}
+
 Test *tests_gcoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -402,7 +493,8 @@ Test *tests_gcoap_tests(void)
         new_TestFixture(test_gcoap__server_get_resp),
         new_TestFixture(test_gcoap__server_con_req),
         new_TestFixture(test_gcoap__server_con_resp),
-        new_TestFixture(test_gcoap__server_get_resource_list)
+        new_TestFixture(test_gcoap__server_get_resource_list),
+        new_TestFixture(test_gcoap__server_dispatch)
     };
 
     EMB_UNIT_TESTCALLER(gcoap_tests, NULL, NULL, fixtures);
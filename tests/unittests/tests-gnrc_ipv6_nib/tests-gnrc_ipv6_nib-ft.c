@@ -175,6 +175,99 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+/*
+ * Adds two routes to the forwarding table where the prefix of the second only
+ * differs from the first in its length, then tries to get an address whose
+ * bits between the two prefix lengths are all zero.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns route with the longer prefix
+ */
+static void test_nib_ft_get__success_longest_prefix(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 32, &next_hop1,
+                                                  IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 64, &next_hop2,
+                                                  IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+}
+
+static uint32_t _lcg(uint32_t *state)
+{
+    *state = (*state * 1103515245U) + 12345U;
+    return *state >> 8;
+}
+
+/*
+ * Fills the forwarding table with routes of random prefixes and prefix
+ * lengths, removes half of them and adds new ones, then tries to get routes
+ * for random addresses within the prefixes.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the route with the longest
+ * prefix matching the address, as found by iterating all routes
+ */
+static void test_nib_ft_get__success_random(void)
+{
+    static const uint8_t pfx_lens[] = { 16, 30, 32, 48, 56, 64, 127, 128 };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+    uint8_t dst_lens[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+    uint32_t state = TEST_UINT32;
+
+    for (unsigned round = 0; round < 2; round++) {
+        for (unsigned i = round; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF;
+             i += round + 1) {
+            ipv6_addr_t *dst = &dsts[i];
+
+            if (round) {
+                gnrc_ipv6_nib_ft_del(dst, dst_lens[i]);
+            }
+            dst_lens[i] = pfx_lens[_lcg(&state) % ARRAY_SIZE(pfx_lens)];
+            /* few different bits, so the prefixes overlap */
+            *dst = (ipv6_addr_t){ .u64 = { { .u8 = GLOBAL_PREFIX } } };
+            dst->u8[4] = _lcg(&state) & 0x3;
+            dst->u8[7] = _lcg(&state) & 0x1;
+            dst->u8[15] = _lcg(&state) & 0x1;
+            TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(dst, dst_lens[i],
+                                                          &next_hop, IFACE, 0));
+        }
+    }
+    for (unsigned i = 0; i < 4 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        gnrc_ipv6_nib_ft_t fte, exp = { .dst_len = 0 };
+        ipv6_addr_t addr = dsts[i % CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+        void *iter_state = NULL;
+        bool found = false;
+
+        addr.u8[7] ^= _lcg(&state) & 0x1;
+        addr.u8[15] ^= _lcg(&state) & 0x1;
+        while (gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte)) {
+            if ((fte.dst_len > 0) && (fte.dst_len >= exp.dst_len) &&
+                (ipv6_addr_match_prefix(&fte.dst, &addr) >= fte.dst_len)) {
+                exp = fte;
+                found = true;
+            }
+        }
+        if (!found) {
+            TEST_ASSERT_EQUAL_INT(-ENETUNREACH,
+                                  gnrc_ipv6_nib_ft_get(&addr, NULL, &fte));
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&addr, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(exp.dst_len, fte.dst_len);
+        TEST_ASSERT(ipv6_addr_equal(&exp.dst, &fte.dst));
+    }
+}
+#endif
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -724,6 +817,10 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+        new_TestFixture(test_nib_ft_get__success_longest_prefix),
+        new_TestFixture(test_nib_ft_get__success_random),
+#endif
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
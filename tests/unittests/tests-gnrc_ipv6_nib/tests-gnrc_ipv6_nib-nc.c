@@ -195,6 +195,89 @@ static void test_nib_nc_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_nc_iter(0, &iter_state, &nce));
 }
 
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries, then repeatedly
+ * removes random entries and creates new ones in their place.
+ * Expected result: all current entries can be found by their address, the
+ * removed ones can't
+ */
+static void test_nib_nc_del__success_readd(void)
+{
+    uint64_t iids[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    uint8_t l2addr[] = L2ADDR;
+    uint32_t state = TEST_UINT32;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        iids[i] = TEST_UINT64 + i;
+        addr.u64[1].u64 = iids[i];
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&addr, IFACE, l2addr,
+                                                      sizeof(l2addr)));
+    }
+    for (unsigned round = 0; round < 32; round++) {
+        state = (state * 1103515245U) + 12345U;
+        unsigned i = (state >> 8) % CONFIG_GNRC_IPV6_NIB_NUMOF;
+        _nib_onl_entry_t *node;
+
+        addr.u64[1].u64 = iids[i];
+        gnrc_ipv6_nib_nc_del(&addr, IFACE);
+        TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        iids[i] = TEST_UINT64 + CONFIG_GNRC_IPV6_NIB_NUMOF + round;
+        addr.u64[1].u64 = iids[i];
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&addr, IFACE, l2addr,
+                                                      sizeof(l2addr)));
+        for (unsigned j = 0; j < CONFIG_GNRC_IPV6_NIB_NUMOF; j++) {
+            addr.u64[1].u64 = iids[j];
+            TEST_ASSERT_NOT_NULL((node = _nib_onl_get(&addr, IFACE)));
+            TEST_ASSERT(ipv6_addr_equal(&addr, &node->ipv6));
+            TEST_ASSERT(node == _nib_onl_get(&addr, 0));
+        }
+    }
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different
+ * link-layer addresses and looks them up by link-layer address, then removes
+ * one by its link-layer address.
+ * Expected result: gnrc_ipv6_nib_nc_get_by_l2addr() finds the entries with
+ * their IPv6 address, but not the removed one
+ */
+static void test_nib_nc_get_by_l2addr__success(void)
+{
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+    uint8_t l2addr[] = L2ADDR;
+    gnrc_ipv6_nib_nc_t nce;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        addr.u64[1].u64 = TEST_UINT64 + i;
+        l2addr[7] = i;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&addr, IFACE, l2addr,
+                                                      sizeof(l2addr)));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        l2addr[7] = i;
+        TEST_ASSERT(gnrc_ipv6_nib_nc_get_by_l2addr(0, l2addr, sizeof(l2addr),
+                                                   &nce));
+        TEST_ASSERT_EQUAL_INT(TEST_UINT64 + i, nce.ipv6.u64[1].u64);
+        TEST_ASSERT(gnrc_ipv6_nib_nc_get_by_l2addr(IFACE, l2addr,
+                                                   sizeof(l2addr), &nce));
+        TEST_ASSERT(!gnrc_ipv6_nib_nc_get_by_l2addr(IFACE + 1, l2addr,
+                                                    sizeof(l2addr), &nce));
+    }
+    l2addr[7] = 0;
+    TEST_ASSERT(!gnrc_ipv6_nib_nc_get_by_l2addr(0, l2addr, sizeof(l2addr) - 1,
+                                                &nce));
+    TEST_ASSERT(gnrc_ipv6_nib_nc_del_l2(IFACE, l2addr, sizeof(l2addr)));
+    TEST_ASSERT(!gnrc_ipv6_nib_nc_get_by_l2addr(0, l2addr, sizeof(l2addr),
+                                                &nce));
+    l2addr[7] = 1;
+    TEST_ASSERT(gnrc_ipv6_nib_nc_get_by_l2addr(0, l2addr, sizeof(l2addr),
+                                               &nce));
+}
+#endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
+
 /*
  * Creates a non-manual neighbor cache entry (as the NIB would create it on an
  * incoming NDP packet), sets it to UNREACHABLE and then calls
@@ -311,6 +394,10 @@ Test *tests_gnrc_ipv6_nib_nc_tests(void)
         new_TestFixture(test_nib_nc_set__success_duplicate),
         new_TestFixture(test_nib_nc_del__unknown),
         new_TestFixture(test_nib_nc_del__success),
+        new_TestFixture(test_nib_nc_del__success_readd),
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+        new_TestFixture(test_nib_nc_get_by_l2addr__success),
+#endif
         new_TestFixture(test_nib_nc_mark_reachable__not_in_neighbor_cache),
         new_TestFixture(test_nib_nc_mark_reachable__unmanaged),
         new_TestFixture(test_nib_nc_mark_reachable__success),
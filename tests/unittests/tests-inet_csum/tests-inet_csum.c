@@ -10,7 +10,9 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "container.h"
 #include "embUnit.h"
 
 #include "net/inet_csum.h"
@@ -18,6 +20,35 @@
 #include "unittests-constants.h"
 #include "tests-inet_csum.h"
 
+#define DIFF_BUF_SIZE   (320U)
+
+/* byte-wise implementation to compare the optimized one against */
+static uint16_t _csum_slice_ref(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
 static void test_inet_csum__rfc_example(void)
 {
     /* source: https://tools.ietf.org/html/rfc1071#section-3 */
@@ -162,6 +193,70 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void _fill(uint8_t *buf, size_t len, uint32_t seed)
+{
+    for (size_t i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = seed >> 16;
+    }
+}
+
+static void test_inet_csum__differential(void)
+{
+    static uint8_t data[DIFF_BUF_SIZE];
+    static const uint16_t sums[] = { 0x0000, 0x0001, 0xfffe, 0xffff, 0x8a3c };
+
+    for (unsigned pattern = 0; pattern < 3; pattern++) {
+        switch (pattern) {
+        case 0:
+            memset(data, 0x00, sizeof(data));
+            break;
+        case 1:
+            /* maximizes the carries */
+            memset(data, 0xff, sizeof(data));
+            break;
+        default:
+            _fill(data, sizeof(data), TEST_UINT32);
+            break;
+        }
+
+        /* every alignment of the buffer and every length up to several blocks
+         * of the wide implementations */
+        for (unsigned offset = 0; offset < 16; offset++) {
+            for (unsigned len = 0; len <= DIFF_BUF_SIZE - 16; len++) {
+                for (unsigned i = 0; i < ARRAY_SIZE(sums); i++) {
+                    for (size_t accum_len = 0; accum_len < 2; accum_len++) {
+                        uint16_t expected = _csum_slice_ref(sums[i],
+                                                            data + offset, len,
+                                                            accum_len);
+                        uint16_t res = inet_csum_slice(sums[i], data + offset,
+                                                       len, accum_len);
+
+                        TEST_ASSERT_EQUAL_INT(expected, res);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void test_inet_csum__differential_slices(void)
+{
+    static uint8_t data[DIFF_BUF_SIZE];
+    uint16_t expected;
+
+    _fill(data, sizeof(data), TEST_UINT32);
+    expected = _csum_slice_ref(0, data, sizeof(data), 0);
+
+    /* split the domain into two slices at every position */
+    for (unsigned split = 0; split <= sizeof(data); split++) {
+        uint16_t sum = inet_csum_slice(0, data, split, 0);
+
+        sum = inet_csum_slice(sum, data + split, sizeof(data) - split, split);
+        TEST_ASSERT_EQUAL_INT(expected, sum);
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -173,6 +268,8 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__differential),
+        new_TestFixture(test_inet_csum__differential_slices),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
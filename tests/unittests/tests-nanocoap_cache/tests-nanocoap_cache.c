@@ -14,6 +14,7 @@
 
 #include "embUnit.h"
 
+#include "event.h"
 #include "net/nanocoap/cache.h"
 #include "ztimer.h"
 #include "hashes/sha256.h"
@@ -21,6 +22,44 @@
 #include "tests-nanocoap_cache.h"
 #define _BUF_SIZE (128U)
 
+static void _build_req(coap_pkt_t *req, uint8_t *buf, const char *path)
+{
+    uint8_t token[2] = {0xDA, 0xEC};
+    size_t len = coap_build_udp_hdr(buf, _BUF_SIZE, COAP_TYPE_NON,
+                                    &token[0], 2, COAP_METHOD_GET, 0xABCD);
+
+    coap_pkt_init(req, buf, _BUF_SIZE, len);
+    coap_opt_add_string(req, COAP_OPT_URI_PATH, path, '/');
+    coap_opt_finish(req, COAP_OPT_FINISH_NONE);
+}
+
+/* adds a response of resp_len bytes with the given Max-Age for path */
+static nanocoap_cache_entry_t *_add(const char *path, uint32_t max_age, size_t resp_len)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t rbuf[_BUF_SIZE] = { 0 };
+    coap_pkt_t req, resp;
+    uint8_t token[2] = {0xDA, 0xEC};
+
+    _build_req(&req, buf, path);
+    size_t len = coap_build_udp_hdr(rbuf, sizeof(rbuf), COAP_TYPE_NON,
+                                    &token[0], 2, COAP_CODE_205, 0xABCD);
+    coap_pkt_init(&resp, &rbuf[0], sizeof(rbuf), len);
+    coap_opt_add_uint(&resp, COAP_OPT_MAX_AGE, max_age);
+    coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+
+    return nanocoap_cache_add_by_req(&req, &resp, resp_len);
+}
+
+static nanocoap_cache_entry_t *_lookup(const char *path)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t req;
+
+    _build_req(&req, buf, path);
+    return nanocoap_cache_request_lookup(&req);
+}
+
 static void test_nanocoap_cache__cachekey(void)
 {
     uint8_t digest1[SHA256_DIGEST_LENGTH];
@@ -305,6 +344,135 @@ static void test_nanocoap_cache__max_age(void)
     TEST_ASSERT(nanocoap_cache_entry_is_stale(c, 20));
 }
 
+static void test_nanocoap_cache__lookup(void)
+{
+    char path[16];
+    nanocoap_cache_stats_t stats;
+    nanocoap_cache_entry_t *c;
+
+    nanocoap_cache_init();
+
+    /* more entries than buckets, so buckets are shared */
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        TEST_ASSERT_NOT_NULL(_add(path, 60, 32));
+    }
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        c = _lookup(path);
+        TEST_ASSERT_NOT_NULL(c);
+        TEST_ASSERT_EQUAL_INT(32, c->response_len);
+    }
+    TEST_ASSERT_NULL(_lookup("/other"));
+
+    /* a deleted entry is not found, and can't be deleted again */
+    c = _lookup("/path_1");
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_del(c));
+    TEST_ASSERT_NULL(_lookup("/path_1"));
+    TEST_ASSERT_EQUAL_INT(-1, nanocoap_cache_del(c));
+    TEST_ASSERT_NOT_NULL(_lookup("/path_2"));
+
+    /* replace an entry */
+    TEST_ASSERT_NOT_NULL(_add("/path_1", 60, 32));
+    TEST_ASSERT_NOT_NULL(_add("/other", 60, 32));
+
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES + 2, stats.hits);
+    TEST_ASSERT_EQUAL_INT(2, stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, stats.evictions);
+    TEST_ASSERT_EQUAL_INT(0, stats.expirations);
+
+    /* the statistics are reset with the cache */
+    nanocoap_cache_init();
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.hits + stats.misses + stats.evictions);
+}
+
+static void test_nanocoap_cache__replacement(void)
+{
+    char path[16];
+
+    nanocoap_cache_init();
+
+    /* all but /path_0 are accessed once after /path_0 is added, the sizes
+     * of the responses increase with the index */
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        TEST_ASSERT_NOT_NULL(_add(path, 60, 16 + i * 8));
+    }
+    for (unsigned i = 1; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        snprintf(path, sizeof(path), "/path_%u", i);
+        TEST_ASSERT_NOT_NULL(_lookup(path));
+    }
+    /* /path_0 is accessed often */
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_NOT_NULL(_lookup("/path_0"));
+    }
+
+    TEST_ASSERT_NOT_NULL(_add("/new", 60, 16));
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_LFU)
+    /* the least frequently used, and of those the least recently used */
+    TEST_ASSERT_NULL(_lookup("/path_1"));
+    TEST_ASSERT_NOT_NULL(_lookup("/path_0"));
+#elif IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+    /* the largest of the least frequently used */
+    snprintf(path, sizeof(path), "/path_%u", CONFIG_NANOCOAP_CACHE_ENTRIES - 1);
+    TEST_ASSERT_NULL(_lookup(path));
+    TEST_ASSERT_NOT_NULL(_lookup("/path_0"));
+    TEST_ASSERT_NOT_NULL(_lookup("/path_1"));
+#else
+    /* the least recently used */
+    TEST_ASSERT_NULL(_lookup("/path_1"));
+    TEST_ASSERT_NOT_NULL(_lookup("/path_0"));
+#endif
+    TEST_ASSERT_NOT_NULL(_lookup("/new"));
+
+    /* the entries accessed above are kept, the next victim is one of the
+     * entries that were only accessed once after being added */
+    TEST_ASSERT_NOT_NULL(_add("/newer", 60, 16));
+#if IS_USED(MODULE_NANOCOAP_CACHE_GDSF)
+    snprintf(path, sizeof(path), "/path_%u", CONFIG_NANOCOAP_CACHE_ENTRIES - 2);
+#else
+    snprintf(path, sizeof(path), "/path_%u", 2);
+#endif
+    TEST_ASSERT_NULL(_lookup(path));
+    TEST_ASSERT_NOT_NULL(_lookup("/path_0"));
+    TEST_ASSERT_NOT_NULL(_lookup("/new"));
+    TEST_ASSERT_NOT_NULL(_lookup("/newer"));
+}
+
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+static void test_nanocoap_cache__expire(void)
+{
+    event_queue_t queue;
+    nanocoap_cache_stats_t stats;
+    event_t *event;
+
+    event_queue_init(&queue);
+    nanocoap_cache_init();
+    nanocoap_cache_expire_init(&queue);
+
+    TEST_ASSERT_NOT_NULL(_add("/short", 0, 32));
+    TEST_ASSERT_NOT_NULL(_add("/long", 60, 32));
+
+    /* /short becomes stale within a second */
+    event = event_wait_timeout_ztimer(&queue, ZTIMER_SEC, 3);
+    TEST_ASSERT_NOT_NULL(event);
+    event->handler(event);
+
+    TEST_ASSERT_EQUAL_INT(1, nanocoap_cache_used_count());
+    TEST_ASSERT_NULL(_lookup("/short"));
+    TEST_ASSERT_NOT_NULL(_lookup("/long"));
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.expirations);
+
+    /* stops the timer armed for /long */
+    nanocoap_cache_init();
+    TEST_ASSERT_NULL(event_get(&queue));
+}
+#endif
+
 Test *tests_nanocoap_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -313,6 +481,11 @@ Test *tests_nanocoap_cache_tests(void)
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__cachekey_blockwise),
         new_TestFixture(test_nanocoap_cache__max_age),
+        new_TestFixture(test_nanocoap_cache__lookup),
+        new_TestFixture(test_nanocoap_cache__replacement),
+#if IS_USED(MODULE_NANOCOAP_CACHE_EXPIRE)
+        new_TestFixture(test_nanocoap_cache__expire),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_cache_entry_tests, NULL, NULL, fixtures);
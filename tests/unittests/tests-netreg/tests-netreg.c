@@ -182,6 +182,37 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_getnext__other_types(void)
+{
+    gnrc_netreg_entry_t others[GNRC_NETTYPE_NUMOF];
+    gnrc_netreg_entry_t *res = NULL;
+
+    test_netreg_num__2_entries();
+    /* same demux context for every other type */
+    for (int type = GNRC_NETTYPE_UNDEF; type < GNRC_NETTYPE_NUMOF; type++) {
+        gnrc_netreg_entry_init_pid(&others[type], TEST_UINT16, TEST_UINT8 + 2);
+        if (type != GNRC_NETTYPE_TEST) {
+            TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(type, &others[type]));
+        }
+    }
+
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)));
+    TEST_ASSERT(res->target.pid != TEST_UINT8 + 2);
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+    TEST_ASSERT(res->target.pid != TEST_UINT8 + 2);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UNDEF, TEST_UINT16));
+    gnrc_netreg_release_shared();
+
+    for (int type = GNRC_NETTYPE_UNDEF; type < GNRC_NETTYPE_NUMOF; type++) {
+        if (type != GNRC_NETTYPE_TEST) {
+            gnrc_netreg_unregister(type, &others[type]);
+        }
+    }
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -198,6 +229,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_getnext__other_types),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -11,6 +11,7 @@
  */
 #include <errno.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/uio.h>
 
 #include "embUnit.h"
@@ -865,6 +866,134 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#if CONFIG_GNRC_PKTBUF_LENT_NUMOF
+static uint8_t _lent_buf[CONFIG_GNRC_PKTBUF_LENT_NUMOF][32];
+static unsigned _lent_returned;
+
+static void _lent_release(void *arg)
+{
+    TEST_ASSERT(arg == _lent_buf[0]);
+    _lent_returned++;
+}
+
+static gnrc_pktsnip_t *_add_lent(void)
+{
+    _lent_returned = 0;
+    memcpy(_lent_buf[0], TEST_STRING16, sizeof(TEST_STRING16));
+    return gnrc_pktbuf_add_lent(NULL, _lent_buf[0], sizeof(TEST_STRING16),
+                                GNRC_NETTYPE_TEST, _lent_release,
+                                _lent_buf[0]);
+}
+
+static void test_pktbuf_add_lent__success(void)
+{
+    gnrc_pktsnip_t *pkt = _add_lent();
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(pkt->data == _lent_buf[0]);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), pkt->size);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_TEST, pkt->type);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    gnrc_pktbuf_hold(pkt, 1);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(0, _lent_returned);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, _lent_returned);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_lent__full(void)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_PKTBUF_LENT_NUMOF];
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_LENT_NUMOF; i++) {
+        pkts[i] = gnrc_pktbuf_add_lent(NULL, _lent_buf[i], sizeof(_lent_buf[i]),
+                                       GNRC_NETTYPE_TEST, _lent_release,
+                                       _lent_buf[0]);
+        TEST_ASSERT_NOT_NULL(pkts[i]);
+    }
+    _lent_returned = 0;
+    TEST_ASSERT_NULL(gnrc_pktbuf_add_lent(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                                          GNRC_NETTYPE_TEST, _lent_release,
+                                          _lent_buf[0]));
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_LENT_NUMOF; i++) {
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_LENT_NUMOF, _lent_returned);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_lent__mark(void)
+{
+    gnrc_pktsnip_t *pkt = _add_lent();
+    gnrc_pktsnip_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 4, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    /* both parts still point into the lent buffer */
+    TEST_ASSERT(hdr->data == _lent_buf[0]);
+    TEST_ASSERT(pkt->data == &_lent_buf[0][4]);
+    TEST_ASSERT_EQUAL_INT(4, hdr->size);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16) - 4, pkt->size);
+    TEST_ASSERT(pkt->next == hdr);
+    gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(0, _lent_returned);
+    TEST_ASSERT_EQUAL_STRING(&TEST_STRING16[4], pkt->data);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, _lent_returned);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_lent__realloc_shrink(void)
+{
+    gnrc_pktsnip_t *pkt = _add_lent();
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 8));
+    TEST_ASSERT(pkt->data == _lent_buf[0]);
+    TEST_ASSERT_EQUAL_INT(8, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, _lent_returned);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, _lent_returned);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_lent__realloc_grow(void)
+{
+    gnrc_pktsnip_t *pkt = _add_lent();
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 40));
+    TEST_ASSERT(pkt->data != _lent_buf[0]);
+    TEST_ASSERT_EQUAL_INT(40, pkt->size);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt->data);
+    /* the copy does not need the lent buffer anymore */
+    TEST_ASSERT_EQUAL_INT(1, _lent_returned);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_lent__start_write(void)
+{
+    gnrc_pktsnip_t *pkt = _add_lent();
+    gnrc_pktsnip_t *pkt_copy;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_hold(pkt, 1);
+    pkt_copy = gnrc_pktbuf_start_write(pkt);
+    TEST_ASSERT_NOT_NULL(pkt_copy);
+    TEST_ASSERT(pkt_copy != pkt);
+    TEST_ASSERT(pkt_copy->data != _lent_buf[0]);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt_copy->data);
+    gnrc_pktbuf_release(pkt_copy);
+    TEST_ASSERT_EQUAL_INT(0, _lent_returned);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, _lent_returned);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* CONFIG_GNRC_PKTBUF_LENT_NUMOF */
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -923,6 +1052,14 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
         new_TestFixture(test_pktbuf_reverse_snips__success),
+#if CONFIG_GNRC_PKTBUF_LENT_NUMOF
+        new_TestFixture(test_pktbuf_add_lent__success),
+        new_TestFixture(test_pktbuf_add_lent__full),
+        new_TestFixture(test_pktbuf_add_lent__mark),
+        new_TestFixture(test_pktbuf_add_lent__realloc_shrink),
+        new_TestFixture(test_pktbuf_add_lent__realloc_grow),
+        new_TestFixture(test_pktbuf_add_lent__start_write),
+#endif /* CONFIG_GNRC_PKTBUF_LENT_NUMOF */
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
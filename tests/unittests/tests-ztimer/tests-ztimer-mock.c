@@ -377,6 +377,46 @@ static void test_ztimer_mock_remove(void)
     TEST_ASSERT_EQUAL_INT(2, count);
 }
 
+/**
+ * @brief   Testing the time until the next timer expires
+ */
+static void test_ztimer_mock_next_timeout(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    uint32_t ticks;
+    ztimer_t alarms[] = {
+        { .callback = cb_incr, .arg = &count },
+        { .callback = cb_incr, .arg = &count },
+    };
+
+    /* 16 bit counter to also cover the extension */
+    ztimer_mock_init(&zmock, 16);
+    TEST_ASSERT(!ztimer_next_timeout(z, &ticks));
+
+    ztimer_set(z, &alarms[0], 100000);
+    TEST_ASSERT(ztimer_next_timeout(z, &ticks));
+    TEST_ASSERT_EQUAL_INT(100000, ticks);
+
+    ztimer_set(z, &alarms[1], 300);
+    TEST_ASSERT(ztimer_next_timeout(z, &ticks));
+    TEST_ASSERT_EQUAL_INT(300, ticks);
+
+    /* time passing without the list being updated */
+    ztimer_mock_advance(&zmock, 100);
+    TEST_ASSERT(ztimer_next_timeout(z, &ticks));
+    TEST_ASSERT_EQUAL_INT(200, ticks);
+
+    ztimer_mock_advance(&zmock, 200);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(ztimer_next_timeout(z, &ticks));
+    TEST_ASSERT_EQUAL_INT(100000 - 300, ticks);
+
+    ztimer_remove(z, &alarms[0]);
+    TEST_ASSERT(!ztimer_next_timeout(z, &ticks));
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -388,6 +428,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
         new_TestFixture(test_ztimer_mock_remove),
+        new_TestFixture(test_ztimer_mock_next_timeout),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);